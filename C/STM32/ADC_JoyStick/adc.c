@@ -5,7 +5,7 @@
 # Created Date: Saturday, October 28th 2023, 11:24:39 pm                       #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Sunday, October 29th 2023, 12:48:25 pm                        #
+# Last Modified: Sunday, October 18th 2026, 11:41:05 pm                        #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -19,11 +19,19 @@
 
 #include "main.h"
 #include "adc.h"
+#include "adc_filter.h"
+#include <stdio.h>
 
 /*##############################################################################################################################################*/
 /*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
+static void                 ADC_publishHalf( uint8_t half );
+static HAL_StatusTypeDef    ADC_configure( uint32_t trigger, uint32_t sampleTime );
+static uint32_t             ADC_timerClockHz( void );
+static void                 ADC_filterBlock( const ADC_frame_t *block, uint16_t frames );
+static void                 ADC_cycleCounterInit( void );
+static HAL_StatusTypeDef    ADC_timerConfig( uint32_t rateHz );
 
 
 /*##############################################################################################################################################*/
@@ -31,6 +39,30 @@
 /*##############################################################################################################################################*/
 
 ADC_HandleTypeDef hadc;
+DMA_HandleTypeDef hdma_adc1;
+
+/*Circular DMA Double Buffer and the last completed half ( written from the DMA Interrupt only )*/
+static ADC_frame_t          adcDmaBuf[ ADC_JOY_DMA_FRAMES ];
+static volatile uint8_t     adcLatestHalf = 0;
+static volatile uint32_t    adcHalfSeq = 0;
+
+/*Acquisition Mode and Processing Stage of the Timed Acquisition*/
+TIM_HandleTypeDef           htim2;
+static ADC_acqMode_t        adcAcqMode = ADC_ACQ_STOPPED;
+static ADC_blockCB_t        adcBlockCB = NULL;
+static uint32_t             adcSampleRateHz = 0;
+
+/*Joystick filter chain per axis ( X, Y ) and its latest output, X in the low and Y in the high half word*/
+static ADC_median_t         adcMedian[ ADC_JOY_CHANNELS ];
+static ADC_ema_t            adcEma[ ADC_JOY_CHANNELS ];
+static volatile uint32_t    adcFilteredXY = 0;
+
+/*Wake-on-Movement State, advanced to TRIGGERED from the watchdog interrupt*/
+static volatile ADC_wakeState_t adcWakeState = ADC_WAKE_OFF;
+static uint32_t                 adcWakeIdleTick = 0;
+
+/*Proportional Conversion Stage*/
+static JOY_t                    adcJoy;
 
 /*##############################################################################################################################################*/
 /*DEFINES_______________________________________________________________________________________________________________________________________*/
@@ -56,78 +88,516 @@ ADC_HandleTypeDef hadc;
 
 void ADC_Init( void )
 {
-    ADC_ChannelConfTypeDef sConfig = {0};
+    uint8_t axis;
 
-    // Configure ADC peripheral
-    hadc.Instance = ADC1;
-    hadc.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV2; // Assuming you want to divide PCLK by 2
-    hadc.Init.ScanConvMode = DISABLE; // Non-scan mode
-    hadc.Init.ContinuousConvMode = DISABLE; // Continuous conversion disabled
-    hadc.Init.DiscontinuousConvMode = DISABLE;
-    hadc.Init.ExternalTrigConv = ADC_SOFTWARE_START; // Software trigger
-    hadc.Init.DataAlign = ADC_DATAALIGN_RIGHT;
-    hadc.Init.NbrOfConversion = 1; // Only one conversion
-    if (HAL_ADC_Init(&hadc) != HAL_OK)
+    for( axis = 0; axis < ADC_JOY_CHANNELS; axis++ )
+    {
+        ADC_medianInit( &adcMedian[ axis ], ADC_JOY_MEDIAN_LEN );
+        ADC_emaInit( &adcEma[ axis ], ADC_JOY_EMA_SHIFT );
+    }
+    JOY_init( &adcJoy );
+
+    if( ADC_startContinuous( ) != HAL_OK )
     {
         // Initialization error handling
         Error_Handler();
     }
+}
 
-    // Configure for the ADC regular channel to be converted.
-    sConfig.Channel = ADC_CHANNEL_0; // PA0
-    sConfig.Rank = 1;
-    sConfig.SamplingTime = ADC_SAMPLETIME_3CYCLES; // Choose a proper sampling time
-    if (HAL_ADC_ConfigChannel(&hadc, &sConfig) != HAL_OK)
+/**
+ * @brief Free running Acquisition: the scan sequence restarts as soon as it completes, the rate is set by the sampling time. 
+ * Used by getXYJoyStickVal( ).
+ * 
+ * @return HAL_StatusTypeDef HAL Status
+ */
+HAL_StatusTypeDef ADC_startContinuous( void )
+{
+    ADC_stopAcquisition( );
+
+    if( ADC_configure( ADC_SOFTWARE_START, ADC_JOY_SAMPLETIME ) != HAL_OK )
     {
-        // Configuration error handling
-        Error_Handler();
+        return HAL_ERROR;
+    }
+
+    adcBlockCB  = NULL;
+    adcAcqMode  = ADC_ACQ_CONTINUOUS;
+
+    // Stream the conversions into the double buffer, from here on the ADC runs without CPU involvement
+    return HAL_ADC_Start_DMA( &hadc, ( uint32_t * )adcDmaBuf, ADC_JOY_DMA_FRAMES * ADC_JOY_CHANNELS );
+}
+
+/**
+ * @brief Fixed Rate Acquisition: TIM2 TRGO starts one scan sequence per sample period. Every completed half of the DMA ring 
+ * ( ADC_JOY_FRAMES_PER_HALF Frames ) is handed to blockCB, which runs in Interrupt Context and must return within one block period.
+ * 
+ * @param sampleRateHz Frames per second ( ADC_ACQ_RATE_MIN_HZ..ADC_ACQ_RATE_MAX_HZ )
+ * @param blockCB Processing Stage, may be NULL ( getXYJoyStickVal( ) keeps working )
+ * @return HAL_StatusTypeDef HAL_OK if started, HAL_ERROR on invalid rate or Peripheral Error
+ */
+HAL_StatusTypeDef ADC_startTimed( uint32_t sampleRateHz, ADC_blockCB_t blockCB )
+{
+    if( ( sampleRateHz < ADC_ACQ_RATE_MIN_HZ ) || ( sampleRateHz > ADC_ACQ_RATE_MAX_HZ ) )
+    {
+        return HAL_ERROR;
+    }
+
+    ADC_stopAcquisition( );
+
+    if( ADC_configure( ADC_EXTERNALTRIGCONV_T2_TRGO, ADC_ACQ_SAMPLETIME ) != HAL_OK )
+    {
+        return HAL_ERROR;
     }
+
+    if( ADC_timerConfig( sampleRateHz ) != HAL_OK )
+    {
+        return HAL_ERROR;
+    }
+
+    adcBlockCB      = blockCB;
+    adcAcqMode      = ADC_ACQ_TIMED;
+
+    if( HAL_ADC_Start_DMA( &hadc, ( uint32_t * )adcDmaBuf, ADC_JOY_DMA_FRAMES * ADC_JOY_CHANNELS ) != HAL_OK )
+    {
+        return HAL_ERROR;
+    }
+
+    return HAL_TIM_Base_Start( &htim2 );
+}
+
+/**
+ * @brief Stop any running Acquisition ( including an armed watchdog ). The latest Frame stays readable.
+ * 
+ */
+void ADC_stopAcquisition( void )
+{
+    ADC_AnalogWDGConfTypeDef awdConfig = { 0 };
+
+    if( ( adcAcqMode == ADC_ACQ_TIMED ) || ( adcAcqMode == ADC_ACQ_WATCH ) )
+    {
+        HAL_TIM_Base_Stop( &htim2 );
+    }
+
+    if( adcAcqMode == ADC_ACQ_WATCH )
+    {
+        HAL_ADC_Stop( &hadc );
+
+        awdConfig.WatchdogMode  = ADC_ANALOGWATCHDOG_NONE;
+        awdConfig.ITMode        = DISABLE;
+        HAL_ADC_AnalogWDGConfig( &hadc, &awdConfig );
+    }
+    else if( adcAcqMode != ADC_ACQ_STOPPED )
+    {
+        HAL_ADC_Stop_DMA( &hadc );
+    }
+
+    adcAcqMode      = ADC_ACQ_STOPPED;
+    adcBlockCB      = NULL;
+    adcSampleRateHz = 0;
+}
+
+/**
+ * @brief Actual Frame Rate of the Timed Acquisition ( rounded to the timer resolution ), 0 in the other modes
+ * 
+ * @return uint32_t Frames per second
+ */
+uint32_t ADC_getSampleRate( void )
+{
+    return adcSampleRateHz;
 }
 
 void HAL_ADC_MspInit(ADC_HandleTypeDef* hadc)
 {
     __HAL_RCC_ADC1_CLK_ENABLE( );
     __HAL_RCC_GPIOA_CLK_ENABLE( );
+    __HAL_RCC_DMA2_CLK_ENABLE( );
 
     GPIO_InitTypeDef GPIO_InitStruct = { 0 };
     GPIO_InitStruct.Pin = GPIO_PIN_0 | GPIO_PIN_1;
     GPIO_InitStruct.Mode = GPIO_MODE_ANALOG;
     HAL_GPIO_Init( GPIOA, &GPIO_InitStruct );
-    
+
+    /*ADC1: DMA2 Stream0 Channel0, Circular, one Half Word per conversion*/
+    hdma_adc1.Instance                  = DMA2_Stream0;
+    hdma_adc1.Init.Channel              = DMA_CHANNEL_0;
+    hdma_adc1.Init.Direction            = DMA_PERIPH_TO_MEMORY;
+    hdma_adc1.Init.PeriphInc            = DMA_PINC_DISABLE;
+    hdma_adc1.Init.MemInc               = DMA_MINC_ENABLE;
+    hdma_adc1.Init.PeriphDataAlignment  = DMA_PDATAALIGN_HALFWORD;
+    hdma_adc1.Init.MemDataAlignment     = DMA_MDATAALIGN_HALFWORD;
+    hdma_adc1.Init.Mode                 = DMA_CIRCULAR;
+    hdma_adc1.Init.Priority             = DMA_PRIORITY_HIGH;
+    hdma_adc1.Init.FIFOMode             = DMA_FIFOMODE_DISABLE;
+    if( HAL_DMA_Init( &hdma_adc1 ) != HAL_OK )
+    {
+        Error_Handler( );
+    }
+    __HAL_LINKDMA( hadc, DMA_Handle, hdma_adc1 );
+
+    HAL_NVIC_SetPriority( DMA2_Stream0_IRQn, 1, 0 );
+    HAL_NVIC_EnableIRQ( DMA2_Stream0_IRQn );
+
+    /*ADC1 global interrupt, only the Analog Watchdog is enabled ( Wake-on-Movement )*/
+    HAL_NVIC_SetPriority( ADC_IRQn, 2, 0 );
+    HAL_NVIC_EnableIRQ( ADC_IRQn );
+}
+
+void HAL_TIM_Base_MspInit( TIM_HandleTypeDef* htim )
+{
+    if( htim->Instance == TIM2 )
+    {
+        __HAL_RCC_TIM2_CLK_ENABLE( );
+    }
+}
+
+/**
+ * @brief This function handles DMA2 Stream0 ( ADC1 ) global interrupt
+ * 
+ */
+void DMA2_Stream0_IRQHandler( void )
+{
+    HAL_DMA_IRQHandler( &hdma_adc1 );
+}
+
+/**
+ * @brief DMA filled the first half of the double buffer
+ * 
+ */
+void HAL_ADC_ConvHalfCpltCallback( ADC_HandleTypeDef* hadc )
+{
+    ( void )hadc;
+    ADC_publishHalf( 0 );
+}
+
+/**
+ * @brief DMA filled the second half of the double buffer, it wraps around to the first half
+ * 
+ */
+void HAL_ADC_ConvCpltCallback( ADC_HandleTypeDef* hadc )
+{
+    ( void )hadc;
+    ADC_publishHalf( 1 );
+}
+
+/**
+ * @brief Arm the Wake-on-Movement Mode: TIM2 paces slow scans ( ADC_WAKE_WATCH_RATE_HZ ) without DMA, and the Analog Watchdog 
+ * raises the only interrupt once an axis leaves the ADC_THRESHOLD_LOW..ADC_THRESHOLD_HIGH window. Call ADC_wakeSleep( ) to idle the CPU.
+ * 
+ * @return HAL_StatusTypeDef HAL Status
+ */
+HAL_StatusTypeDef ADC_wakeArm( void )
+{
+    ADC_AnalogWDGConfTypeDef awdConfig = { 0 };
+
+    ADC_stopAcquisition( );
+
+    if( ADC_configure( ADC_EXTERNALTRIGCONV_T2_TRGO, ADC_ACQ_SAMPLETIME ) != HAL_OK )
+    {
+        return HAL_ERROR;
+    }
+
+    /*Watch every regular channel ( X and Y ) against the deadzone window*/
+    awdConfig.WatchdogMode  = ADC_ANALOGWATCHDOG_ALL_REG;
+    awdConfig.HighThreshold = ADC_THRESHOLD_HIGH;
+    awdConfig.LowThreshold  = ADC_THRESHOLD_LOW;
+    awdConfig.ITMode        = ENABLE;
+    if( HAL_ADC_AnalogWDGConfig( &hadc, &awdConfig ) != HAL_OK )
+    {
+        return HAL_ERROR;
+    }
+
+    if( ADC_timerConfig( ADC_WAKE_WATCH_RATE_HZ ) != HAL_OK )
+    {
+        return HAL_ERROR;
+    }
+
+    adcAcqMode      = ADC_ACQ_WATCH;
+    adcWakeState    = ADC_WAKE_ARMED;
+
+    /*No EOC interrupt, no DMA: the ADC only wakes the CPU through the watchdog*/
+    if( HAL_ADC_Start( &hadc ) != HAL_OK )
+    {
+        return HAL_ERROR;
+    }
+
+    return HAL_TIM_Base_Start( &htim2 );
+}
+
+/**
+ * @brief Wake-on-Movement state machine, call from the main loop. A watchdog event switches to full rate sampling, 
+ * once both axes stayed inside the deadzone for ADC_WAKE_IDLE_MS the watchdog is armed again.
+ * 
+ * @return ADC_wakeState_t Current State
+ */
+ADC_wakeState_t ADC_wakeProcess( void )
+{
+    ADC_frame_t frame;
+
+    switch( adcWakeState )
+    {
+        case ADC_WAKE_TRIGGERED:
+            if( ADC_startContinuous( ) != HAL_OK )
+            {
+                Error_Handler( );
+            }
+            adcWakeState    = ADC_WAKE_ACTIVE;
+            adcWakeIdleTick = HAL_GetTick( );
+            break;
+
+        case ADC_WAKE_ACTIVE:
+            if( ( ADC_getFilteredFrame( &frame ) != 0 ) && 
+                ( ( frame.x < ADC_THRESHOLD_LOW ) || ( frame.x > ADC_THRESHOLD_HIGH ) ||
+                  ( frame.y < ADC_THRESHOLD_LOW ) || ( frame.y > ADC_THRESHOLD_HIGH ) ) )
+            {
+                adcWakeIdleTick = HAL_GetTick( );
+            }
+            else if( ( HAL_GetTick( ) - adcWakeIdleTick ) >= ADC_WAKE_IDLE_MS )
+            {
+                if( ADC_wakeArm( ) != HAL_OK )
+                {
+                    Error_Handler( );
+                }
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return adcWakeState;
+}
+
+/**
+ * @brief Sleep until the next interrupt while the watchdog is armed. SysTick is suspended so that only the watchdog 
+ * ( or another enabled interrupt ) wakes the CPU. Returns immediately in the other states.
+ * The state is checked with interrupts masked: a watchdog event between the check and WFI stays pending and makes 
+ * WFI return at once instead of sleeping through it. The handler runs once interrupts are enabled again.
+ * 
+ */
+void ADC_wakeSleep( void )
+{
+    __disable_irq( );
+
+    if( adcWakeState != ADC_WAKE_ARMED )
+    {
+        __enable_irq( );
+        return;
+    }
+
+    HAL_SuspendTick( );
+    HAL_PWR_EnterSLEEPMode( PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI );
+    HAL_ResumeTick( );
+
+    __enable_irq( );
+}
+
+/**
+ * @brief Disarm the Wake-on-Movement Mode ( the acquisition is stopped )
+ * 
+ */
+void ADC_wakeDisarm( void )
+{
+    ADC_stopAcquisition( );
+    adcWakeState = ADC_WAKE_OFF;
+}
+
+/**
+ * @brief This function handles ADC1 global interrupt ( Analog Watchdog )
+ * 
+ */
+void ADC_IRQHandler( void )
+{
+    HAL_ADC_IRQHandler( &hadc );
+}
+
+/**
+ * @brief An axis left the deadzone window while armed: silence the watchdog, the main loop switches to full rate sampling
+ * 
+ */
+void HAL_ADC_LevelOutOfWindowCallback( ADC_HandleTypeDef* hadc )
+{
+    __HAL_ADC_DISABLE_IT( hadc, ADC_IT_AWD );
+
+    if( adcWakeState == ADC_WAKE_ARMED )
+    {
+        adcWakeState = ADC_WAKE_TRIGGERED;
+    }
+}
+
+/**
+ * @brief Lock-free copy of the most recent completed Frame. The DMA is writing the other half of the buffer meanwhile, 
+ * the copy is retried if a new half completed while it was taken.
+ * 
+ * @param frame Latest X, Y Conversions
+ * @return uint32_t Sequence Number of the completed half the frame was taken from, 0 if no conversion completed yet
+ */
+uint32_t ADC_getLatestFrame( ADC_frame_t *frame )
+{
+    uint32_t seq;
+    uint8_t half;
+
+    do
+    {
+        seq = adcHalfSeq;
+        __DMB( );
+        half = adcLatestHalf;
+        *frame = adcDmaBuf[ ( half * ADC_JOY_FRAMES_PER_HALF ) + ( ADC_JOY_FRAMES_PER_HALF - 1 ) ];
+        __DMB( );
+    } while( seq != adcHalfSeq );
+
+    return seq;
+}
+
+/**
+ * @brief Filtered X, Y Frame ( Median then EMA per axis ), updated for every completed block. A single word, read atomically.
+ * 
+ * @param frame Latest filtered X, Y
+ * @return uint32_t Sequence Number of the completed half it was computed from, 0 if no conversion completed yet
+ */
+uint32_t ADC_getFilteredFrame( ADC_frame_t *frame )
+{
+    uint32_t seq;
+    uint32_t xy;
+
+    do
+    {
+        seq = adcHalfSeq;
+        __DMB( );
+        xy = adcFilteredXY;
+        __DMB( );
+    } while( seq != adcHalfSeq );
+
+    frame->x = ( uint16_t )( xy & 0xFFFF );
+    frame->y = ( uint16_t )( xy >> 16 );
+
+    return seq;
+}
+
+/**
+ * @brief Measure the cost of each filter of adc_filter.c on this core, in cycles per sample, and print the result.
+ * Runs over a synthetic noisy trace of ADC_FILT_BENCH_SAMPLES samples ( one axis, interleaved like a DMA block ).
+ * 
+ */
+void ADC_filterBenchmark( void )
+{
+    static ADC_frame_t trace[ ADC_FILT_BENCH_SAMPLES ];
+    static uint16_t out[ ADC_FILT_BENCH_SAMPLES ];
+    ADC_osr_t osr;
+    ADC_ma_t ma;
+    ADC_median_t med;
+    ADC_ema_t ema;
+    uint32_t lcg = 12345;
+    uint32_t start, cycles[ 4 ];
+    uint16_t i;
+
+    for( i = 0; i < ADC_FILT_BENCH_SAMPLES; i++ )
+    {
+        lcg = ( lcg * 1664525UL ) + 1013904223UL;
+        trace[ i ].x = ( uint16_t )( 2048 + ( ( lcg >> 24 ) & 0x3F ) - 32 );
+        trace[ i ].y = trace[ i ].x;
+    }
+
+    ADC_cycleCounterInit( );
+
+    ADC_osrInit( &osr, 4, 2 );
+    start = DWT->CYCCNT;
+    ADC_osrBlock( &osr, &trace[ 0 ].x, ADC_JOY_CHANNELS, ADC_FILT_BENCH_SAMPLES, out );
+    cycles[ 0 ] = DWT->CYCCNT - start;
+
+    ADC_maInit( &ma, 4 );
+    start = DWT->CYCCNT;
+    ADC_maBlock( &ma, &trace[ 0 ].x, ADC_JOY_CHANNELS, ADC_FILT_BENCH_SAMPLES, out );
+    cycles[ 1 ] = DWT->CYCCNT - start;
+
+    ADC_medianInit( &med, 5 );
+    start = DWT->CYCCNT;
+    ADC_medianBlock( &med, &trace[ 0 ].x, ADC_JOY_CHANNELS, ADC_FILT_BENCH_SAMPLES, out );
+    cycles[ 2 ] = DWT->CYCCNT - start;
+
+    ADC_emaInit( &ema, 3 );
+    start = DWT->CYCCNT;
+    ADC_emaBlock( &ema, &trace[ 0 ].x, ADC_JOY_CHANNELS, ADC_FILT_BENCH_SAMPLES, out );
+    cycles[ 3 ] = DWT->CYCCNT - start;
+
+    printf( "ADC Filter Benchmark ( %u samples, cycles/sample ): \r\n", ADC_FILT_BENCH_SAMPLES );
+    printf( "  Oversampler x16 : %lu.%02lu \r\n", cycles[ 0 ] / ADC_FILT_BENCH_SAMPLES, ( ( cycles[ 0 ] * 100 ) / ADC_FILT_BENCH_SAMPLES ) % 100 );
+    printf( "  Moving Avg 16   : %lu.%02lu \r\n", cycles[ 1 ] / ADC_FILT_BENCH_SAMPLES, ( ( cycles[ 1 ] * 100 ) / ADC_FILT_BENCH_SAMPLES ) % 100 );
+    printf( "  Median 5        : %lu.%02lu \r\n", cycles[ 2 ] / ADC_FILT_BENCH_SAMPLES, ( ( cycles[ 2 ] * 100 ) / ADC_FILT_BENCH_SAMPLES ) % 100 );
+    printf( "  EMA shift 3     : %lu.%02lu \r\n", cycles[ 3 ] / ADC_FILT_BENCH_SAMPLES, ( ( cycles[ 3 ] * 100 ) / ADC_FILT_BENCH_SAMPLES ) % 100 );
 }
 
 /**
- * @brief Get the Joystick X, Y Value in a typedef joyStickVal_t
+ * @brief Get the Joystick X, Y Value in a typedef joyStickVal_t. Non-blocking, the latest filtered Frame is used.
  * 
- * @return joyStickVal_t Struct containing X, Y Values
+ * @return joyStickVal_t Struct containing X, Y Values ( centred until the first conversion completed )
  */
 joyStickVal_t getXYJoyStickVal( void )
 {
-    ADC_ChannelConfTypeDef sConfig = { 0 };
-    uint32_t x_value = 0, y_value = 0;
-    
-    sConfig.Channel = ADC_CHANNEL_0; // PA0
-    sConfig.Rank = 1;
-    sConfig.SamplingTime = ADC_SAMPLETIME_3CYCLES; // Choose a proper sampling time
-    HAL_ADC_ConfigChannel(&hadc, &sConfig);
+    joyStickVal_t centre = { 0, 0 };
+    ADC_frame_t frame;
 
-    // Read X-axis
-    HAL_ADC_Start(&hadc);
-    HAL_ADC_PollForConversion(&hadc, HAL_MAX_DELAY);
-    x_value = HAL_ADC_GetValue(&hadc);
+    if( ADC_getFilteredFrame( &frame ) == 0 )
+    {
+        return centre;
+    }
 
-    sConfig.Channel = ADC_CHANNEL_1; // PA0
-    sConfig.Rank = 1;
-    sConfig.SamplingTime = ADC_SAMPLETIME_3CYCLES; // Choose a proper sampling time
-    HAL_ADC_ConfigChannel(&hadc, &sConfig);
+    return convertADCtoXY( frame.x, frame.y );
 
-    // Read Y-axis
-    HAL_ADC_Start(&hadc);
-    HAL_ADC_PollForConversion(&hadc, HAL_MAX_DELAY);
-    y_value = HAL_ADC_GetValue(&hadc);
+}
 
-    return convertADCtoXY( x_value, y_value );
+/**
+ * @brief Get the Joystick X, Y Value as a signed proportional output ( calibrated, radial deadzone with hysteresis, response curve )
+ * 
+ * @return joyStickVal_t Struct containing X, Y Values, -JOY_OUT_MAX..JOY_OUT_MAX ( centred until the first conversion completed )
+ */
+joyStickVal_t getXYJoyStickProportional( void )
+{
+    joyStickVal_t coordinate = { 0, 0 };
+    ADC_frame_t frame;
 
+    if( ADC_getFilteredFrame( &frame ) != 0 )
+    {
+        JOY_convert( &adcJoy, frame.x, frame.y, &coordinate.x, &coordinate.y );
+    }
+
+    return coordinate;
+}
+
+/**
+ * @brief Calibration step 1: capture the current ( released ) stick position as the centre
+ * 
+ */
+void ADC_joyCalCentre( void )
+{
+    ADC_frame_t frame;
+
+    if( ADC_getFilteredFrame( &frame ) != 0 )
+    {
+        JOY_calSetCentre( &adcJoy, frame.x, frame.y );
+    }
+}
+
+/**
+ * @brief Calibration step 2: call repeatedly while the stick is swept around its full range to capture the end stops
+ * 
+ */
+void ADC_joyCalTrack( void )
+{
+    ADC_frame_t frame;
+
+    if( ADC_getFilteredFrame( &frame ) != 0 )
+    {
+        JOY_calExtend( &adcJoy, frame.x, frame.y );
+    }
+}
+
+/**
+ * @brief Conversion Stage used by getXYJoyStickProportional( ), to configure the deadzone and curve
+ * 
+ * @return JOY_t* Joystick Conversion Stage
+ */
+JOY_t *ADC_getJoystick( void )
+{
+    return &adcJoy;
 }
 
 joyStickVal_t convertADCtoXY(uint16_t adcValueX, uint16_t adcValueY) 
@@ -153,4 +623,153 @@ joyStickVal_t convertADCtoXY(uint16_t adcValueX, uint16_t adcValueY)
     }
 
     return coordinate;
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Publish a completed half of the double buffer to the readers ( Interrupt Context )
+ * 
+ * @param half 0 or 1
+ */
+static void ADC_publishHalf( uint8_t half )
+{
+    ADC_filterBlock( &adcDmaBuf[ half * ADC_JOY_FRAMES_PER_HALF ], ADC_JOY_FRAMES_PER_HALF );
+
+    adcLatestHalf = half;
+    __DMB( );
+    adcHalfSeq++;
+
+    if( adcBlockCB != NULL )
+    {
+        adcBlockCB( &adcDmaBuf[ half * ADC_JOY_FRAMES_PER_HALF ], ADC_JOY_FRAMES_PER_HALF );
+    }
+}
+
+/**
+ * @brief Configure ADC1 for the Joystick Scan Sequence ( X rank 1, Y rank 2 )
+ * 
+ * @param trigger ADC_SOFTWARE_START for free running conversions, or a Timer TRGO
+ * @param sampleTime Sampling Time of both Channels
+ * @return HAL_StatusTypeDef HAL Status
+ */
+static HAL_StatusTypeDef ADC_configure( uint32_t trigger, uint32_t sampleTime )
+{
+    ADC_ChannelConfTypeDef sConfig = {0};
+
+    // Configure ADC peripheral: X and Y converted back to back in one scan sequence
+    hadc.Instance = ADC1;
+    hadc.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV8;
+    hadc.Init.Resolution = ADC_RESOLUTION_12B;
+    hadc.Init.ScanConvMode = ENABLE; // Scan mode, both joystick channels
+    hadc.Init.ContinuousConvMode = ( trigger == ADC_SOFTWARE_START ) ? ENABLE : DISABLE; // Free running, or one sequence per trigger
+    hadc.Init.DiscontinuousConvMode = DISABLE;
+    hadc.Init.ExternalTrigConv = trigger;
+    hadc.Init.ExternalTrigConvEdge = ( trigger == ADC_SOFTWARE_START ) ? ADC_EXTERNALTRIGCONVEDGE_NONE : ADC_EXTERNALTRIGCONVEDGE_RISING;
+    hadc.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+    hadc.Init.NbrOfConversion = ADC_JOY_CHANNELS;
+    hadc.Init.DMAContinuousRequests = ENABLE; // Keep requesting DMA transfers in Circular mode
+    hadc.Init.EOCSelection = ADC_EOC_SEQ_CONV;
+    if (HAL_ADC_Init(&hadc) != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+
+    // Rank 1: X-axis
+    sConfig.Channel = ADC_CHANNEL_0; // PA0
+    sConfig.Rank = 1;
+    sConfig.SamplingTime = sampleTime;
+    if (HAL_ADC_ConfigChannel(&hadc, &sConfig) != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+
+    // Rank 2: Y-axis
+    sConfig.Channel = ADC_CHANNEL_1; // PA1
+    sConfig.Rank = 2;
+    return HAL_ADC_ConfigChannel(&hadc, &sConfig);
+}
+
+/**
+ * @brief Input Clock of TIM2: PCLK1, doubled when the APB1 prescaler is not 1
+ * 
+ */
+static uint32_t ADC_timerClockHz( void )
+{
+    RCC_ClkInitTypeDef clkConfig;
+    uint32_t flashLatency;
+
+    HAL_RCC_GetClockConfig( &clkConfig, &flashLatency );
+
+    return ( clkConfig.APB1CLKDivider == RCC_HCLK_DIV1 ) ? HAL_RCC_GetPCLK1Freq( ) : ( 2 * HAL_RCC_GetPCLK1Freq( ) );
+}
+
+/**
+ * @brief Run the Joystick filter chain ( Median then EMA per axis ) over a completed block and publish the last output
+ * 
+ * @param block Completed Frames
+ * @param frames Number of Frames
+ */
+static void ADC_filterBlock( const ADC_frame_t *block, uint16_t frames )
+{
+    uint16_t x = 0, y = 0;
+    uint16_t i;
+
+    for( i = 0; i < frames; i++ )
+    {
+        x = ADC_emaUpdate( &adcEma[ 0 ], ADC_medianUpdate( &adcMedian[ 0 ], block[ i ].x ) );
+        y = ADC_emaUpdate( &adcEma[ 1 ], ADC_medianUpdate( &adcMedian[ 1 ], block[ i ].y ) );
+    }
+
+    adcFilteredXY = ( uint32_t )x | ( ( uint32_t )y << 16 );
+}
+
+/**
+ * @brief Enable the DWT Cycle Counter used by the Filter Benchmark
+ * 
+ */
+static void ADC_cycleCounterInit( void )
+{
+    if( ( DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk ) == 0 )
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+/**
+ * @brief Configure TIM2 to generate TRGO ( Update ) at the requested rate and record the actual rate
+ * 
+ * @param rateHz Trigger rate
+ * @return HAL_StatusTypeDef HAL Status
+ */
+static HAL_StatusTypeDef ADC_timerConfig( uint32_t rateHz )
+{
+    TIM_MasterConfigTypeDef sMasterConfig = { 0 };
+    uint32_t timClkHz;
+
+    /*TIM2 is 32 bit: no prescaler needed, the period alone sets the rate*/
+    timClkHz = ADC_timerClockHz( );
+    htim2.Instance                  = TIM2;
+    htim2.Init.Prescaler            = 0;
+    htim2.Init.CounterMode          = TIM_COUNTERMODE_UP;
+    htim2.Init.Period               = ( ( timClkHz + ( rateHz / 2 ) ) / rateHz ) - 1;
+    htim2.Init.ClockDivision        = TIM_CLOCKDIVISION_DIV1;
+    htim2.Init.AutoReloadPreload    = TIM_AUTORELOAD_PRELOAD_ENABLE;
+    if( HAL_TIM_Base_Init( &htim2 ) != HAL_OK )
+    {
+        return HAL_ERROR;
+    }
+
+    sMasterConfig.MasterOutputTrigger   = TIM_TRGO_UPDATE;
+    sMasterConfig.MasterSlaveMode       = TIM_MASTERSLAVEMODE_DISABLE;
+    if( HAL_TIMEx_MasterConfigSynchronization( &htim2, &sMasterConfig ) != HAL_OK )
+    {
+        return HAL_ERROR;
+    }
+
+    adcSampleRateHz = timClkHz / ( htim2.Init.Period + 1 );
+
+    return HAL_OK;
 }
\ No newline at end of file
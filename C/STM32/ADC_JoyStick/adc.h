@@ -5,7 +5,7 @@
 # Created Date: Saturday, October 28th 2023, 11:24:44 pm                       #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Sunday, October 29th 2023, 12:50:54 pm                        #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -21,6 +21,7 @@
 /*##############################################################################################################################################*/
 
 #include "main.h"
+#include "joystick.h"
 
 /*##############################################################################################################################################*/
 /*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
@@ -31,9 +32,66 @@ typedef struct {
     int8_t y;
 } joyStickVal_t;
 
+/**
+ * @brief One Scan Sequence of the Joystick: Rank 1 ( X, ADC_CHANNEL_0 ) then Rank 2 ( Y, ADC_CHANNEL_1 ), 
+ * same layout as the conversions are written by the DMA
+ * 
+ */
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+} ADC_frame_t;
+
+/**
+ * @brief Acquisition Modes of ADC1
+ * 
+ */
+typedef enum {
+    ADC_ACQ_STOPPED = 0,
+    ADC_ACQ_CONTINUOUS,     /*Free running scan, rate set by the sampling time*/
+    ADC_ACQ_TIMED,          /*One scan per TIM2 TRGO, fixed rate*/
+    ADC_ACQ_WATCH           /*Slow TIM2 paced scans, Analog Watchdog only*/
+} ADC_acqMode_t;
+
+/**
+ * @brief States of the Wake-on-Movement Mode
+ * 
+ */
+typedef enum {
+    ADC_WAKE_OFF = 0,
+    ADC_WAKE_ARMED,         /*Watchdog armed, CPU may sleep*/
+    ADC_WAKE_TRIGGERED,     /*Stick left the deadzone, waiting for ADC_wakeProcess( )*/
+    ADC_WAKE_ACTIVE         /*Full rate sampling until the stick rests in the deadzone*/
+} ADC_wakeState_t;
+
+/**
+ * @brief Processing Stage of the Timed Acquisition: receives each completed block of Frames ( Interrupt Context )
+ * 
+ */
+typedef void ( *ADC_blockCB_t )( const ADC_frame_t *block, uint16_t frames );
+
 void ADC_Init( void );
+HAL_StatusTypeDef ADC_startContinuous( void );
+HAL_StatusTypeDef ADC_startTimed( uint32_t sampleRateHz, ADC_blockCB_t blockCB );
+void ADC_stopAcquisition( void );
+uint32_t ADC_getSampleRate( void );
+HAL_StatusTypeDef ADC_wakeArm( void );
+ADC_wakeState_t ADC_wakeProcess( void );
+void ADC_wakeSleep( void );
+void ADC_wakeDisarm( void );
+void ADC_IRQHandler( void );
+void HAL_ADC_MspInit( ADC_HandleTypeDef* hadc );
+void HAL_TIM_Base_MspInit( TIM_HandleTypeDef* htim );
+void DMA2_Stream0_IRQHandler( void );
+uint32_t ADC_getLatestFrame( ADC_frame_t *frame );
+uint32_t ADC_getFilteredFrame( ADC_frame_t *frame );
+void ADC_filterBenchmark( void );
 joyStickVal_t getXYJoyStickVal( void );
 joyStickVal_t convertADCtoXY( uint16_t adcValueX, uint16_t adcValueY );
+joyStickVal_t getXYJoyStickProportional( void );
+void ADC_joyCalCentre( void );
+void ADC_joyCalTrack( void );
+JOY_t *ADC_getJoystick( void );
 
 /*##############################################################################################################################################*/
 /*GLOBALS_______________________________________________________________________________________________________________________________________*/
@@ -48,11 +106,37 @@ joyStickVal_t convertADCtoXY( uint16_t adcValueX, uint16_t adcValueY );
 #define ADC_THRESHOLD_LOW 1000
 #define ADC_THRESHOLD_HIGH 3000
 
+/*Scan Sequence: X and Y Channels ranked 1 and 2*/
+#define ADC_JOY_CHANNELS        2
+#define ADC_JOY_SAMPLETIME      ADC_SAMPLETIME_480CYCLES
+
+/*Circular DMA Double Buffer: two halves of ADC_JOY_FRAMES_PER_HALF Frames, one DMA Interrupt per completed half. Free running 
+  ( PCLK2 / 8, 480 + 12 ADC cycles per conversion ) that is one interrupt every 2 x 492 x 16 = 15744 ADC cycles, PCLK2 / 125952: 
+  about 127 Hz on the 16 MHz HSI, 667 Hz at PCLK2 = 84 MHz*/
+#define ADC_JOY_FRAMES_PER_HALF 16
+#define ADC_JOY_DMA_FRAMES      ( 2 * ADC_JOY_FRAMES_PER_HALF )
+
+/*Timed Acquisition: TIM2 TRGO paced scans, shorter sampling time so a scan fits well inside the fastest period*/
+#define ADC_ACQ_RATE_MIN_HZ     10
+#define ADC_ACQ_RATE_MAX_HZ     10000
+#define ADC_ACQ_SAMPLETIME      ADC_SAMPLETIME_84CYCLES
+
+/*Joystick filter chain: a 3 sample Median removes single sample spikes, the EMA smooths the rest*/
+#define ADC_JOY_MEDIAN_LEN      3
+#define ADC_JOY_EMA_SHIFT       2
+#define ADC_FILT_BENCH_SAMPLES  256
+
+/*Wake-on-Movement: slow watch scans, back to watching after the stick rested this long*/
+#define ADC_WAKE_WATCH_RATE_HZ  20
+#define ADC_WAKE_IDLE_MS        500
+
 
 /*##############################################################################################################################################*/
 /*EXTERNS_______________________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
+extern ADC_HandleTypeDef hadc;
+extern TIM_HandleTypeDef htim2;
 
 
 /*##############################################################################################################################################*/
@@ -0,0 +1,332 @@
+/*
+# ##############################################################################
+# File: adc_filter.c                                                           #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 3:10:36 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 3:10:36 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "adc_filter.h"
+#include <string.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Decimating Oversampler-------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Initialize a Decimating Oversampler
+ * 
+ * @param osr Oversampler
+ * @param log2Ratio Input samples per output sample, as a power of 2 ( <= ADC_FILT_OSR_LOG2_MAX )
+ * @param extraBits Resolution gained ( <= log2Ratio / 2 for white noise, output must fit 16 bits )
+ * @return uint8_t TRUE if valid, FALSE otherwise
+ */
+uint8_t ADC_osrInit( ADC_osr_t *osr, uint8_t log2Ratio, uint8_t extraBits )
+{
+    if( ( log2Ratio > ADC_FILT_OSR_LOG2_MAX ) || ( extraBits > log2Ratio ) || ( extraBits > 4 ) )
+    {
+        return FALSE;
+    }
+
+    osr->acc        = 0;
+    osr->count      = 0;
+    osr->ratio      = ( uint16_t )( 1U << log2Ratio );
+    osr->outShift   = log2Ratio - extraBits;
+
+    return TRUE;
+}
+
+/**
+ * @brief Feed one sample to the Oversampler
+ * 
+ * @param osr Oversampler
+ * @param in Sample
+ * @param out Decimated Sample, written when ready
+ * @return uint8_t TRUE if an output sample is ready
+ */
+uint8_t ADC_osrUpdate( ADC_osr_t *osr, uint16_t in, uint16_t *out )
+{
+    osr->acc += in;
+
+    if( ++osr->count < osr->ratio )
+    {
+        return FALSE;
+    }
+
+    *out        = ( uint16_t )( osr->acc >> osr->outShift );
+    osr->acc    = 0;
+    osr->count  = 0;
+
+    return TRUE;
+}
+
+/**
+ * @brief Oversample a block of samples
+ * 
+ * @param osr Oversampler
+ * @param in First input sample
+ * @param stride Distance between input samples ( 2 for one axis of an interleaved X, Y block )
+ * @param count Number of input samples
+ * @param out Decimated Samples
+ * @return uint16_t Number of output samples written
+ */
+uint16_t ADC_osrBlock( ADC_osr_t *osr, const uint16_t *in, uint8_t stride, uint16_t count, uint16_t *out )
+{
+    uint16_t produced = 0;
+    uint16_t i;
+
+    for( i = 0; i < count; i++, in += stride )
+    {
+        produced += ADC_osrUpdate( osr, *in, &out[ produced ] );
+    }
+
+    return produced;
+}
+
+/*Moving Average---------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Initialize a Moving Average
+ * 
+ * @param ma Moving Average
+ * @param log2Len Window length as a power of 2 ( <= ADC_FILT_MA_LOG2_MAX )
+ * @return uint8_t TRUE if valid, FALSE otherwise
+ */
+uint8_t ADC_maInit( ADC_ma_t *ma, uint8_t log2Len )
+{
+    if( log2Len > ADC_FILT_MA_LOG2_MAX )
+    {
+        return FALSE;
+    }
+
+    memset( ma, 0, sizeof( *ma ) );
+    ma->log2Len = log2Len;
+
+    return TRUE;
+}
+
+/**
+ * @brief Feed one sample to the Moving Average. Until the window is full the average of the samples seen so far is returned.
+ * 
+ * @param ma Moving Average
+ * @param in Sample
+ * @return uint16_t Average
+ */
+uint16_t ADC_maUpdate( ADC_ma_t *ma, uint16_t in )
+{
+    uint8_t len = ( uint8_t )( 1U << ma->log2Len );
+
+    ma->sum += in;
+    ma->sum -= ma->hist[ ma->idx ];
+    ma->hist[ ma->idx ] = in;
+    ma->idx = ( ma->idx + 1 ) & ( len - 1 );
+
+    if( ma->filled < len )
+    {
+        ma->filled++;
+        return ( uint16_t )( ma->sum / ma->filled );
+    }
+
+    return ( uint16_t )( ma->sum >> ma->log2Len );
+}
+
+/**
+ * @brief Average a block of samples, one output per input
+ * 
+ * @return uint16_t Number of output samples written
+ */
+uint16_t ADC_maBlock( ADC_ma_t *ma, const uint16_t *in, uint8_t stride, uint16_t count, uint16_t *out )
+{
+    uint16_t i;
+
+    for( i = 0; i < count; i++, in += stride )
+    {
+        out[ i ] = ADC_maUpdate( ma, *in );
+    }
+
+    return count;
+}
+
+/*Median-----------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Initialize a Median Filter
+ * 
+ * @param med Median Filter
+ * @param len Odd window length ( <= ADC_FILT_MEDIAN_MAX )
+ * @return uint8_t TRUE if valid, FALSE otherwise
+ */
+uint8_t ADC_medianInit( ADC_median_t *med, uint8_t len )
+{
+    if( ( len == 0 ) || ( len > ADC_FILT_MEDIAN_MAX ) || ( ( len & 1 ) == 0 ) )
+    {
+        return FALSE;
+    }
+
+    memset( med, 0, sizeof( *med ) );
+    med->len = len;
+
+    return TRUE;
+}
+
+/**
+ * @brief Feed one sample to the Median Filter: the oldest sample leaves the sorted window, the new one is inserted in place
+ * 
+ * @param med Median Filter
+ * @param in Sample
+ * @return uint16_t Median of the window ( of the samples seen so far until the window is full )
+ */
+uint16_t ADC_medianUpdate( ADC_median_t *med, uint16_t in )
+{
+    uint8_t n = med->filled;
+    uint8_t i;
+
+    if( n == med->len )
+    {
+        /*Remove the oldest sample from the sorted window*/
+        for( i = 0; med->sorted[ i ] != med->hist[ med->idx ]; i++ );
+        for( ; i < ( n - 1 ); i++ )
+        {
+            med->sorted[ i ] = med->sorted[ i + 1 ];
+        }
+        n--;
+    }
+    else
+    {
+        med->filled++;
+    }
+
+    /*Insert the new sample*/
+    for( i = n; ( i > 0 ) && ( med->sorted[ i - 1 ] > in ); i-- )
+    {
+        med->sorted[ i ] = med->sorted[ i - 1 ];
+    }
+    med->sorted[ i ] = in;
+
+    med->hist[ med->idx ] = in;
+    med->idx = ( med->idx + 1 < med->len ) ? ( med->idx + 1 ) : 0;
+
+    return med->sorted[ med->filled >> 1 ];
+}
+
+/**
+ * @brief Median filter a block of samples, one output per input
+ * 
+ * @return uint16_t Number of output samples written
+ */
+uint16_t ADC_medianBlock( ADC_median_t *med, const uint16_t *in, uint8_t stride, uint16_t count, uint16_t *out )
+{
+    uint16_t i;
+
+    for( i = 0; i < count; i++, in += stride )
+    {
+        out[ i ] = ADC_medianUpdate( med, *in );
+    }
+
+    return count;
+}
+
+/*Exponential Moving Average---------------------------------------------------------------------------------*/
+
+/**
+ * @brief Initialize an Exponential Moving Average
+ * 
+ * @param ema EMA
+ * @param shift Smoothing, time constant of about 2^shift samples ( 1..ADC_FILT_EMA_SHIFT_MAX )
+ * @return uint8_t TRUE if valid, FALSE otherwise
+ */
+uint8_t ADC_emaInit( ADC_ema_t *ema, uint8_t shift )
+{
+    if( ( shift == 0 ) || ( shift > ADC_FILT_EMA_SHIFT_MAX ) )
+    {
+        return FALSE;
+    }
+
+    ema->acc    = 0;
+    ema->shift  = shift;
+    ema->primed = FALSE;
+
+    return TRUE;
+}
+
+/**
+ * @brief Feed one sample to the EMA. The first sample primes the state so there is no ramp up from 0.
+ * 
+ * @param ema EMA
+ * @param in Sample
+ * @return uint16_t Filtered Sample ( rounded )
+ */
+uint16_t ADC_emaUpdate( ADC_ema_t *ema, uint16_t in )
+{
+    if( !ema->primed )
+    {
+        ema->acc    = ( uint32_t )in << ema->shift;
+        ema->primed = TRUE;
+    }
+    else
+    {
+        ema->acc = ema->acc - ( ema->acc >> ema->shift ) + in;
+    }
+
+    return ( uint16_t )( ( ema->acc + ( 1UL << ( ema->shift - 1 ) ) ) >> ema->shift );
+}
+
+/**
+ * @brief EMA filter a block of samples, one output per input
+ * 
+ * @return uint16_t Number of output samples written
+ */
+uint16_t ADC_emaBlock( ADC_ema_t *ema, const uint16_t *in, uint8_t stride, uint16_t count, uint16_t *out )
+{
+    uint16_t i;
+
+    for( i = 0; i < count; i++, in += stride )
+    {
+        out[ i ] = ADC_emaUpdate( ema, *in );
+    }
+
+    return count;
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+/*
+# ##############################################################################
+# File: adc_filter.h                                                           #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 3:10:36 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 3:10:36 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_ADC_FILTER_H
+#define INC_ADC_FILTER_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include <stdint.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+/*Largest supported windows*/
+#define ADC_FILT_MA_LOG2_MAX    5       /*Moving Average: up to 32 samples*/
+#define ADC_FILT_MA_MAX         ( 1U << ADC_FILT_MA_LOG2_MAX )
+#define ADC_FILT_MEDIAN_MAX     7       /*Median: odd window up to 7 samples*/
+#define ADC_FILT_OSR_LOG2_MAX   8       /*Oversampler: up to 256 samples per output*/
+#define ADC_FILT_EMA_SHIFT_MAX  15
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Decimating Oversampler: sums 2^log2Ratio samples and outputs one sample with extraBits more resolution
+ * 
+ */
+typedef struct
+{
+    uint32_t    acc;
+    uint16_t    count;
+    uint16_t    ratio;
+    uint8_t     outShift;
+} ADC_osr_t;
+
+/**
+ * @brief Moving Average over 2^log2Len samples, running sum so the cost does not depend on the window
+ * 
+ */
+typedef struct
+{
+    uint32_t    sum;
+    uint16_t    hist[ ADC_FILT_MA_MAX ];
+    uint8_t     idx;
+    uint8_t     log2Len;
+    uint8_t     filled;
+} ADC_ma_t;
+
+/**
+ * @brief Median over an odd window, the sorted window is kept up to date ( one remove and one insert per sample )
+ * 
+ */
+typedef struct
+{
+    uint16_t    hist[ ADC_FILT_MEDIAN_MAX ];    /*Samples in arrival order*/
+    uint16_t    sorted[ ADC_FILT_MEDIAN_MAX ];  /*Same samples, ascending*/
+    uint8_t     idx;
+    uint8_t     len;
+    uint8_t     filled;
+} ADC_median_t;
+
+/**
+ * @brief Exponential Moving Average, y += ( x - y ) / 2^shift, state kept with shift fractional bits
+ * 
+ */
+typedef struct
+{
+    uint32_t    acc;
+    uint8_t     shift;
+    uint8_t     primed;
+} ADC_ema_t;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+uint8_t ADC_osrInit( ADC_osr_t *osr, uint8_t log2Ratio, uint8_t extraBits );
+uint8_t ADC_osrUpdate( ADC_osr_t *osr, uint16_t in, uint16_t *out );
+uint16_t ADC_osrBlock( ADC_osr_t *osr, const uint16_t *in, uint8_t stride, uint16_t count, uint16_t *out );
+
+uint8_t ADC_maInit( ADC_ma_t *ma, uint8_t log2Len );
+uint16_t ADC_maUpdate( ADC_ma_t *ma, uint16_t in );
+uint16_t ADC_maBlock( ADC_ma_t *ma, const uint16_t *in, uint8_t stride, uint16_t count, uint16_t *out );
+
+uint8_t ADC_medianInit( ADC_median_t *med, uint8_t len );
+uint16_t ADC_medianUpdate( ADC_median_t *med, uint16_t in );
+uint16_t ADC_medianBlock( ADC_median_t *med, const uint16_t *in, uint8_t stride, uint16_t count, uint16_t *out );
+
+uint8_t ADC_emaInit( ADC_ema_t *ema, uint8_t shift );
+uint16_t ADC_emaUpdate( ADC_ema_t *ema, uint16_t in );
+uint16_t ADC_emaBlock( ADC_ema_t *ema, const uint16_t *in, uint8_t stride, uint16_t count, uint16_t *out );
+
+#endif
\ No newline at end of file
@@ -0,0 +1,360 @@
+/*
+# ##############################################################################
+# File: joystick.c                                                             #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 4:05:52 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "joystick.h"
+#include <stddef.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static void     JOY_calUpdateScales( JOY_axisCal_t *cal );
+static uint8_t  JOY_applyCurve( const uint8_t *curve, uint16_t mag );
+static uint16_t JOY_isqrt( uint32_t value );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Response Curve Generators, x in 0..JOY_CURVE_STEPS, rounded to 0..JOY_OUT_MAX*/
+#define JOY_LINEAR( x )     ( ( JOY_OUT_MAX * ( x ) + ( JOY_CURVE_STEPS / 2 ) ) / JOY_CURVE_STEPS )
+#define JOY_QUADRATIC( x )  ( ( JOY_OUT_MAX * ( x ) * ( x ) + ( ( JOY_CURVE_STEPS * JOY_CURVE_STEPS ) / 2 ) ) / ( JOY_CURVE_STEPS * JOY_CURVE_STEPS ) )
+#define JOY_CUBIC( x )      ( ( JOY_OUT_MAX * ( x ) * ( x ) * ( x ) + ( ( JOY_CURVE_STEPS * JOY_CURVE_STEPS * JOY_CURVE_STEPS ) / 2 ) ) / ( JOY_CURVE_STEPS * JOY_CURVE_STEPS * JOY_CURVE_STEPS ) )
+
+/*Q16 scale mapping span onto full, rounded up so that the end of the span lands exactly on full ( callers clamp )*/
+#define JOY_Q16_SCALE( full, span )     ( ( ( ( uint32_t )( full ) << 16 ) + ( uint32_t )( span ) - 1U ) / ( uint32_t )( span ) )
+
+/*Table Expansion: JOY_CURVE_STEPS + 1 entries, evaluated by the compiler*/
+#define JOY_ROW8( F, x )    F( x ), F( x + 1 ), F( x + 2 ), F( x + 3 ), F( x + 4 ), F( x + 5 ), F( x + 6 ), F( x + 7 )
+#define JOY_TABLE( F )      { JOY_ROW8( F, 0 ), JOY_ROW8( F, 8 ), JOY_ROW8( F, 16 ), JOY_ROW8( F, 24 ), \
+                              JOY_ROW8( F, 32 ), JOY_ROW8( F, 40 ), JOY_ROW8( F, 48 ), JOY_ROW8( F, 56 ), F( 64 ) }
+
+#if JOY_CURVE_STEPS != 64
+#error "JOY_TABLE expands 64 steps, update it together with JOY_CURVE_STEPS_SHIFT"
+#endif
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Response Curves, kept in Flash*/
+static const uint8_t joyCurveLinear[ JOY_CURVE_STEPS + 1 ]      = JOY_TABLE( JOY_LINEAR );
+static const uint8_t joyCurveQuadratic[ JOY_CURVE_STEPS + 1 ]   = JOY_TABLE( JOY_QUADRATIC );
+static const uint8_t joyCurveCubic[ JOY_CURVE_STEPS + 1 ]       = JOY_TABLE( JOY_CUBIC );
+
+static const uint8_t * const joyCurves[ JOY_CURVE_COUNT ] = { joyCurveLinear, joyCurveQuadratic, joyCurveCubic };
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Initialize a Joystick Conversion Stage with the default calibration ( full 12 bit range, centred, Y inverted ), 
+ * default deadzone and the linear curve
+ * 
+ * @param joy Joystick
+ */
+void JOY_init( JOY_t *joy )
+{
+    JOY_calSetAxis( joy, 0, 0, JOY_CAL_CENTRE_DEFAULT, JOY_RAW_MAX, FALSE );
+    JOY_calSetAxis( joy, 1, 0, JOY_CAL_CENTRE_DEFAULT, JOY_RAW_MAX, TRUE );
+    JOY_setDeadzone( joy, JOY_DEADZONE_DEFAULT, JOY_HYSTERESIS_DEFAULT );
+    JOY_setCurve( joy, JOY_CURVE_LINEAR );
+    joy->inDeadzone = TRUE;
+}
+
+/**
+ * @brief Capture the resting position as the centre of both axes ( stick released ). The end stops are reset to the centre, 
+ * sweep the stick with JOY_calExtend( ) afterwards.
+ * 
+ * @param joy Joystick
+ * @param rawX Raw X reading at rest
+ * @param rawY Raw Y reading at rest
+ */
+void JOY_calSetCentre( JOY_t *joy, uint16_t rawX, uint16_t rawY )
+{
+    joy->axis[ 0 ].centre = joy->axis[ 0 ].min = joy->axis[ 0 ].max = rawX;
+    joy->axis[ 1 ].centre = joy->axis[ 1 ].min = joy->axis[ 1 ].max = rawY;
+
+    JOY_calUpdateScales( &joy->axis[ 0 ] );
+    JOY_calUpdateScales( &joy->axis[ 1 ] );
+}
+
+/**
+ * @brief Widen the end stops with a reading taken while the stick is swept around its full range
+ * 
+ * @param joy Joystick
+ * @param rawX Raw X reading
+ * @param rawY Raw Y reading
+ */
+void JOY_calExtend( JOY_t *joy, uint16_t rawX, uint16_t rawY )
+{
+    uint16_t raw[ 2 ] = { rawX, rawY };
+    JOY_axisCal_t *cal;
+    uint8_t axis;
+
+    for( axis = 0; axis < 2; axis++ )
+    {
+        cal = &joy->axis[ axis ];
+
+        if( ( raw[ axis ] < cal->min ) || ( raw[ axis ] > cal->max ) )
+        {
+            cal->min = ( raw[ axis ] < cal->min ) ? raw[ axis ] : cal->min;
+            cal->max = ( raw[ axis ] > cal->max ) ? raw[ axis ] : cal->max;
+            JOY_calUpdateScales( cal );
+        }
+    }
+}
+
+/**
+ * @brief Set the calibration of one axis directly, e.g. restored from storage
+ * 
+ * @param joy Joystick
+ * @param axis 0 for X, 1 for Y
+ * @param min Raw reading at the negative end stop
+ * @param centre Raw reading at rest
+ * @param max Raw reading at the positive end stop
+ * @param invert TRUE if a low reading means a positive deflection
+ */
+void JOY_calSetAxis( JOY_t *joy, uint8_t axis, uint16_t min, uint16_t centre, uint16_t max, uint8_t invert )
+{
+    JOY_axisCal_t *cal = &joy->axis[ axis & 1 ];
+
+    cal->min    = min;
+    cal->centre = centre;
+    cal->max    = max;
+    cal->invert = invert;
+
+    JOY_calUpdateScales( cal );
+}
+
+/**
+ * @brief Configure the radial deadzone. The stick is centred once it falls below deadzone and 
+ * leaves the centre once it exceeds deadzone + hysteresis, so it does not chatter on the edge.
+ * 
+ * @param joy Joystick
+ * @param deadzone Radius in normalized units ( <= JOY_DEADZONE_MAX )
+ * @param hysteresis Extra radius to leave the deadzone
+ * @return uint8_t TRUE if valid, FALSE otherwise
+ */
+uint8_t JOY_setDeadzone( JOY_t *joy, uint16_t deadzone, uint16_t hysteresis )
+{
+    uint32_t exitRadius = ( uint32_t )deadzone + hysteresis;
+
+    if( ( deadzone > JOY_DEADZONE_MAX ) || ( exitRadius >= JOY_NORM_MAX ) )
+    {
+        return FALSE;
+    }
+
+    joy->deadzone   = deadzone;
+    joy->hysteresis = hysteresis;
+    joy->enterSq    = ( uint32_t )deadzone * deadzone;
+    joy->exitSq     = exitRadius * exitRadius;
+    joy->dzScale    = JOY_Q16_SCALE( JOY_NORM_MAX, JOY_NORM_MAX - deadzone );
+
+    return TRUE;
+}
+
+/**
+ * @brief Select the Response Curve
+ * 
+ * @param joy Joystick
+ * @param curve Curve
+ * @return uint8_t TRUE if valid, FALSE otherwise
+ */
+uint8_t JOY_setCurve( JOY_t *joy, JOY_curve_t curve )
+{
+    if( curve >= JOY_CURVE_COUNT )
+    {
+        return FALSE;
+    }
+
+    joy->curve = joyCurves[ curve ];
+
+    return TRUE;
+}
+
+/**
+ * @brief Normalize a raw reading against the axis calibration
+ * 
+ * @param cal Axis Calibration
+ * @param raw Raw reading
+ * @return int16_t Deflection, -JOY_NORM_MAX..JOY_NORM_MAX ( clamped beyond the end stops, sign after inversion )
+ */
+int16_t JOY_normalize( const JOY_axisCal_t *cal, uint16_t raw )
+{
+    uint32_t mag;
+    int16_t value;
+
+    if( raw >= cal->centre )
+    {
+        mag     = ( ( uint32_t )( raw - cal->centre ) * cal->scalePos ) >> 16;
+        mag     = ( mag > JOY_NORM_MAX ) ? JOY_NORM_MAX : mag;
+        value   = ( int16_t )mag;
+    }
+    else
+    {
+        mag     = ( ( uint32_t )( cal->centre - raw ) * cal->scaleNeg ) >> 16;
+        mag     = ( mag > JOY_NORM_MAX ) ? JOY_NORM_MAX : mag;
+        value   = -( int16_t )mag;
+    }
+
+    return ( cal->invert ) ? -value : value;
+}
+
+/**
+ * @brief Convert a raw X, Y reading to a signed proportional output
+ * 
+ * @param joy Joystick
+ * @param rawX Raw X reading
+ * @param rawY Raw Y reading
+ * @param x Proportional X, -JOY_OUT_MAX..JOY_OUT_MAX
+ * @param y Proportional Y, -JOY_OUT_MAX..JOY_OUT_MAX
+ */
+void JOY_convert( JOY_t *joy, uint16_t rawX, uint16_t rawY, int8_t *x, int8_t *y )
+{
+    int16_t n[ 2 ];
+    int8_t *out[ 2 ] = { x, y };
+    uint32_t magSq, mag, radial, comp;
+    uint8_t axis, level;
+
+    n[ 0 ] = JOY_normalize( &joy->axis[ 0 ], rawX );
+    n[ 1 ] = JOY_normalize( &joy->axis[ 1 ], rawY );
+
+    /*Radial Deadzone with Hysteresis*/
+    magSq = ( uint32_t )( ( int32_t )n[ 0 ] * n[ 0 ] ) + ( uint32_t )( ( int32_t )n[ 1 ] * n[ 1 ] );
+    if( joy->inDeadzone )
+    {
+        joy->inDeadzone = ( magSq <= joy->exitSq );
+    }
+    else
+    {
+        joy->inDeadzone = ( magSq < joy->enterSq );
+    }
+
+    mag = JOY_isqrt( magSq );
+    if( joy->inDeadzone || ( mag == 0 ) )
+    {
+        *x = 0;
+        *y = 0;
+        return;
+    }
+
+    /*Remove the deadzone along the deflection so the output ramps up from 0 at its edge in every direction, shape the 
+      radius with the curve, then share it between the axes in the proportions of the deflection*/
+    radial  = ( mag > joy->deadzone ) ? ( ( ( mag - joy->deadzone ) * joy->dzScale ) >> 16 ) : 0;
+    radial  = ( radial > JOY_NORM_MAX ) ? JOY_NORM_MAX : radial;
+    level   = JOY_applyCurve( joy->curve, ( uint16_t )radial );
+
+    for( axis = 0; axis < 2; axis++ )
+    {
+        /*|n| <= mag, so the share never exceeds the level*/
+        comp = ( n[ axis ] < 0 ) ? ( uint32_t )( -n[ axis ] ) : ( uint32_t )n[ axis ];
+        comp = ( comp * level + ( mag >> 1 ) ) / mag;
+
+        *out[ axis ] = ( n[ axis ] < 0 ) ? -( int8_t )comp : ( int8_t )comp;
+    }
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Recompute the Q16 normalization scales of an axis after its calibration changed
+ * 
+ */
+static void JOY_calUpdateScales( JOY_axisCal_t *cal )
+{
+    uint32_t spanNeg = ( cal->centre > cal->min ) ? ( uint32_t )( cal->centre - cal->min ) : 0;
+    uint32_t spanPos = ( cal->max > cal->centre ) ? ( uint32_t )( cal->max - cal->centre ) : 0;
+
+    spanNeg = ( spanNeg < JOY_CAL_MIN_SPAN ) ? JOY_CAL_MIN_SPAN : spanNeg;
+    spanPos = ( spanPos < JOY_CAL_MIN_SPAN ) ? JOY_CAL_MIN_SPAN : spanPos;
+
+    cal->scaleNeg = JOY_Q16_SCALE( JOY_NORM_MAX, spanNeg );
+    cal->scalePos = JOY_Q16_SCALE( JOY_NORM_MAX, spanPos );
+}
+
+/**
+ * @brief Look up a normalized magnitude in a Response Curve, interpolating between the table steps. 
+ * The curves are non-decreasing, so the step between two entries is never negative.
+ * 
+ * @param curve Response Curve Table
+ * @param mag Magnitude, 0..JOY_NORM_MAX
+ * @return uint8_t Output, 0..JOY_OUT_MAX
+ */
+static uint8_t JOY_applyCurve( const uint8_t *curve, uint16_t mag )
+{
+    uint32_t idx = ( uint32_t )mag >> JOY_CURVE_FRAC_SHIFT;
+    uint32_t frac = mag & ( ( 1U << JOY_CURVE_FRAC_SHIFT ) - 1U );
+    uint32_t step;
+
+    if( idx >= JOY_CURVE_STEPS )
+    {
+        return curve[ JOY_CURVE_STEPS ];
+    }
+
+    step = ( uint32_t )curve[ idx + 1 ] - curve[ idx ];
+
+    return ( uint8_t )( curve[ idx ] + ( ( step * frac + ( 1U << ( JOY_CURVE_FRAC_SHIFT - 1 ) ) ) >> JOY_CURVE_FRAC_SHIFT ) );
+}
+
+/**
+ * @brief Integer square root, rounded down. Bit by bit, no division.
+ * 
+ * @param value Radicand
+ * @return uint16_t floor( sqrt( value ) )
+ */
+static uint16_t JOY_isqrt( uint32_t value )
+{
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while( bit > value )
+    {
+        bit >>= 2;
+    }
+
+    while( bit != 0 )
+    {
+        if( value >= root + bit )
+        {
+            value  -= root + bit;
+            root    = ( root >> 1 ) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return ( uint16_t )root;
+}
\ No newline at end of file
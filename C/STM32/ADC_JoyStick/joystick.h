@@ -0,0 +1,135 @@
+/*
+# ##############################################################################
+# File: joystick.h                                                             #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 4:05:52 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 4:05:52 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_JOYSTICK_H
+#define INC_JOYSTICK_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include <stdint.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+/*Normalized deflection: 0 at the centre, JOY_NORM_MAX at the calibrated end stop*/
+#define JOY_NORM_SHIFT          10
+#define JOY_NORM_MAX            ( 1 << JOY_NORM_SHIFT )
+
+/*Proportional Output range*/
+#define JOY_OUT_MAX             127
+
+/*Default calibration of a 12 bit axis, and the smallest accepted span between centre and end stop*/
+#define JOY_RAW_MAX             4095
+#define JOY_CAL_CENTRE_DEFAULT  2048
+#define JOY_CAL_MIN_SPAN        256
+
+/*Radial Deadzone and Hysteresis in normalized units ( 1024 = full deflection )*/
+#define JOY_DEADZONE_DEFAULT    100
+#define JOY_HYSTERESIS_DEFAULT  30
+#define JOY_DEADZONE_MAX        512
+
+/*Response Curve Tables: JOY_CURVE_STEPS + 1 entries over 0..JOY_NORM_MAX, linear interpolation in between*/
+#define JOY_CURVE_STEPS_SHIFT   6
+#define JOY_CURVE_STEPS         ( 1 << JOY_CURVE_STEPS_SHIFT )
+#define JOY_CURVE_FRAC_SHIFT    ( JOY_NORM_SHIFT - JOY_CURVE_STEPS_SHIFT )
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Response Curves, each a table generated at compile time
+ * 
+ */
+typedef enum
+{
+    JOY_CURVE_LINEAR = 0,
+    JOY_CURVE_QUADRATIC,    /*Fine control around the centre*/
+    JOY_CURVE_CUBIC,        /*Finer still*/
+    JOY_CURVE_COUNT
+} JOY_curve_t;
+
+/**
+ * @brief Calibration of one axis. The scales are derived from min / centre / max so that normalizing costs a multiply and a shift.
+ * 
+ */
+typedef struct
+{
+    uint16_t    min;
+    uint16_t    centre;
+    uint16_t    max;
+    uint8_t     invert;     /*TRUE if a low reading means a positive deflection*/
+    uint32_t    scaleNeg;   /*Q16, centre - min -> JOY_NORM_MAX*/
+    uint32_t    scalePos;   /*Q16, max - centre -> JOY_NORM_MAX*/
+} JOY_axisCal_t;
+
+/**
+ * @brief Joystick Conversion Stage: calibration, radial deadzone with hysteresis, response curve
+ * 
+ */
+typedef struct
+{
+    JOY_axisCal_t   axis[ 2 ];      /*X, Y*/
+    uint16_t        deadzone;       /*Radius the stick must fall below to be centred*/
+    uint16_t        hysteresis;     /*Extra radius it must exceed to leave the centre again*/
+    uint32_t        enterSq;        /*deadzone^2*/
+    uint32_t        exitSq;         /*( deadzone + hysteresis )^2*/
+    uint32_t        dzScale;        /*Q16, JOY_NORM_MAX - deadzone -> JOY_NORM_MAX*/
+    const uint8_t   *curve;
+    uint8_t         inDeadzone;
+} JOY_t;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+void JOY_init( JOY_t *joy );
+void JOY_calSetCentre( JOY_t *joy, uint16_t rawX, uint16_t rawY );
+void JOY_calExtend( JOY_t *joy, uint16_t rawX, uint16_t rawY );
+void JOY_calSetAxis( JOY_t *joy, uint8_t axis, uint16_t min, uint16_t centre, uint16_t max, uint8_t invert );
+uint8_t JOY_setDeadzone( JOY_t *joy, uint16_t deadzone, uint16_t hysteresis );
+uint8_t JOY_setCurve( JOY_t *joy, JOY_curve_t curve );
+int16_t JOY_normalize( const JOY_axisCal_t *cal, uint16_t raw );
+void JOY_convert( JOY_t *joy, uint16_t rawX, uint16_t rawY, int8_t *x, int8_t *y );
+
+#endif
\ No newline at end of file
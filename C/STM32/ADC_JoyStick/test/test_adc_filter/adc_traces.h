@@ -0,0 +1,183 @@
+/*
+# ##############################################################################
+# File: adc_traces.h                                                           #
+# Project: test                                                                #
+# Created Date: Sunday, October 18th 2026, 11:36:20 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:36:20 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef TEST_ADC_TRACES_H
+#define TEST_ADC_TRACES_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include <stdint.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*
+ * Joystick ADC traces for the filter tests, TRACE_FRAMES interleaved X, Y frames each. They are synthesized from the 
+ * rest / deflection / sweep patterns of the target ( 12 bit ) with a seeded noise model of about 6 LSB rms, so the 
+ * fixtures stay reproducible.
+ */
+
+/*Stick at rest: noise of a few LSB on both axes, single sample glitches at frames 37 ( X ), 121 ( Y ) and 200 ( X )*/
+static const uint16_t traceRest[ ] =
+{
+    2049, 2036, 2045, 2028, 2053, 2027, 2048, 2032, 2056, 2027, 2050, 2021, 2047, 2027, 2054, 2026,
+    2045, 2022, 2048, 2023, 2058, 2034, 2042, 2027, 2047, 2031, 2055, 2036, 2039, 2030, 2048, 2033,
+    2046, 2035, 2045, 2027, 2052, 2026, 2041, 2042, 2044, 2021, 2051, 2034, 2044, 2030, 2037, 2027,
+    2043, 2035, 2048, 2027, 2054, 2032, 2061, 2036, 2052, 2033, 2042, 2027, 2045, 2029, 2045, 2030,
+    2056, 2018, 2044, 2028, 2043, 2029, 2045, 2031, 2053, 2035, 2681, 2038, 2055, 2040, 2049, 2024,
+    2050, 2031, 2037, 2030, 2046, 2027, 2047, 2031, 2044, 2041, 2043, 2035, 2056, 2025, 2045, 2028,
+    2049, 2024, 2038, 2036, 2051, 2036, 2041, 2028, 2038, 2030, 2046, 2028, 2042, 2043, 2045, 2033,
+    2037, 2036, 2050, 2034, 2048, 2037, 2051, 2034, 2045, 2032, 2039, 2033, 2041, 2029, 2048, 2025,
+    2058, 2033, 2044, 2027, 2047, 2020, 2043, 2030, 2039, 2030, 2052, 2041, 2046, 2036, 2056, 2035,
+    2052, 2030, 2047, 2032, 2039, 2024, 2055, 2028, 2053, 2033, 2048, 2026, 2054, 2028, 2053, 2025,
+    2051, 2031, 2041, 2029, 2037, 2035, 2050, 2030, 2045, 2022, 2040, 2030, 2049, 2025, 2039, 2032,
+    2060, 2032, 2056, 2027, 2049, 2033, 2041, 2033, 2044, 2034, 2054, 2029, 2047, 2026, 2047, 2031,
+    2048, 2038, 2040, 2037, 2044, 2039, 2055, 2035, 2054, 2044, 2049, 2029, 2039, 2038, 2044, 2034,
+    2054, 2027, 2049, 2040, 2046, 2034, 2049, 2033, 2042, 2030, 2050, 2035, 2040, 2039, 2045, 2023,
+    2052, 2030, 2043, 2031, 2046, 2040, 2053, 2022, 2047, 2026, 2046, 2047, 2040, 2024, 2050, 2025,
+    2046, 2033, 2046, 1453, 2046, 2030, 2053, 2033, 2059, 2022, 2046, 2040, 2047, 2039, 2054, 2029,
+    2055, 2040, 2055, 2028, 2048, 2024, 2047, 2033, 2048, 2032, 2047, 2034, 2045, 2027, 2047, 2022,
+    2031, 2027, 2045, 2030, 2044, 2030, 2051, 2031, 2049, 2025, 2041, 2028, 2056, 2039, 2041, 2034,
+    2052, 2023, 2043, 2021, 2050, 2036, 2037, 2029, 2057, 2024, 2050, 2021, 2037, 2033, 2051, 2036,
+    2054, 2034, 2045, 2027, 2052, 2046, 2045, 2048, 2056, 2021, 2063, 2039, 2039, 2032, 2055, 2038,
+    2052, 2033, 2047, 2038, 2049, 2034, 2047, 2044, 2041, 2034, 2049, 2031, 2049, 2030, 2050, 2035,
+    2046, 2034, 2050, 2032, 2039, 2029, 2045, 2035, 2051, 2028, 2040, 2026, 2042, 2031, 2057, 2023,
+    2051, 2028, 2053, 2035, 2048, 2033, 2062, 2040, 2053, 2028, 2033, 2034, 2048, 2027, 2039, 2022,
+    2048, 2038, 2042, 2030, 2052, 2032, 2043, 2040, 2051, 2038, 2050, 2015, 2043, 2033, 2045, 2031,
+    2054, 2033, 2055, 2024, 2045, 2032, 2047, 2035, 2047, 2033, 2059, 2026, 2054, 2033, 2059, 2036,
+    2770, 2031, 2051, 2032, 2043, 2030, 2050, 2032, 2037, 2039, 2043, 2030, 2046, 2050, 2045, 2033,
+    2052, 2017, 2051, 2025, 2049, 2027, 2048, 2023, 2050, 2034, 2051, 2029, 2048, 2021, 2031, 2030,
+    2056, 2032, 2044, 2034, 2053, 2024, 2056, 2025, 2043, 2023, 2041, 2033, 2044, 2032, 2044, 2039,
+    2050, 2041, 2048, 2033, 2052, 2034, 2052, 2038, 2048, 2037, 2047, 2036, 2056, 2031, 2053, 2031,
+    2050, 2035, 2053, 2037, 2050, 2026, 2035, 2035, 2041, 2037, 2056, 2030, 2050, 2041, 2056, 2027,
+    2052, 2037, 2049, 2043, 2049, 2040, 2060, 2014, 2040, 2028, 2042, 2029, 2044, 2033, 2058, 2045,
+    2048, 2023, 2050, 2033, 2048, 2037, 2040, 2021, 2046, 2035, 2043, 2029, 2051, 2047, 2042, 2022
+};
+
+/*X deflected to the end stop at frame 64 and released at frame 192, Y at rest*/
+static const uint16_t traceStep[ ] =
+{
+    2055, 2035, 2060, 2034, 2056, 2032, 2037, 2021, 2051, 2032, 2055, 2034, 2049, 2032, 2055, 2037,
+    2045, 2037, 2053, 2035, 2047, 2033, 2039, 2026, 2059, 2027, 2045, 2031, 2051, 2032, 2060, 2036,
+    2037, 2028, 2047, 2029, 2048, 2042, 2054, 2040, 2048, 2030, 2047, 2025, 2051, 2034, 2045, 2041,
+    2046, 2031, 2041, 2030, 2048, 2036, 2047, 2035, 2055, 2036, 2046, 2031, 2046, 2038, 2052, 2031,
+    2049, 2034, 2056, 2031, 2042, 2026, 2039, 2024, 2047, 2030, 2043, 2026, 2044, 2028, 2049, 2023,
+    2041, 2025, 2057, 2023, 2058, 2038, 2055, 2044, 2034, 2038, 2045, 2028, 2047, 2030, 2045, 2034,
+    2046, 2032, 2052, 2020, 2052, 2034, 2037, 2032, 2048, 2029, 2051, 2027, 2037, 2020, 2049, 2035,
+    2057, 2033, 2039, 2034, 2053, 2025, 2050, 2026, 2050, 2023, 2052, 2043, 2059, 2031, 2051, 2034,
+    3975, 2029, 3976, 2027, 3984, 2028, 3980, 2027, 3977, 2027, 3990, 2037, 3983, 2029, 3978, 2021,
+    3973, 2029, 3977, 2037, 3976, 2037, 3979, 2031, 3979, 2034, 3981, 2027, 3981, 2039, 3984, 2033,
+    3985, 2024, 3990, 2033, 3970, 2038, 3997, 2029, 3976, 2012, 3979, 2029, 3982, 2042, 3987, 2024,
+    3984, 2035, 3970, 2033, 3978, 2039, 3986, 2027, 3972, 2027, 3981, 2035, 3973, 2034, 3973, 2035,
+    3989, 2035, 3983, 2032, 3963, 2026, 3976, 2035, 3977, 2037, 3992, 2032, 3974, 2021, 3984, 2037,
+    3986, 2023, 3980, 2034, 3986, 2032, 3971, 2028, 3982, 2025, 3974, 2030, 3974, 2030, 3991, 2048,
+    3984, 2040, 3981, 2034, 3981, 2031, 3971, 2040, 3990, 2028, 3968, 2038, 3977, 2032, 3982, 2032,
+    3977, 2024, 3978, 2028, 3979, 2030, 3973, 2032, 3985, 2036, 3979, 2034, 3990, 2035, 3986, 2026,
+    3987, 2032, 3981, 2020, 3981, 2027, 3979, 2034, 3971, 2023, 3972, 2034, 3977, 2017, 3980, 2030,
+    3980, 2030, 3977, 2029, 3990, 2031, 3993, 2030, 3981, 2027, 3977, 2030, 3979, 2040, 3983, 2030,
+    3981, 2038, 3979, 2026, 3981, 2028, 3968, 2028, 3966, 2030, 3984, 2032, 3982, 2023, 3980, 2017,
+    3982, 2025, 3979, 2024, 3979, 2032, 3984, 2036, 3981, 2027, 3984, 2027, 3978, 2034, 3978, 2032,
+    3986, 2035, 3988, 2026, 3988, 2027, 3984, 2036, 3980, 2028, 3980, 2050, 3984, 2034, 3989, 2030,
+    3979, 2037, 3983, 2022, 3975, 2028, 3983, 2035, 3991, 2024, 3981, 2037, 3969, 2029, 3993, 2028,
+    3985, 2023, 3984, 2024, 3981, 2043, 3985, 2034, 3981, 2036, 3971, 2031, 3977, 2034, 3981, 2027,
+    3971, 2033, 3971, 2031, 3980, 2025, 3981, 2019, 3976, 2029, 3972, 2021, 3989, 2033, 3986, 2030,
+    2048, 2030, 2047, 2028, 2053, 2038, 2051, 2034, 2038, 2030, 2046, 2033, 2055, 2021, 2044, 2023,
+    2055, 2032, 2044, 2025, 2049, 2034, 2048, 2030, 2046, 2030, 2054, 2025, 2044, 2031, 2044, 2040,
+    2058, 2027, 2045, 2028, 2046, 2032, 2042, 2037, 2045, 2033, 2040, 2023, 2050, 2027, 2051, 2022,
+    2047, 2029, 2048, 2018, 2049, 2025, 2062, 2030, 2056, 2033, 2052, 2030, 2045, 2036, 2050, 2031,
+    2049, 2023, 2055, 2024, 2046, 2036, 2049, 2031, 2052, 2032, 2046, 2031, 2047, 2031, 2053, 2015,
+    2056, 2025, 2057, 2038, 2042, 2028, 2057, 2041, 2043, 2031, 2051, 2031, 2068, 2036, 2046, 2027,
+    2045, 2041, 2049, 2021, 2049, 2026, 2048, 2040, 2056, 2033, 2043, 2036, 2033, 2023, 2049, 2032,
+    2052, 2032, 2036, 2025, 2053, 2024, 2045, 2029, 2061, 2036, 2050, 2023, 2050, 2023, 2058, 2041
+};
+
+/*Slow sweep: X from 0 to full scale, Y from full scale to 0*/
+static const uint16_t traceSweep[ ] =
+{
+       0, 4095,   15, 4078,   30, 4063,   41, 4046,   64, 4033,   82, 4013,   96, 3994,  109, 3979,
+     130, 3964,  145, 3950,  159, 3929,  178, 3920,  190, 3897,  206, 3883,  232, 3879,  234, 3863,
+     264, 3838,  277, 3822,  288, 3808,  309, 3795,  323, 3780,  345, 3748,  354, 3744,  368, 3732,
+     384, 3711,  395, 3691,  422, 3683,  433, 3664,  460, 3648,  468, 3635,  481, 3614,  497, 3594,
+     513, 3584,  533, 3564,  549, 3545,  558, 3530,  580, 3512,  591, 3503,  606, 3482,  632, 3471,
+     641, 3447,  661, 3434,  675, 3427,  690, 3411,  707, 3389,  729, 3372,  736, 3360,  756, 3338,
+     771, 3325,  780, 3308,  804, 3291,  817, 3274,  835, 3260,  849, 3252,  870, 3227,  887, 3203,
+     903, 3195,  913, 3177,  932, 3160,  948, 3147,  967, 3131,  978, 3114,  996, 3098, 1004, 3081,
+    1031, 3069, 1045, 3051, 1055, 3041, 1073, 3020, 1098, 3001, 1112, 2985, 1126, 2973, 1137, 2952,
+    1157, 2939, 1168, 2920, 1196, 2909, 1207, 2892, 1220, 2873, 1238, 2852, 1253, 2837, 1264, 2828,
+    1286, 2810, 1301, 2796, 1317, 2782, 1334, 2759, 1346, 2744, 1364, 2725, 1376, 2711, 1396, 2696,
+    1414, 2684, 1432, 2664, 1449, 2648, 1458, 2628, 1486, 2618, 1499, 2595, 1515, 2579, 1516, 2569,
+    1541, 2564, 1561, 2543, 1582, 2515, 1589, 2507, 1601, 2487, 1620, 2474, 1632, 2459, 1660, 2444,
+    1667, 2425, 1694, 2402, 1702, 2396, 1713, 2378, 1731, 2358, 1747, 2346, 1768, 2326, 1777, 2311,
+    1793, 2295, 1821, 2278, 1825, 2261, 1843, 2251, 1862, 2235, 1879, 2225, 1903, 2204, 1906, 2184,
+    1924, 2160, 1943, 2149, 1952, 2137, 1974, 2119, 1992, 2105, 2005, 2087, 2029, 2073, 2039, 2051,
+    2052, 2036, 2064, 2027, 2087, 2004, 2106, 1996, 2113, 1975, 2137, 1957, 2146, 1942, 2172, 1924,
+    2189, 1909, 2206, 1894, 2212, 1873, 2233, 1857, 2241, 1848, 2265, 1837, 2278, 1814, 2284, 1804,
+    2322, 1785, 2328, 1772, 2343, 1753, 2361, 1737, 2387, 1721, 2393, 1707, 2410, 1685, 2426, 1671,
+    2447, 1658, 2461, 1638, 2481, 1621, 2493, 1605, 2502, 1594, 2514, 1579, 2525, 1557, 2553, 1546,
+    2567, 1531, 2589, 1516, 2600, 1490, 2614, 1476, 2635, 1459, 2654, 1445, 2662, 1426, 2688, 1413,
+    2693, 1398, 2716, 1389, 2730, 1362, 2745, 1344, 2764, 1331, 2776, 1317, 2796, 1301, 2809, 1285,
+    2823, 1270, 2852, 1249, 2856, 1232, 2877, 1219, 2895, 1204, 2908, 1192, 2915, 1171, 2946, 1154,
+    2953, 1143, 2973, 1121, 2985, 1107, 3002, 1093, 3018, 1074, 3031, 1064, 3051, 1041, 3071, 1021,
+    3086, 1015, 3095,  993, 3114,  975, 3127,  962, 3148,  948, 3163,  938, 3178,  911, 3198,  898,
+    3216,  885, 3226,  865, 3241,  848, 3254,  838, 3274,  816, 3290,  799, 3314,  797, 3330,  762,
+    3347,  757, 3351,  736, 3373,  722, 3384,  714, 3408,  691, 3420,  674, 3427,  659, 3450,  637,
+    3469,  622, 3483,  606, 3498,  602, 3514,  574, 3525,  564, 3557,  544, 3567,  532, 3586,  527,
+    3599,  498, 3615,  476, 3633,  469, 3645,  447, 3665,  429, 3670,  418, 3698,  404, 3713,  387,
+    3727,  364, 3736,  358, 3758,  336, 3780,  317, 3790,  307, 3803,  288, 3824,  274, 3842,  252,
+    3848,  237, 3868,  229, 3879,  208, 3905,  194, 3919,  177, 3938,  156, 3951,  144, 3968,  130,
+    3978,  118, 3992,   92, 4014,   77, 4032,   67, 4040,   48, 4064,   36, 4077,   23, 4095,    0
+};
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Frames per trace, interleaved X, Y like the DMA block*/
+#define TRACE_FRAMES        256
+#define TRACE_CHANNELS      2
+
+/*Rest position and step of the traces*/
+#define TRACE_REST_X        2048
+#define TRACE_REST_Y        2031
+#define TRACE_STEP_HIGH     3980
+#define TRACE_STEP_START    64
+#define TRACE_STEP_END      192
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#endif
\ No newline at end of file
@@ -0,0 +1,341 @@
+/*
+# ##############################################################################
+# File: test_main.c                                                            #
+# Project: test                                                                #
+# Created Date: Sunday, October 18th 2026, 11:36:20 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:36:20 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Host Test of the ADC filters on the joystick traces of adc_traces.h. Build and run from ADC_JoyStick/ with Unity:
+  gcc -std=c99 -Wall -I<unity>/src -I. test/test_adc_filter/test_main.c <unity>/src/unity.c && ./a.out*/
+
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adc_filter.c"
+#include "adc_traces.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static void     TEST_axis( const uint16_t *trace, uint8_t axis, uint16_t *out );
+static uint16_t TEST_maxDeviation( const uint16_t *samples, uint16_t first, uint16_t count, uint16_t center );
+static uint16_t TEST_refMedian( const uint16_t *samples, uint16_t end, uint8_t len );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static uint16_t axisIn[ TRACE_FRAMES ];
+static uint16_t filtOut[ TRACE_FRAMES ];
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Acquisition chain settings of adc.h ( ADC_JOY_MEDIAN_LEN, ADC_JOY_EMA_SHIFT ), adc.h itself needs the HAL*/
+#define TEST_JOY_MEDIAN_LEN     3
+#define TEST_JOY_EMA_SHIFT      2
+
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Helpers---------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Copy one axis out of an interleaved trace
+ * 
+ */
+static void TEST_axis( const uint16_t *trace, uint8_t axis, uint16_t *out )
+{
+    uint16_t i;
+
+    for( i = 0; i < TRACE_FRAMES; i++ )
+    {
+        out[ i ] = trace[ i * TRACE_CHANNELS + axis ];
+    }
+}
+
+/**
+ * @brief Largest distance of samples[ first .. first + count ) from center
+ * 
+ */
+static uint16_t TEST_maxDeviation( const uint16_t *samples, uint16_t first, uint16_t count, uint16_t center )
+{
+    uint16_t maxDev = 0;
+    uint16_t i;
+    int32_t dev;
+
+    for( i = first; i < ( uint16_t )( first + count ); i++ )
+    {
+        dev = abs( ( int32_t )samples[ i ] - center );
+        if( dev > maxDev )
+        {
+            maxDev = ( uint16_t )dev;
+        }
+    }
+
+    return maxDev;
+}
+
+/**
+ * @brief Reference median of the len samples ending at samples[ end ] ( fewer at the start of the trace ), by sorting a copy
+ * 
+ */
+static uint16_t TEST_refMedian( const uint16_t *samples, uint16_t end, uint8_t len )
+{
+    uint16_t window[ ADC_FILT_MEDIAN_MAX ];
+    uint8_t n = ( end + 1 < len ) ? ( uint8_t )( end + 1 ) : len;
+    uint8_t i, j;
+    uint16_t tmp;
+
+    for( i = 0; i < n; i++ )
+    {
+        window[ i ] = samples[ end - i ];
+    }
+
+    for( i = 1; i < n; i++ )
+    {
+        tmp = window[ i ];
+        for( j = i; ( j > 0 ) && ( window[ j - 1 ] > tmp ); j-- )
+        {
+            window[ j ] = window[ j - 1 ];
+        }
+        window[ j ] = tmp;
+    }
+
+    return window[ n >> 1 ];
+}
+
+void setUp( void )
+{
+    memset( filtOut, 0, sizeof( filtOut ) );
+}
+
+void tearDown( void )
+{
+}
+
+/*Tests-----------------------------------------------------------------------------------------------------*/
+
+static void test_initRejectsInvalidParameters( void )
+{
+    ADC_osr_t osr;
+    ADC_ma_t ma;
+    ADC_median_t med;
+    ADC_ema_t ema;
+
+    TEST_ASSERT_FALSE( ADC_osrInit( &osr, ADC_FILT_OSR_LOG2_MAX + 1, 0 ) );
+    TEST_ASSERT_FALSE( ADC_osrInit( &osr, 2, 3 ) );
+    TEST_ASSERT_FALSE( ADC_osrInit( &osr, 8, 5 ) );
+    TEST_ASSERT_FALSE( ADC_maInit( &ma, ADC_FILT_MA_LOG2_MAX + 1 ) );
+    TEST_ASSERT_FALSE( ADC_medianInit( &med, 0 ) );
+    TEST_ASSERT_FALSE( ADC_medianInit( &med, 4 ) );
+    TEST_ASSERT_FALSE( ADC_medianInit( &med, ADC_FILT_MEDIAN_MAX + 2 ) );
+    TEST_ASSERT_FALSE( ADC_emaInit( &ema, 0 ) );
+    TEST_ASSERT_FALSE( ADC_emaInit( &ema, ADC_FILT_EMA_SHIFT_MAX + 1 ) );
+}
+
+static void test_osrMatchesBlockSums( void )
+{
+    ADC_osr_t osr;
+    uint32_t sum;
+    uint16_t produced, i, k;
+
+    TEST_axis( traceSweep, 0, axisIn );
+    TEST_ASSERT_TRUE( ADC_osrInit( &osr, 4, 2 ) );
+
+    produced = ADC_osrBlock( &osr, traceSweep, TRACE_CHANNELS, TRACE_FRAMES, filtOut );
+    TEST_ASSERT_EQUAL( TRACE_FRAMES / 16, produced );
+
+    for( i = 0; i < produced; i++ )
+    {
+        for( sum = 0, k = 0; k < 16; k++ )
+        {
+            sum += axisIn[ i * 16 + k ];
+        }
+        TEST_ASSERT_EQUAL_UINT16( sum >> 2, filtOut[ i ] );
+    }
+}
+
+static void test_osrAddsResolutionAtRest( void )
+{
+    ADC_osr_t osr;
+    uint16_t produced;
+
+    /*16 samples, 2 extra bits: the rest position comes out at 4x scale*/
+    TEST_ASSERT_TRUE( ADC_osrInit( &osr, 4, 2 ) );
+    produced = ADC_osrBlock( &osr, &traceRest[ 1 ], TRACE_CHANNELS, TRACE_FRAMES, filtOut );
+    TEST_ASSERT_EQUAL( 16, produced );
+
+    /*Y has one glitch, averaged down to a few LSB*/
+    TEST_ASSERT_LESS_OR_EQUAL( 4 * 40, TEST_maxDeviation( filtOut, 0, produced, 4 * TRACE_REST_Y ) );
+}
+
+static void test_maMatchesRunningAverage( void )
+{
+    ADC_ma_t ma;
+    uint32_t sum;
+    uint16_t i, k, n;
+
+    TEST_axis( traceStep, 0, axisIn );
+    TEST_ASSERT_TRUE( ADC_maInit( &ma, 3 ) );
+    TEST_ASSERT_EQUAL( TRACE_FRAMES, ADC_maBlock( &ma, traceStep, TRACE_CHANNELS, TRACE_FRAMES, filtOut ) );
+
+    for( i = 0; i < TRACE_FRAMES; i++ )
+    {
+        n = ( i < 8 ) ? ( i + 1 ) : 8;
+        for( sum = 0, k = 0; k < n; k++ )
+        {
+            sum += axisIn[ i - k ];
+        }
+        TEST_ASSERT_EQUAL_UINT16( sum / n, filtOut[ i ] );
+    }
+}
+
+static void test_medianMatchesSortedWindow( void )
+{
+    ADC_median_t med;
+    uint8_t len;
+    uint16_t i;
+
+    TEST_axis( traceRest, 0, axisIn );
+
+    for( len = 1; len <= ADC_FILT_MEDIAN_MAX; len += 2 )
+    {
+        TEST_ASSERT_TRUE( ADC_medianInit( &med, len ) );
+        ADC_medianBlock( &med, traceRest, TRACE_CHANNELS, TRACE_FRAMES, filtOut );
+
+        for( i = 0; i < TRACE_FRAMES; i++ )
+        {
+            TEST_ASSERT_EQUAL_UINT16( TEST_refMedian( axisIn, i, len ), filtOut[ i ] );
+        }
+    }
+}
+
+static void test_medianRemovesGlitches( void )
+{
+    ADC_median_t med;
+
+    TEST_axis( traceRest, 0, axisIn );
+    TEST_ASSERT_GREATER_THAN( 500, TEST_maxDeviation( axisIn, 0, TRACE_FRAMES, TRACE_REST_X ) );
+
+    TEST_ASSERT_TRUE( ADC_medianInit( &med, 3 ) );
+    ADC_medianBlock( &med, traceRest, TRACE_CHANNELS, TRACE_FRAMES, filtOut );
+    TEST_ASSERT_LESS_OR_EQUAL( 30, TEST_maxDeviation( filtOut, 0, TRACE_FRAMES, TRACE_REST_X ) );
+
+    TEST_ASSERT_TRUE( ADC_medianInit( &med, 3 ) );
+    ADC_medianBlock( &med, &traceRest[ 1 ], TRACE_CHANNELS, TRACE_FRAMES, filtOut );
+    TEST_ASSERT_LESS_OR_EQUAL( 30, TEST_maxDeviation( filtOut, 0, TRACE_FRAMES, TRACE_REST_Y ) );
+}
+
+static void test_medianHandlesRepeatedSamples( void )
+{
+    const uint16_t in[] = { 5, 5, 5, 1, 5, 1, 1, 1, 9, 9 };
+    const uint16_t expect[] = { 5, 5, 5, 5, 5, 1, 1, 1, 1, 9 };
+    ADC_median_t med;
+    uint8_t i;
+
+    TEST_ASSERT_TRUE( ADC_medianInit( &med, 3 ) );
+    for( i = 0; i < sizeof( in ) / sizeof( in[ 0 ] ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT16( expect[ i ], ADC_medianUpdate( &med, in[ i ] ) );
+    }
+}
+
+static void test_emaIsExactOnConstantInput( void )
+{
+    ADC_ema_t ema;
+    uint8_t shift;
+    uint16_t i;
+
+    for( shift = 1; shift <= ADC_FILT_EMA_SHIFT_MAX; shift++ )
+    {
+        TEST_ASSERT_TRUE( ADC_emaInit( &ema, shift ) );
+        for( i = 0; i < 64; i++ )
+        {
+            TEST_ASSERT_EQUAL_UINT16( 4095, ADC_emaUpdate( &ema, 4095 ) );
+        }
+    }
+}
+
+static void test_emaSettlesOnStep( void )
+{
+    ADC_ema_t ema;
+
+    TEST_ASSERT_TRUE( ADC_emaInit( &ema, TEST_JOY_EMA_SHIFT ) );
+    ADC_emaBlock( &ema, traceStep, TRACE_CHANNELS, TRACE_FRAMES, filtOut );
+
+    /*Primed by the first sample, no ramp from 0*/
+    TEST_ASSERT_LESS_OR_EQUAL( 30, TEST_maxDeviation( filtOut, 0, TRACE_STEP_START, TRACE_REST_X ) );
+
+    /*Time constant of 4 samples: within the noise after 8 time constants*/
+    TEST_ASSERT_LESS_OR_EQUAL( 30, TEST_maxDeviation( filtOut, TRACE_STEP_START + 32, TRACE_STEP_END - TRACE_STEP_START - 32, TRACE_STEP_HIGH ) );
+    TEST_ASSERT_LESS_OR_EQUAL( 30, TEST_maxDeviation( filtOut, TRACE_STEP_END + 32, TRACE_FRAMES - TRACE_STEP_END - 32, TRACE_REST_X ) );
+}
+
+static void test_blockMatchesSampleBySample( void )
+{
+    ADC_median_t medBlock, medSample;
+    ADC_ema_t emaBlock, emaSample;
+    uint16_t i;
+
+    TEST_ASSERT_TRUE( ADC_medianInit( &medBlock, TEST_JOY_MEDIAN_LEN ) );
+    TEST_ASSERT_TRUE( ADC_medianInit( &medSample, TEST_JOY_MEDIAN_LEN ) );
+    TEST_ASSERT_TRUE( ADC_emaInit( &emaBlock, TEST_JOY_EMA_SHIFT ) );
+    TEST_ASSERT_TRUE( ADC_emaInit( &emaSample, TEST_JOY_EMA_SHIFT ) );
+
+    /*The acquisition chain: median then EMA, on the Y axis of the sweep*/
+    ADC_medianBlock( &medBlock, &traceSweep[ 1 ], TRACE_CHANNELS, TRACE_FRAMES, axisIn );
+    ADC_emaBlock( &emaBlock, axisIn, 1, TRACE_FRAMES, filtOut );
+
+    for( i = 0; i < TRACE_FRAMES; i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT16( ADC_emaUpdate( &emaSample, ADC_medianUpdate( &medSample, traceSweep[ i * TRACE_CHANNELS + 1 ] ) ), filtOut[ i ] );
+    }
+}
+
+int main( void )
+{
+    UNITY_BEGIN( );
+
+    RUN_TEST( test_initRejectsInvalidParameters );
+    RUN_TEST( test_osrMatchesBlockSums );
+    RUN_TEST( test_osrAddsResolutionAtRest );
+    RUN_TEST( test_maMatchesRunningAverage );
+    RUN_TEST( test_medianMatchesSortedWindow );
+    RUN_TEST( test_medianRemovesGlitches );
+    RUN_TEST( test_medianHandlesRepeatedSamples );
+    RUN_TEST( test_emaIsExactOnConstantInput );
+    RUN_TEST( test_emaSettlesOnStep );
+    RUN_TEST( test_blockMatchesSampleBySample );
+
+    return UNITY_END( );
+}
\ No newline at end of file
@@ -0,0 +1,296 @@
+/*
+# ##############################################################################
+# File: test_main.c                                                            #
+# Project: test                                                                #
+# Created Date: Sunday, October 18th 2026, 11:45:30 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Host Test of the Joystick Conversion Stage, exhaustive over the 12 bit input range. Build and run from ADC_JoyStick/ with Unity:
+  gcc -std=c99 -O2 -Wall -Wconversion -Wsign-conversion -I<unity>/src -I. test/test_joystick/test_main.c <unity>/src/unity.c && ./a.out*/
+
+#include <unity.h>
+
+#include "joystick.c"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static JOY_t joy;
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Sign of an integer*/
+#define TEST_SIGN( v )      ( ( ( v ) > 0 ) - ( ( v ) < 0 ) )
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+void setUp( void )
+{
+    JOY_init( &joy );
+}
+
+void tearDown( void )
+{
+}
+
+/*Tests-----------------------------------------------------------------------------------------------------*/
+
+static void test_curvesAreMonotonicAndSpanTheOutput( void )
+{
+    uint8_t c, i;
+
+    for( c = 0; c < JOY_CURVE_COUNT; c++ )
+    {
+        TEST_ASSERT_EQUAL( 0, joyCurves[ c ][ 0 ] );
+        TEST_ASSERT_EQUAL( JOY_OUT_MAX, joyCurves[ c ][ JOY_CURVE_STEPS ] );
+
+        for( i = 0; i < JOY_CURVE_STEPS; i++ )
+        {
+            TEST_ASSERT_TRUE( joyCurves[ c ][ i ] <= joyCurves[ c ][ i + 1 ] );
+        }
+    }
+
+    TEST_ASSERT_FALSE( JOY_setCurve( &joy, JOY_CURVE_COUNT ) );
+}
+
+static void test_applyCurveInterpolatesEveryMagnitude( void )
+{
+    const uint8_t *curve;
+    uint32_t idx, frac, expect;
+    uint16_t mag;
+    uint8_t c, out, prev;
+
+    for( c = 0; c < JOY_CURVE_COUNT; c++ )
+    {
+        curve = joyCurves[ c ];
+        prev = 0;
+
+        for( mag = 0; mag <= JOY_NORM_MAX; mag++ )
+        {
+            out = JOY_applyCurve( curve, mag );
+
+            /*Rounded linear interpolation, never below the previous magnitude*/
+            idx     = mag >> JOY_CURVE_FRAC_SHIFT;
+            frac    = mag & ( ( 1U << JOY_CURVE_FRAC_SHIFT ) - 1U );
+            expect  = ( idx < JOY_CURVE_STEPS ) ?
+                      ( ( curve[ idx ] << JOY_CURVE_FRAC_SHIFT ) + ( curve[ idx + 1 ] - curve[ idx ] ) * frac + ( 1U << ( JOY_CURVE_FRAC_SHIFT - 1 ) ) ) >> JOY_CURVE_FRAC_SHIFT :
+                      curve[ JOY_CURVE_STEPS ];
+            TEST_ASSERT_EQUAL( expect, out );
+            TEST_ASSERT_TRUE( out >= prev );
+            prev = out;
+        }
+
+        TEST_ASSERT_EQUAL( JOY_OUT_MAX, JOY_applyCurve( curve, 0xFFFF ) );
+    }
+}
+
+static void test_normalizeSweepIsMonotonicAndClamped( void )
+{
+    int16_t n, prev;
+    uint16_t raw;
+
+    JOY_calSetAxis( &joy, 0, 400, 2000, 3700, FALSE );
+
+    prev = -JOY_NORM_MAX;
+    for( raw = 0; raw <= JOY_RAW_MAX; raw++ )
+    {
+        n = JOY_normalize( &joy.axis[ 0 ], raw );
+        TEST_ASSERT_TRUE( ( n >= -JOY_NORM_MAX ) && ( n <= JOY_NORM_MAX ) );
+        TEST_ASSERT_TRUE( n >= prev );
+        prev = n;
+    }
+
+    TEST_ASSERT_EQUAL( -JOY_NORM_MAX, JOY_normalize( &joy.axis[ 0 ], 400 ) );
+    TEST_ASSERT_EQUAL( 0, JOY_normalize( &joy.axis[ 0 ], 2000 ) );
+    TEST_ASSERT_INT_WITHIN( 1, JOY_NORM_MAX, JOY_normalize( &joy.axis[ 0 ], 3700 ) );
+
+    /*Inverted axis mirrors the sign*/
+    JOY_calSetAxis( &joy, 1, 400, 2000, 3700, TRUE );
+    TEST_ASSERT_EQUAL( JOY_NORM_MAX, JOY_normalize( &joy.axis[ 1 ], 0 ) );
+}
+
+static void test_convertExhaustiveSweep( void )
+{
+    int16_t n[ 2 ];
+    int8_t x, y;
+    uint32_t magSq;
+    uint16_t rawX, rawY;
+    uint8_t c;
+
+    for( c = 0; c < JOY_CURVE_COUNT; c++ )
+    {
+        TEST_ASSERT_TRUE( JOY_setCurve( &joy, ( JOY_curve_t )c ) );
+
+        for( rawX = 0; rawX <= JOY_RAW_MAX; rawX++ )
+        {
+            for( rawY = 0; rawY <= JOY_RAW_MAX; rawY++ )
+            {
+                /*Every reading from the centred state: no hysteresis carried over between points*/
+                joy.inDeadzone = TRUE;
+                JOY_convert( &joy, rawX, rawY, &x, &y );
+
+                n[ 0 ]  = JOY_normalize( &joy.axis[ 0 ], rawX );
+                n[ 1 ]  = JOY_normalize( &joy.axis[ 1 ], rawY );
+                magSq   = ( uint32_t )( n[ 0 ] * n[ 0 ] + n[ 1 ] * n[ 1 ] );
+
+                if( magSq <= joy.exitSq )
+                {
+                    if( ( x != 0 ) || ( y != 0 ) )
+                    {
+                        TEST_FAIL_MESSAGE( "output inside the deadzone" );
+                    }
+                    continue;
+                }
+
+                /*In range, and never pointing against the deflection*/
+                if( ( x < -JOY_OUT_MAX ) || ( y < -JOY_OUT_MAX ) || 
+                    ( ( x != 0 ) && ( TEST_SIGN( x ) != TEST_SIGN( n[ 0 ] ) ) ) ||
+                    ( ( y != 0 ) && ( TEST_SIGN( y ) != TEST_SIGN( n[ 1 ] ) ) ) )
+                {
+                    TEST_FAIL_MESSAGE( "output out of range or with the wrong sign" );
+                }
+            }
+        }
+
+        /*End stops reach full scale, Y is inverted by default*/
+        joy.inDeadzone = TRUE;
+        JOY_convert( &joy, JOY_RAW_MAX, JOY_CAL_CENTRE_DEFAULT, &x, &y );
+        TEST_ASSERT_EQUAL( JOY_OUT_MAX, x );
+        TEST_ASSERT_EQUAL( 0, y );
+        JOY_convert( &joy, JOY_CAL_CENTRE_DEFAULT, 0, &x, &y );
+        TEST_ASSERT_EQUAL( 0, x );
+        TEST_ASSERT_EQUAL( JOY_OUT_MAX, y );
+        /*The corner is full scale along the diagonal*/
+        JOY_convert( &joy, 0, JOY_RAW_MAX, &x, &y );
+        TEST_ASSERT_EQUAL( x, y );
+        TEST_ASSERT_INT_WITHIN( 1, -( JOY_OUT_MAX * 1000 + 707 ) / 1414, x );
+    }
+}
+
+static void test_convertAxisSweepIsMonotonic( void )
+{
+    int8_t x, y, prev;
+    uint16_t raw;
+    uint8_t c;
+
+    for( c = 0; c < JOY_CURVE_COUNT; c++ )
+    {
+        TEST_ASSERT_TRUE( JOY_setCurve( &joy, ( JOY_curve_t )c ) );
+
+        prev = -JOY_OUT_MAX;
+        for( raw = 0; raw <= JOY_RAW_MAX; raw++ )
+        {
+            JOY_convert( &joy, raw, JOY_CAL_CENTRE_DEFAULT, &x, &y );
+            TEST_ASSERT_TRUE( x >= prev );
+            TEST_ASSERT_EQUAL( 0, y );
+            prev = x;
+        }
+    }
+}
+
+static void test_deadzoneHysteresis( void )
+{
+    /*Radius 100 to enter, 130 to leave, 2 raw LSB per normalized unit with the default calibration*/
+    const uint16_t inside = JOY_CAL_CENTRE_DEFAULT + 180;   /*90*/
+    const uint16_t edge = JOY_CAL_CENTRE_DEFAULT + 240;     /*120*/
+    const uint16_t outside = JOY_CAL_CENTRE_DEFAULT + 280;  /*140*/
+    int8_t x, y;
+
+    JOY_convert( &joy, edge, JOY_CAL_CENTRE_DEFAULT, &x, &y );
+    TEST_ASSERT_EQUAL( 0, x );
+
+    JOY_convert( &joy, outside, JOY_CAL_CENTRE_DEFAULT, &x, &y );
+    TEST_ASSERT_TRUE( x > 0 );
+
+    /*Between the radii the stick stays out of the deadzone*/
+    JOY_convert( &joy, edge, JOY_CAL_CENTRE_DEFAULT, &x, &y );
+    TEST_ASSERT_TRUE( x > 0 );
+
+    JOY_convert( &joy, inside, JOY_CAL_CENTRE_DEFAULT, &x, &y );
+    TEST_ASSERT_EQUAL( 0, x );
+
+    TEST_ASSERT_FALSE( JOY_setDeadzone( &joy, JOY_DEADZONE_MAX + 1, 0 ) );
+    TEST_ASSERT_FALSE( JOY_setDeadzone( &joy, 500, JOY_NORM_MAX - 500 ) );
+}
+
+/*Outside the radial deadzone a diagonal moves even when both axes are within the deadzone radius, and every direction 
+  ramps up like an axis does*/
+static void test_deadzoneIsRadialOnTheDiagonal( void )
+{
+    int8_t x, y, axisX, axisY;
+    uint16_t r, d;
+    uint8_t c;
+
+    /*100 units on both axes, radius 141: each axis alone would be centred*/
+    JOY_convert( &joy, JOY_CAL_CENTRE_DEFAULT + 200, JOY_CAL_CENTRE_DEFAULT - 200, &x, &y );
+    TEST_ASSERT_TRUE( x > 0 );
+    TEST_ASSERT_EQUAL( x, y );
+
+    for( c = 0; c < JOY_CURVE_COUNT; c++ )
+    {
+        TEST_ASSERT_TRUE( JOY_setCurve( &joy, ( JOY_curve_t )c ) );
+
+        for( r = 140; r <= JOY_NORM_MAX; r += 4 )
+        {
+            /*45 degrees: r / sqrt( 2 ) per axis, 2 raw LSB per normalized unit*/
+            d = ( uint16_t )( ( r * 1000U + 707U ) / 1414U );
+            joy.inDeadzone = FALSE;
+            JOY_convert( &joy, ( uint16_t )( JOY_CAL_CENTRE_DEFAULT + 2 * d ), ( uint16_t )( JOY_CAL_CENTRE_DEFAULT - 2 * d ), &x, &y );
+            joy.inDeadzone = FALSE;
+            JOY_convert( &joy, ( uint16_t )( JOY_CAL_CENTRE_DEFAULT + 2 * r - 1 ), JOY_CAL_CENTRE_DEFAULT, &axisX, &axisY );
+
+            TEST_ASSERT_EQUAL( x, y );
+            TEST_ASSERT_INT_WITHIN( 2, ( axisX * 1000 + 707 ) / 1414, x );
+        }
+    }
+}
+
+int main( void )
+{
+    UNITY_BEGIN( );
+
+    RUN_TEST( test_curvesAreMonotonicAndSpanTheOutput );
+    RUN_TEST( test_applyCurveInterpolatesEveryMagnitude );
+    RUN_TEST( test_normalizeSweepIsMonotonicAndClamped );
+    RUN_TEST( test_convertExhaustiveSweep );
+    RUN_TEST( test_convertAxisSweepIsMonotonic );
+    RUN_TEST( test_deadzoneHysteresis );
+    RUN_TEST( test_deadzoneIsRadialOnTheDiagonal );
+
+    return UNITY_END( );
+}
\ No newline at end of file
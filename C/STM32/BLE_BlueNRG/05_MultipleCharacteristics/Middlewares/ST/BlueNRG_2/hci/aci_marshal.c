@@ -0,0 +1,268 @@
+/**
+  ******************************************************************************
+  * @file    aci_marshal.c
+  * @author  Zafeer Abbasi
+  * @brief   Table driven encoder / decoder for ACI and HCI commands, and the
+  *          descriptor based versions of the commands used by the application
+  ******************************************************************************
+  * @attention
+  *
+  * A command moves here by adding its descriptor and a one line wrapper, and
+  * by putting its generated version under #if !ACI_MARSHAL_TABLE.
+  *
+  ******************************************************************************
+  */
+#include "ble_types.h"
+#include "bluenrg1_aci.h"
+#include "bluenrg1_hci_le.h"
+#include "hci_const.h"
+#include "hci_tl.h"
+#include "aci_marshal.h"
+
+#if ACI_MARSHAL_TABLE
+
+/**
+ * @brief Declare the descriptor desc_<name> of a command ( <name>_desc would
+ *        clash with e.g. aci_gatt_add_char_desc() )
+ */
+#define ACI_DESC(name, ogf, ocf, flags, rsp, ...)                             \
+  static const uint8_t fields_##name[] = { __VA_ARGS__, ACI_F_END };           \
+  static const aci_cmd_desc_t desc_##name = { (ocf), (ogf), (flags), fields_##name, (rsp) }
+
+/************************* Static internal functions **************************/
+
+/**
+  * @brief  Size of a parameter field.
+  *
+  * @param  field: Field code
+  * @param  prev: Value of the previous argument ( count or UUID type )
+  * @retval uint16_t: Bytes, 0 for an invalid UUID type
+  */
+static uint16_t field_size(uint8_t field, uintptr_t prev)
+{
+  if (field <= ACI_F_U32)
+    return field;
+
+  if (field == ACI_F_VAR)
+    return (uint16_t)prev;
+
+  if (field == ACI_F_UUID)
+    return (prev == 1) ? 2 : ((prev == 2) ? 16 : 0);
+
+  return field & 0x3F;
+}
+
+/********************** Marshalling engine *****************************/
+
+tBleStatus aci_marshal_send(const aci_cmd_desc_t *desc, const uintptr_t *args)
+{
+  struct hci_request rq;
+  uint8_t rsp[ACI_MARSHAL_RSP_MAX];
+  uint8_t *buf = hci_get_cmd_buffer();
+  const uint8_t *field;
+  uintptr_t arg, prev = 0;
+  uint16_t len = 0, size, rlen = 1;
+  uint8_t *out;
+
+  /* Encode the parameters in place, behind the reserved packet header */
+  for (field = desc->cmd; *field != ACI_F_END; field++)
+  {
+    arg  = *args++;
+    size = field_size(*field, prev);
+
+    if ((size == 0) && (*field == ACI_F_UUID))
+      return BLE_STATUS_ERROR;
+
+    /* The packet header carries an 8 bit parameter length */
+    if (len + size > HCI_MAX_PAYLOAD_SIZE)
+      return BLE_STATUS_INVALID_PARAMS;
+
+    if (*field <= ACI_F_U32)
+    {
+      buf[len] = (uint8_t)arg;
+      if (size > 1)
+      {
+        buf[len + 1] = (uint8_t)(arg >> 8);
+      }
+      if (size > 2)
+      {
+        buf[len + 2] = (uint8_t)(arg >> 16);
+        buf[len + 3] = (uint8_t)(arg >> 24);
+      }
+    }
+    else
+    {
+      BLUENRG_memcpy(buf + len, (const void *)arg, size);
+    }
+
+    len += size;
+    prev = arg;
+  }
+
+  for (field = desc->rsp; (field != NULL) && (*field != ACI_F_END); field++)
+  {
+    rlen += field_size(*field, 0);
+  }
+  BLUENRG_memset(rsp, 0, rlen);
+
+  BLUENRG_memset(&rq, 0, sizeof(rq));
+  rq.ogf = desc->ogf;
+  rq.ocf = desc->ocf;
+  rq.cparam = buf;
+  rq.clen = len;
+  rq.rparam = rsp;
+  rq.rlen = rlen;
+  if (desc->flags & ACI_D_CMD_STATUS)
+  {
+    rq.event = EVT_CMD_STATUS;
+  }
+
+  if (hci_send_req(&rq, FALSE) < 0)
+    return BLE_STATUS_TIMEOUT;
+  if (rsp[0])
+    return rsp[0];
+
+  /* Decode the response fields into the output pointers */
+  len = 1;
+  for (field = desc->rsp; (field != NULL) && (*field != ACI_F_END); field++)
+  {
+    out  = (uint8_t *)*args++;
+    size = field_size(*field, 0);
+
+    switch (*field)
+    {
+      case ACI_F_U8:
+        *out = rsp[len];
+        break;
+      case ACI_F_U16:
+        *(uint16_t *)out = (uint16_t)(rsp[len] | (rsp[len + 1] << 8));
+        break;
+      case ACI_F_U32:
+        *(uint32_t *)out = (uint32_t)rsp[len] | ((uint32_t)rsp[len + 1] << 8) |
+                           ((uint32_t)rsp[len + 2] << 16) | ((uint32_t)rsp[len + 3] << 24);
+        break;
+      default:
+        BLUENRG_memcpy(out, rsp + len, size);
+        break;
+    }
+    len += size;
+  }
+
+  return BLE_STATUS_SUCCESS;
+}
+
+/********************** Descriptors *****************************/
+
+static const uint8_t rsp_u16[]   = { ACI_F_U16, ACI_F_END };
+static const uint8_t rsp_3u16[]  = { ACI_F_U16, ACI_F_U16, ACI_F_U16, ACI_F_END };
+
+ACI_DESC(hci_reset,                     0x03, 0x003, 0, NULL,      ACI_F_END);
+ACI_DESC(aci_hal_write_config_data,     0x3f, 0x00c, 0, NULL,      ACI_F_U8, ACI_F_U8, ACI_F_VAR);
+ACI_DESC(aci_gap_set_non_discoverable,  0x3f, 0x081, 0, NULL,      ACI_F_END);
+ACI_DESC(aci_gap_set_discoverable,      0x3f, 0x083, 0, NULL,      ACI_F_U8, ACI_F_U16, ACI_F_U16, ACI_F_U8, ACI_F_U8, ACI_F_U8, ACI_F_VAR, ACI_F_U8, ACI_F_VAR, ACI_F_U16, ACI_F_U16);
+ACI_DESC(aci_gap_init,                  0x3f, 0x08a, 0, rsp_3u16,  ACI_F_U8, ACI_F_U8, ACI_F_U8);
+ACI_DESC(aci_gatt_init,                 0x3f, 0x101, 0, NULL,      ACI_F_END);
+ACI_DESC(aci_gatt_add_service,          0x3f, 0x102, 0, rsp_u16,   ACI_F_U8, ACI_F_UUID, ACI_F_U8, ACI_F_U8);
+ACI_DESC(aci_gatt_add_char,             0x3f, 0x104, 0, rsp_u16,   ACI_F_U16, ACI_F_U8, ACI_F_UUID, ACI_F_U16, ACI_F_U8, ACI_F_U8, ACI_F_U8, ACI_F_U8, ACI_F_U8);
+ACI_DESC(aci_gatt_update_char_value,    0x3f, 0x106, 0, NULL,      ACI_F_U16, ACI_F_U16, ACI_F_U8, ACI_F_U8, ACI_F_VAR);
+ACI_DESC(aci_gatt_allow_read,           0x3f, 0x127, 0, NULL,      ACI_F_U16);
+
+/********************** Commands *****************************/
+
+tBleStatus hci_reset(void)
+{
+  return aci_marshal_send(&desc_hci_reset, NULL);
+}
+
+tBleStatus aci_hal_write_config_data(uint8_t Offset,
+                                     uint8_t Length,
+                                     uint8_t Value[])
+{
+  const uintptr_t args[] = { Offset, Length, (uintptr_t)Value };
+  return aci_marshal_send(&desc_aci_hal_write_config_data, args);
+}
+
+tBleStatus aci_gap_set_non_discoverable(void)
+{
+  return aci_marshal_send(&desc_aci_gap_set_non_discoverable, NULL);
+}
+
+tBleStatus aci_gap_set_discoverable(uint8_t Advertising_Type,
+                                    uint16_t Advertising_Interval_Min,
+                                    uint16_t Advertising_Interval_Max,
+                                    uint8_t Own_Address_Type,
+                                    uint8_t Advertising_Filter_Policy,
+                                    uint8_t Local_Name_Length,
+                                    uint8_t Local_Name[],
+                                    uint8_t Service_Uuid_length,
+                                    uint8_t Service_Uuid_List[],
+                                    uint16_t Slave_Conn_Interval_Min,
+                                    uint16_t Slave_Conn_Interval_Max)
+{
+  const uintptr_t args[] = { Advertising_Type, Advertising_Interval_Min, Advertising_Interval_Max, Own_Address_Type,
+                             Advertising_Filter_Policy, Local_Name_Length, (uintptr_t)Local_Name, Service_Uuid_length,
+                             (uintptr_t)Service_Uuid_List, Slave_Conn_Interval_Min, Slave_Conn_Interval_Max };
+  return aci_marshal_send(&desc_aci_gap_set_discoverable, args);
+}
+
+tBleStatus aci_gap_init(uint8_t Role,
+                        uint8_t privacy_enabled,
+                        uint8_t device_name_char_len,
+                        uint16_t *Service_Handle,
+                        uint16_t *Dev_Name_Char_Handle,
+                        uint16_t *Appearance_Char_Handle)
+{
+  const uintptr_t args[] = { Role, privacy_enabled, device_name_char_len,
+                             (uintptr_t)Service_Handle, (uintptr_t)Dev_Name_Char_Handle, (uintptr_t)Appearance_Char_Handle };
+  return aci_marshal_send(&desc_aci_gap_init, args);
+}
+
+tBleStatus aci_gatt_init(void)
+{
+  return aci_marshal_send(&desc_aci_gatt_init, NULL);
+}
+
+tBleStatus aci_gatt_add_service(uint8_t Service_UUID_Type,
+                                Service_UUID_t *Service_UUID,
+                                uint8_t Service_Type,
+                                uint8_t Max_Attribute_Records,
+                                uint16_t *Service_Handle)
+{
+  const uintptr_t args[] = { Service_UUID_Type, (uintptr_t)Service_UUID, Service_Type, Max_Attribute_Records,
+                             (uintptr_t)Service_Handle };
+  return aci_marshal_send(&desc_aci_gatt_add_service, args);
+}
+
+tBleStatus aci_gatt_add_char(uint16_t Service_Handle,
+                             uint8_t Char_UUID_Type,
+                             Char_UUID_t *Char_UUID,
+                             uint16_t Char_Value_Length,
+                             uint8_t Char_Properties,
+                             uint8_t Security_Permissions,
+                             uint8_t GATT_Evt_Mask,
+                             uint8_t Enc_Key_Size,
+                             uint8_t Is_Variable,
+                             uint16_t *Char_Handle)
+{
+  const uintptr_t args[] = { Service_Handle, Char_UUID_Type, (uintptr_t)Char_UUID, Char_Value_Length, Char_Properties,
+                             Security_Permissions, GATT_Evt_Mask, Enc_Key_Size, Is_Variable, (uintptr_t)Char_Handle };
+  return aci_marshal_send(&desc_aci_gatt_add_char, args);
+}
+
+tBleStatus aci_gatt_update_char_value(uint16_t Service_Handle,
+                                      uint16_t Char_Handle,
+                                      uint8_t Val_Offset,
+                                      uint8_t Char_Value_Length,
+                                      uint8_t Char_Value[])
+{
+  const uintptr_t args[] = { Service_Handle, Char_Handle, Val_Offset, Char_Value_Length, (uintptr_t)Char_Value };
+  return aci_marshal_send(&desc_aci_gatt_update_char_value, args);
+}
+
+tBleStatus aci_gatt_allow_read(uint16_t Connection_Handle)
+{
+  const uintptr_t args[] = { Connection_Handle };
+  return aci_marshal_send(&desc_aci_gatt_allow_read, args);
+}
+
+#endif /* ACI_MARSHAL_TABLE */
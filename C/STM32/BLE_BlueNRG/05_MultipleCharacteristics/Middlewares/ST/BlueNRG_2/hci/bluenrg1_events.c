@@ -19,6 +19,7 @@
   */
 #include <stdint.h>
 #include "bluenrg1_events.h"
+#include "hci_evt_view.h"
 tBleStatus hci_disconnection_complete_event_process(uint8_t *buffer_in);
 tBleStatus hci_encryption_change_event_process(uint8_t *buffer_in);
 tBleStatus hci_read_remote_version_information_complete_event_process(uint8_t *buffer_in);
@@ -79,7 +80,26 @@ tBleStatus hci_le_read_local_p256_public_key_complete_event_process(uint8_t *buf
 tBleStatus hci_le_generate_dhkey_complete_event_process(uint8_t *buffer_in);
 tBleStatus hci_le_enhanced_connection_complete_event_process(uint8_t *buffer_in);
 tBleStatus hci_le_direct_advertising_report_event_process(uint8_t *buffer_in);
-const hci_events_table_type hci_events_table[7] = {
+#if BLE_EVENTS_PRUNE
+/* Tables built from bluenrg_events_conf.h, the other parsers are not referenced */
+#define BLE_EVENTS_ENTRY(code, name) {code, name##_process},
+#if HCI_EVENTS_TABLE_SIZE > 0
+const hci_events_table_type hci_events_table[HCI_EVENTS_TABLE_SIZE] = {
+  BLE_CONF_HCI_EVENTS(BLE_EVENTS_ENTRY)
+};
+#endif
+#if HCI_LE_META_EVENTS_TABLE_SIZE > 0
+const hci_le_meta_events_table_type hci_le_meta_events_table[HCI_LE_META_EVENTS_TABLE_SIZE] = {
+  BLE_CONF_LE_META_EVENTS(BLE_EVENTS_ENTRY)
+};
+#endif
+#if HCI_VENDOR_SPECIFIC_EVENTS_TABLE_SIZE > 0
+const hci_vendor_specific_events_table_type hci_vendor_specific_events_table[HCI_VENDOR_SPECIFIC_EVENTS_TABLE_SIZE] = {
+  BLE_CONF_VS_EVENTS(BLE_EVENTS_ENTRY)
+};
+#endif
+#else
+const hci_events_table_type hci_events_table[HCI_EVENTS_TABLE_SIZE] = {
   /* hci_disconnection_complete_event */
   {0x0005, hci_disconnection_complete_event_process},
   /* hci_encryption_change_event */
@@ -95,7 +115,7 @@ const hci_events_table_type hci_events_table[7] = {
   /* hci_encryption_key_refresh_complete_event */
   {0x0030, hci_encryption_key_refresh_complete_event_process}
 };
-const hci_le_meta_events_table_type hci_le_meta_events_table[10] = {
+const hci_le_meta_events_table_type hci_le_meta_events_table[HCI_LE_META_EVENTS_TABLE_SIZE] = {
   /* hci_le_connection_complete_event */
   {0x0001, hci_le_connection_complete_event_process},
   /* hci_le_advertising_report_event */
@@ -117,7 +137,7 @@ const hci_le_meta_events_table_type hci_le_meta_events_table[10] = {
   /* hci_le_direct_advertising_report_event */
   {0x000b, hci_le_direct_advertising_report_event_process}
 };
-const hci_vendor_specific_events_table_type hci_vendor_specific_events_table[43] = {
+const hci_vendor_specific_events_table_type hci_vendor_specific_events_table[HCI_VENDOR_SPECIFIC_EVENTS_TABLE_SIZE] = {
   /* aci_blue_initialized_event */
   {0x0001, aci_blue_initialized_event_process},
   /* aci_blue_events_lost_event */
@@ -205,6 +225,13 @@ const hci_vendor_specific_events_table_type hci_vendor_specific_events_table[43]
   /* aci_gatt_prepare_write_permit_req_event */
   {0x0c18, aci_gatt_prepare_write_permit_req_event_process}
 };
+#endif /* BLE_EVENTS_PRUNE */
+#if HCI_VENDOR_SPECIFIC_VIEWS_TABLE_SIZE > 0
+#define BLE_EVENTS_VIEW_ENTRY(code, name) {code, name},
+const hci_evt_view_table_type hci_vendor_specific_views_table[HCI_VENDOR_SPECIFIC_VIEWS_TABLE_SIZE] = {
+  BLE_CONF_VS_EVENT_VIEWS(BLE_EVENTS_VIEW_ENTRY)
+};
+#endif
 /* hci_disconnection_complete_event */
 /* Event len: 1 + 2 + 1 */
 /**
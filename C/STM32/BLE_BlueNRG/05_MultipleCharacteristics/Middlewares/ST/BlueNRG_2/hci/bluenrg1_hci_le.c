@@ -19,11 +19,12 @@
   */
 #include "ble_types.h"
 #include "bluenrg1_hci_le.h"
+#include "aci_marshal.h"
 tBleStatus hci_disconnect(uint16_t Connection_Handle,
                           uint8_t Reason)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_disconnect_cp0 *cp0 = (hci_disconnect_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -49,7 +50,7 @@ tBleStatus hci_disconnect(uint16_t Connection_Handle,
 tBleStatus hci_read_remote_version_information(uint16_t Connection_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_read_remote_version_information_cp0 *cp0 = (hci_read_remote_version_information_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -73,7 +74,7 @@ tBleStatus hci_read_remote_version_information(uint16_t Connection_Handle)
 tBleStatus hci_set_event_mask(uint8_t Event_Mask[8])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_set_event_mask_cp0 *cp0 = (hci_set_event_mask_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -93,6 +94,7 @@ tBleStatus hci_set_event_mask(uint8_t Event_Mask[8])
   }
   return BLE_STATUS_SUCCESS;
 }
+#if !ACI_MARSHAL_TABLE
 tBleStatus hci_reset(void)
 {
   struct hci_request rq;
@@ -109,12 +111,13 @@ tBleStatus hci_reset(void)
   }
   return BLE_STATUS_SUCCESS;
 }
+#endif /* !ACI_MARSHAL_TABLE */
 tBleStatus hci_read_transmit_power_level(uint16_t Connection_Handle,
                                          uint8_t Type,
                                          int8_t *Transmit_Power_Level)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_read_transmit_power_level_cp0 *cp0 = (hci_read_transmit_power_level_cp0*)(cmd_buffer);
   hci_read_transmit_power_level_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -222,7 +225,7 @@ tBleStatus hci_read_rssi(uint16_t Connection_Handle,
                          int8_t *RSSI)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_read_rssi_cp0 *cp0 = (hci_read_rssi_cp0*)(cmd_buffer);
   hci_read_rssi_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -247,7 +250,7 @@ tBleStatus hci_read_rssi(uint16_t Connection_Handle,
 tBleStatus hci_le_set_event_mask(uint8_t LE_Event_Mask[8])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_set_event_mask_cp0 *cp0 = (hci_le_set_event_mask_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -308,7 +311,7 @@ tBleStatus hci_le_read_local_supported_features(uint8_t LE_Features[8])
 tBleStatus hci_le_set_random_address(uint8_t Random_Address[6])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_set_random_address_cp0 *cp0 = (hci_le_set_random_address_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -338,7 +341,7 @@ tBleStatus hci_le_set_advertising_parameters(uint16_t Advertising_Interval_Min,
                                              uint8_t Advertising_Filter_Policy)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_set_advertising_parameters_cp0 *cp0 = (hci_le_set_advertising_parameters_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -394,7 +397,7 @@ tBleStatus hci_le_set_advertising_data(uint8_t Advertising_Data_Length,
                                        uint8_t Advertising_Data[31])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_set_advertising_data_cp0 *cp0 = (hci_le_set_advertising_data_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -420,7 +423,7 @@ tBleStatus hci_le_set_scan_response_data(uint8_t Scan_Response_Data_Length,
                                          uint8_t Scan_Response_Data[31])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_set_scan_response_data_cp0 *cp0 = (hci_le_set_scan_response_data_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -448,7 +451,7 @@ tBleStatus hci_le_set_scan_response_data(uint8_t Scan_Response_Data_Length,
 tBleStatus hci_le_set_advertise_enable(uint8_t Advertising_Enable)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_set_advertise_enable_cp0 *cp0 = (hci_le_set_advertise_enable_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -475,7 +478,7 @@ tBleStatus hci_le_set_scan_parameters(uint8_t LE_Scan_Type,
                                       uint8_t Scanning_Filter_Policy)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_set_scan_parameters_cp0 *cp0 = (hci_le_set_scan_parameters_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -507,7 +510,7 @@ tBleStatus hci_le_set_scan_enable(uint8_t LE_Scan_Enable,
                                   uint8_t Filter_Duplicates)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_set_scan_enable_cp0 *cp0 = (hci_le_set_scan_enable_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -543,7 +546,7 @@ tBleStatus hci_le_create_connection(uint16_t LE_Scan_Interval,
                                     uint16_t Maximum_CE_Length)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_create_connection_cp0 *cp0 = (hci_le_create_connection_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -640,7 +643,7 @@ tBleStatus hci_le_add_device_to_white_list(uint8_t Address_Type,
                                            uint8_t Address[6])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_add_device_to_white_list_cp0 *cp0 = (hci_le_add_device_to_white_list_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -666,7 +669,7 @@ tBleStatus hci_le_remove_device_from_white_list(uint8_t Address_Type,
                                                 uint8_t Address[6])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_remove_device_from_white_list_cp0 *cp0 = (hci_le_remove_device_from_white_list_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -697,7 +700,7 @@ tBleStatus hci_le_connection_update(uint16_t Connection_Handle,
                                     uint16_t Maximum_CE_Length)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_connection_update_cp0 *cp0 = (hci_le_connection_update_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -733,7 +736,7 @@ tBleStatus hci_le_connection_update(uint16_t Connection_Handle,
 tBleStatus hci_le_set_host_channel_classification(uint8_t LE_Channel_Map[5])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_set_host_channel_classification_cp0 *cp0 = (hci_le_set_host_channel_classification_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -757,7 +760,7 @@ tBleStatus hci_le_read_channel_map(uint16_t Connection_Handle,
                                    uint8_t LE_Channel_Map[5])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_read_channel_map_cp0 *cp0 = (hci_le_read_channel_map_cp0*)(cmd_buffer);
   hci_le_read_channel_map_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -782,7 +785,7 @@ tBleStatus hci_le_read_channel_map(uint16_t Connection_Handle,
 tBleStatus hci_le_read_remote_used_features(uint16_t Connection_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_read_remote_used_features_cp0 *cp0 = (hci_le_read_remote_used_features_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -808,7 +811,7 @@ tBleStatus hci_le_encrypt(uint8_t Key[16],
                           uint8_t Encrypted_Data[16])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_encrypt_cp0 *cp0 = (hci_le_encrypt_cp0*)(cmd_buffer);
   hci_le_encrypt_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -856,7 +859,7 @@ tBleStatus hci_le_start_encryption(uint16_t Connection_Handle,
                                    uint8_t Long_Term_Key[16])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_start_encryption_cp0 *cp0 = (hci_le_start_encryption_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -887,7 +890,7 @@ tBleStatus hci_le_long_term_key_request_reply(uint16_t Connection_Handle,
                                               uint8_t Long_Term_Key[16])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_long_term_key_request_reply_cp0 *cp0 = (hci_le_long_term_key_request_reply_cp0*)(cmd_buffer);
   hci_le_long_term_key_request_reply_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -913,7 +916,7 @@ tBleStatus hci_le_long_term_key_request_reply(uint16_t Connection_Handle,
 tBleStatus hci_le_long_term_key_requested_negative_reply(uint16_t Connection_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_long_term_key_requested_negative_reply_cp0 *cp0 = (hci_le_long_term_key_requested_negative_reply_cp0*)(cmd_buffer);
   hci_le_long_term_key_requested_negative_reply_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -955,7 +958,7 @@ tBleStatus hci_le_read_supported_states(uint8_t LE_States[8])
 tBleStatus hci_le_receiver_test(uint8_t RX_Frequency)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_receiver_test_cp0 *cp0 = (hci_le_receiver_test_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -980,7 +983,7 @@ tBleStatus hci_le_transmitter_test(uint8_t TX_Frequency,
                                    uint8_t Packet_Payload)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_transmitter_test_cp0 *cp0 = (hci_le_transmitter_test_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1027,7 +1030,7 @@ tBleStatus hci_le_set_data_length(uint16_t Connection_Handle,
                                   uint16_t TxTime)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_set_data_length_cp0 *cp0 = (hci_le_set_data_length_cp0*)(cmd_buffer);
   hci_le_set_data_length_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -1076,7 +1079,7 @@ tBleStatus hci_le_write_suggested_default_data_length(uint16_t SuggestedMaxTxOct
                                                       uint16_t SuggestedMaxTxTime)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_write_suggested_default_data_length_cp0 *cp0 = (hci_le_write_suggested_default_data_length_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1118,7 +1121,7 @@ tBleStatus hci_le_read_local_p256_public_key(void)
 tBleStatus hci_le_generate_dhkey(uint8_t Remote_P256_Public_Key[64])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_generate_dhkey_cp0 *cp0 = (hci_le_generate_dhkey_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1145,7 +1148,7 @@ tBleStatus hci_le_add_device_to_resolving_list(uint8_t Peer_Identity_Address_Typ
                                                uint8_t Local_IRK[16])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_add_device_to_resolving_list_cp0 *cp0 = (hci_le_add_device_to_resolving_list_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1175,7 +1178,7 @@ tBleStatus hci_le_remove_device_from_resolving_list(uint8_t Peer_Identity_Addres
                                                     uint8_t Peer_Identity_Address[6])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_remove_device_from_resolving_list_cp0 *cp0 = (hci_le_remove_device_from_resolving_list_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1236,7 +1239,7 @@ tBleStatus hci_le_read_peer_resolvable_address(uint8_t Peer_Identity_Address_Typ
                                                uint8_t Peer_Resolvable_Address[6])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_read_peer_resolvable_address_cp0 *cp0 = (hci_le_read_peer_resolvable_address_cp0*)(cmd_buffer);
   hci_le_read_peer_resolvable_address_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -1265,7 +1268,7 @@ tBleStatus hci_le_read_local_resolvable_address(uint8_t Peer_Identity_Address_Ty
                                                 uint8_t Local_Resolvable_Address[6])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_read_local_resolvable_address_cp0 *cp0 = (hci_le_read_local_resolvable_address_cp0*)(cmd_buffer);
   hci_le_read_local_resolvable_address_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -1292,7 +1295,7 @@ tBleStatus hci_le_read_local_resolvable_address(uint8_t Peer_Identity_Address_Ty
 tBleStatus hci_le_set_address_resolution_enable(uint8_t Address_Resolution_Enable)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_set_address_resolution_enable_cp0 *cp0 = (hci_le_set_address_resolution_enable_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1315,7 +1318,7 @@ tBleStatus hci_le_set_address_resolution_enable(uint8_t Address_Resolution_Enabl
 tBleStatus hci_le_set_resolvable_private_address_timeout(uint16_t RPA_Timeout)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   hci_le_set_resolvable_private_address_timeout_cp0 *cp0 = (hci_le_set_resolvable_private_address_timeout_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
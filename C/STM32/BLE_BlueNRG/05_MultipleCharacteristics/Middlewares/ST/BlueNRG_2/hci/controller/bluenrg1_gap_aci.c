@@ -19,6 +19,8 @@
   */
 #include "ble_types.h"
 #include "bluenrg1_gap_aci.h"
+#include "aci_marshal.h"
+#if !ACI_MARSHAL_TABLE
 tBleStatus aci_gap_set_non_discoverable(void)
 {
   struct hci_request rq;
@@ -35,6 +37,7 @@ tBleStatus aci_gap_set_non_discoverable(void)
   }
   return BLE_STATUS_SUCCESS;
 }
+#endif /* !ACI_MARSHAL_TABLE */
 tBleStatus aci_gap_set_limited_discoverable(uint8_t Advertising_Type,
                                             uint16_t Advertising_Interval_Min,
                                             uint16_t Advertising_Interval_Max,
@@ -48,7 +51,7 @@ tBleStatus aci_gap_set_limited_discoverable(uint8_t Advertising_Type,
                                             uint16_t Slave_Conn_Interval_Max)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_set_limited_discoverable_cp0 *cp0 = (aci_gap_set_limited_discoverable_cp0*)(cmd_buffer);
   aci_gap_set_limited_discoverable_cp1 *cp1 = (aci_gap_set_limited_discoverable_cp1*)(cmd_buffer + 1 + 2 + 2 + 1 + 1 + 1 + Local_Name_Length * (sizeof(uint8_t)));
   aci_gap_set_limited_discoverable_cp2 *cp2 = (aci_gap_set_limited_discoverable_cp2*)(cmd_buffer + 1 + 2 + 2 + 1 + 1 + 1 + Local_Name_Length * (sizeof(uint8_t)) + 1 + Service_Uuid_length * (sizeof(uint8_t)));
@@ -100,6 +103,7 @@ tBleStatus aci_gap_set_limited_discoverable(uint8_t Advertising_Type,
   }
   return BLE_STATUS_SUCCESS;
 }
+#if !ACI_MARSHAL_TABLE
 tBleStatus aci_gap_set_discoverable(uint8_t Advertising_Type,
                                     uint16_t Advertising_Interval_Min,
                                     uint16_t Advertising_Interval_Max,
@@ -113,7 +117,7 @@ tBleStatus aci_gap_set_discoverable(uint8_t Advertising_Type,
                                     uint16_t Slave_Conn_Interval_Max)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_set_discoverable_cp0 *cp0 = (aci_gap_set_discoverable_cp0*)(cmd_buffer);
   aci_gap_set_discoverable_cp1 *cp1 = (aci_gap_set_discoverable_cp1*)(cmd_buffer + 1 + 2 + 2 + 1 + 1 + 1 + Local_Name_Length * (sizeof(uint8_t)));
   aci_gap_set_discoverable_cp2 *cp2 = (aci_gap_set_discoverable_cp2*)(cmd_buffer + 1 + 2 + 2 + 1 + 1 + 1 + Local_Name_Length * (sizeof(uint8_t)) + 1 + Service_Uuid_length * (sizeof(uint8_t)));
@@ -164,6 +168,7 @@ tBleStatus aci_gap_set_discoverable(uint8_t Advertising_Type,
   }
   return BLE_STATUS_SUCCESS;
 }
+#endif /* !ACI_MARSHAL_TABLE */
 tBleStatus aci_gap_set_direct_connectable(uint8_t Own_Address_Type,
                                           uint8_t Directed_Advertising_Type,
                                           uint8_t Direct_Address_Type,
@@ -172,7 +177,7 @@ tBleStatus aci_gap_set_direct_connectable(uint8_t Own_Address_Type,
                                           uint16_t Advertising_Interval_Max)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_set_direct_connectable_cp0 *cp0 = (aci_gap_set_direct_connectable_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -205,7 +210,7 @@ tBleStatus aci_gap_set_direct_connectable(uint8_t Own_Address_Type,
 tBleStatus aci_gap_set_io_capability(uint8_t IO_Capability)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_set_io_capability_cp0 *cp0 = (aci_gap_set_io_capability_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -236,7 +241,7 @@ tBleStatus aci_gap_set_authentication_requirement(uint8_t Bonding_Mode,
                                                   uint8_t Identity_Address_Type)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_set_authentication_requirement_cp0 *cp0 = (aci_gap_set_authentication_requirement_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -276,7 +281,7 @@ tBleStatus aci_gap_set_authorization_requirement(uint16_t Connection_Handle,
                                                  uint8_t Authorization_Enable)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_set_authorization_requirement_cp0 *cp0 = (aci_gap_set_authorization_requirement_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -302,7 +307,7 @@ tBleStatus aci_gap_pass_key_resp(uint16_t Connection_Handle,
                                  uint32_t Pass_Key)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_pass_key_resp_cp0 *cp0 = (aci_gap_pass_key_resp_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -328,7 +333,7 @@ tBleStatus aci_gap_authorization_resp(uint16_t Connection_Handle,
                                       uint8_t Authorize)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_authorization_resp_cp0 *cp0 = (aci_gap_authorization_resp_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -350,6 +355,7 @@ tBleStatus aci_gap_authorization_resp(uint16_t Connection_Handle,
   }
   return BLE_STATUS_SUCCESS;
 }
+#if !ACI_MARSHAL_TABLE
 tBleStatus aci_gap_init(uint8_t Role,
                         uint8_t privacy_enabled,
                         uint8_t device_name_char_len,
@@ -358,7 +364,7 @@ tBleStatus aci_gap_init(uint8_t Role,
                         uint16_t *Appearance_Char_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_init_cp0 *cp0 = (aci_gap_init_cp0*)(cmd_buffer);
   aci_gap_init_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -386,11 +392,12 @@ tBleStatus aci_gap_init(uint8_t Role,
   *Appearance_Char_Handle = btoh(resp.Appearance_Char_Handle, 2);
   return BLE_STATUS_SUCCESS;
 }
+#endif /* !ACI_MARSHAL_TABLE */
 tBleStatus aci_gap_set_non_connectable(uint8_t Advertising_Event_Type,
                                        uint8_t Own_Address_Type)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_set_non_connectable_cp0 *cp0 = (aci_gap_set_non_connectable_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -418,7 +425,7 @@ tBleStatus aci_gap_set_undirected_connectable(uint16_t Advertising_Interval_Min,
                                               uint8_t Adv_Filter_Policy)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_set_undirected_connectable_cp0 *cp0 = (aci_gap_set_undirected_connectable_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -447,7 +454,7 @@ tBleStatus aci_gap_set_undirected_connectable(uint16_t Advertising_Interval_Min,
 tBleStatus aci_gap_slave_security_req(uint16_t Connection_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_slave_security_req_cp0 *cp0 = (aci_gap_slave_security_req_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -472,7 +479,7 @@ tBleStatus aci_gap_update_adv_data(uint8_t AdvDataLen,
                                    uint8_t AdvData[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_update_adv_data_cp0 *cp0 = (aci_gap_update_adv_data_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -500,7 +507,7 @@ tBleStatus aci_gap_update_adv_data(uint8_t AdvDataLen,
 tBleStatus aci_gap_delete_ad_type(uint8_t ADType)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_delete_ad_type_cp0 *cp0 = (aci_gap_delete_ad_type_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -525,7 +532,7 @@ tBleStatus aci_gap_get_security_level(uint16_t Connection_Handle,
                                       uint8_t *Security_Level)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_get_security_level_cp0 *cp0 = (aci_gap_get_security_level_cp0*)(cmd_buffer);
   aci_gap_get_security_level_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -551,7 +558,7 @@ tBleStatus aci_gap_get_security_level(uint16_t Connection_Handle,
 tBleStatus aci_gap_set_event_mask(uint16_t GAP_Evt_Mask)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_set_event_mask_cp0 *cp0 = (aci_gap_set_event_mask_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -591,7 +598,7 @@ tBleStatus aci_gap_terminate(uint16_t Connection_Handle,
                              uint8_t Reason)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_terminate_cp0 *cp0 = (aci_gap_terminate_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -633,7 +640,7 @@ tBleStatus aci_gap_clear_security_db(void)
 tBleStatus aci_gap_allow_rebond(uint16_t Connection_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_allow_rebond_cp0 *cp0 = (aci_gap_allow_rebond_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -659,7 +666,7 @@ tBleStatus aci_gap_start_limited_discovery_proc(uint16_t LE_Scan_Interval,
                                                 uint8_t Filter_Duplicates)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_start_limited_discovery_proc_cp0 *cp0 = (aci_gap_start_limited_discovery_proc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -692,7 +699,7 @@ tBleStatus aci_gap_start_general_discovery_proc(uint16_t LE_Scan_Interval,
                                                 uint8_t Filter_Duplicates)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_start_general_discovery_proc_cp0 *cp0 = (aci_gap_start_general_discovery_proc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -732,7 +739,7 @@ tBleStatus aci_gap_start_name_discovery_proc(uint16_t LE_Scan_Interval,
                                              uint16_t Maximum_CE_Length)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_start_name_discovery_proc_cp0 *cp0 = (aci_gap_start_name_discovery_proc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -786,7 +793,7 @@ tBleStatus aci_gap_start_auto_connection_establish_proc(uint16_t LE_Scan_Interva
                                                         Whitelist_Entry_t Whitelist_Entry[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_start_auto_connection_establish_proc_cp0 *cp0 = (aci_gap_start_auto_connection_establish_proc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -841,7 +848,7 @@ tBleStatus aci_gap_start_general_connection_establish_proc(uint8_t LE_Scan_Type,
                                                            uint8_t Filter_Duplicates)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_start_general_connection_establish_proc_cp0 *cp0 = (aci_gap_start_general_connection_establish_proc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -882,7 +889,7 @@ tBleStatus aci_gap_start_selective_connection_establish_proc(uint8_t LE_Scan_Typ
                                                              Whitelist_Entry_t Whitelist_Entry[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_start_selective_connection_establish_proc_cp0 *cp0 = (aci_gap_start_selective_connection_establish_proc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -936,7 +943,7 @@ tBleStatus aci_gap_create_connection(uint16_t LE_Scan_Interval,
                                      uint16_t Maximum_CE_Length)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_create_connection_cp0 *cp0 = (aci_gap_create_connection_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -980,7 +987,7 @@ tBleStatus aci_gap_create_connection(uint16_t LE_Scan_Interval,
 tBleStatus aci_gap_terminate_gap_proc(uint8_t Procedure_Code)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_terminate_gap_proc_cp0 *cp0 = (aci_gap_terminate_gap_proc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1009,7 +1016,7 @@ tBleStatus aci_gap_start_connection_update(uint16_t Connection_Handle,
                                            uint16_t Maximum_CE_Length)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_start_connection_update_cp0 *cp0 = (aci_gap_start_connection_update_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1046,7 +1053,7 @@ tBleStatus aci_gap_send_pairing_req(uint16_t Connection_Handle,
                                     uint8_t Force_Rebond)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_send_pairing_req_cp0 *cp0 = (aci_gap_send_pairing_req_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1073,7 +1080,7 @@ tBleStatus aci_gap_resolve_private_addr(uint8_t Address[6],
                                         uint8_t Actual_Address[6])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_resolve_private_addr_cp0 *cp0 = (aci_gap_resolve_private_addr_cp0*)(cmd_buffer);
   aci_gap_resolve_private_addr_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -1105,7 +1112,7 @@ tBleStatus aci_gap_set_broadcast_mode(uint16_t Advertising_Interval_Min,
                                       Whitelist_Entry_t Whitelist_Entry[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_set_broadcast_mode_cp0 *cp0 = (aci_gap_set_broadcast_mode_cp0*)(cmd_buffer);
   aci_gap_set_broadcast_mode_cp1 *cp1 = (aci_gap_set_broadcast_mode_cp1*)(cmd_buffer + 2 + 2 + 1 + 1 + 1 + Adv_Data_Length * (sizeof(uint8_t)));
   tBleStatus status = 0;
@@ -1156,7 +1163,7 @@ tBleStatus aci_gap_start_observation_proc(uint16_t LE_Scan_Interval,
                                           uint8_t Scanning_Filter_Policy)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_start_observation_proc_cp0 *cp0 = (aci_gap_start_observation_proc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1211,7 +1218,7 @@ tBleStatus aci_gap_is_device_bonded(uint8_t Peer_Address_Type,
                                     uint8_t Peer_Address[6])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_is_device_bonded_cp0 *cp0 = (aci_gap_is_device_bonded_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1237,7 +1244,7 @@ tBleStatus aci_gap_numeric_comparison_value_confirm_yesno(uint16_t Connection_Ha
                                                           uint8_t Confirm_Yes_No)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_numeric_comparison_value_confirm_yesno_cp0 *cp0 = (aci_gap_numeric_comparison_value_confirm_yesno_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1263,7 +1270,7 @@ tBleStatus aci_gap_passkey_input(uint16_t Connection_Handle,
                                  uint8_t Input_Type)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_passkey_input_cp0 *cp0 = (aci_gap_passkey_input_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1292,7 +1299,7 @@ tBleStatus aci_gap_get_oob_data(uint8_t OOB_Data_Type,
                                 uint8_t OOB_Data[16])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_get_oob_data_cp0 *cp0 = (aci_gap_get_oob_data_cp0*)(cmd_buffer);
   aci_gap_get_oob_data_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -1325,7 +1332,7 @@ tBleStatus aci_gap_set_oob_data(uint8_t Device_Type,
                                 uint8_t OOB_Data[16])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_set_oob_data_cp0 *cp0 = (aci_gap_set_oob_data_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1360,7 +1367,7 @@ tBleStatus aci_gap_add_devices_to_resolving_list(uint8_t Num_of_Resolving_list_E
                                                  uint8_t Clear_Resolving_List)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_add_devices_to_resolving_list_cp0 *cp0 = (aci_gap_add_devices_to_resolving_list_cp0*)(cmd_buffer);
   aci_gap_add_devices_to_resolving_list_cp1 *cp1 = (aci_gap_add_devices_to_resolving_list_cp1*)(cmd_buffer + 1 + Num_of_Resolving_list_Entries * (sizeof(Whitelist_Identity_Entry_t)));
   tBleStatus status = 0;
@@ -1397,7 +1404,7 @@ tBleStatus aci_gap_remove_bonded_device(uint8_t Peer_Identity_Address_Type,
                                         uint8_t Peer_Identity_Address[6])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gap_remove_bonded_device_cp0 *cp0 = (aci_gap_remove_bonded_device_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -19,6 +19,8 @@
   */
 #include "ble_types.h"
 #include "bluenrg1_gatt_aci.h"
+#include "aci_marshal.h"
+#if !ACI_MARSHAL_TABLE
 tBleStatus aci_gatt_init(void)
 {
   struct hci_request rq;
@@ -35,6 +37,8 @@ tBleStatus aci_gatt_init(void)
   }
   return BLE_STATUS_SUCCESS;
 }
+#endif /* !ACI_MARSHAL_TABLE */
+#if !ACI_MARSHAL_TABLE
 tBleStatus aci_gatt_add_service(uint8_t Service_UUID_Type,
                                 Service_UUID_t *Service_UUID,
                                 uint8_t Service_Type,
@@ -42,7 +46,7 @@ tBleStatus aci_gatt_add_service(uint8_t Service_UUID_Type,
                                 uint16_t *Service_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_add_service_cp0 *cp0 = (aci_gatt_add_service_cp0*)(cmd_buffer);
   aci_gatt_add_service_cp1 *cp1 = (aci_gatt_add_service_cp1*)(cmd_buffer + 1 + (Service_UUID_Type == 1 ? 2 : (Service_UUID_Type == 2 ? 16 : 0)));
   aci_gatt_add_service_rp0 resp;
@@ -84,6 +88,7 @@ tBleStatus aci_gatt_add_service(uint8_t Service_UUID_Type,
   *Service_Handle = btoh(resp.Service_Handle, 2);
   return BLE_STATUS_SUCCESS;
 }
+#endif /* !ACI_MARSHAL_TABLE */
 tBleStatus aci_gatt_include_service(uint16_t Service_Handle,
                                     uint16_t Include_Start_Handle,
                                     uint16_t Include_End_Handle,
@@ -92,7 +97,7 @@ tBleStatus aci_gatt_include_service(uint16_t Service_Handle,
                                     uint16_t *Include_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_include_service_cp0 *cp0 = (aci_gatt_include_service_cp0*)(cmd_buffer);
   aci_gatt_include_service_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -131,6 +136,7 @@ tBleStatus aci_gatt_include_service(uint16_t Service_Handle,
   *Include_Handle = btoh(resp.Include_Handle, 2);
   return BLE_STATUS_SUCCESS;
 }
+#if !ACI_MARSHAL_TABLE
 tBleStatus aci_gatt_add_char(uint16_t Service_Handle,
                              uint8_t Char_UUID_Type,
                              Char_UUID_t *Char_UUID,
@@ -143,7 +149,7 @@ tBleStatus aci_gatt_add_char(uint16_t Service_Handle,
                              uint16_t *Char_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_add_char_cp0 *cp0 = (aci_gatt_add_char_cp0*)(cmd_buffer);
   aci_gatt_add_char_cp1 *cp1 = (aci_gatt_add_char_cp1*)(cmd_buffer + 2 + 1 + (Char_UUID_Type == 1 ? 2 : (Char_UUID_Type == 2 ? 16 : 0)));
   aci_gatt_add_char_rp0 resp;
@@ -203,6 +209,7 @@ tBleStatus aci_gatt_add_char(uint16_t Service_Handle,
   *Char_Handle = btoh(resp.Char_Handle, 2);
   return BLE_STATUS_SUCCESS;
 }
+#endif /* !ACI_MARSHAL_TABLE */
 tBleStatus aci_gatt_add_char_desc(uint16_t Service_Handle,
                                   uint16_t Char_Handle,
                                   uint8_t Char_Desc_Uuid_Type,
@@ -218,7 +225,7 @@ tBleStatus aci_gatt_add_char_desc(uint16_t Service_Handle,
                                   uint16_t *Char_Desc_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_add_char_desc_cp0 *cp0 = (aci_gatt_add_char_desc_cp0*)(cmd_buffer);
   aci_gatt_add_char_desc_cp1 *cp1 = (aci_gatt_add_char_desc_cp1*)(cmd_buffer + 2 + 2 + 1 + (Char_Desc_Uuid_Type == 1 ? 2 : (Char_Desc_Uuid_Type == 2 ? 16 : 0)));
   aci_gatt_add_char_desc_cp2 *cp2 = (aci_gatt_add_char_desc_cp2*)(cmd_buffer + 2 + 2 + 1 + (Char_Desc_Uuid_Type == 1 ? 2 : (Char_Desc_Uuid_Type == 2 ? 16 : 0)) + 1 + 1 + Char_Desc_Value_Length * (sizeof(uint8_t)));
@@ -287,6 +294,7 @@ tBleStatus aci_gatt_add_char_desc(uint16_t Service_Handle,
   *Char_Desc_Handle = btoh(resp.Char_Desc_Handle, 2);
   return BLE_STATUS_SUCCESS;
 }
+#if !ACI_MARSHAL_TABLE
 tBleStatus aci_gatt_update_char_value(uint16_t Service_Handle,
                                       uint16_t Char_Handle,
                                       uint8_t Val_Offset,
@@ -294,7 +302,7 @@ tBleStatus aci_gatt_update_char_value(uint16_t Service_Handle,
                                       uint8_t Char_Value[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_update_char_value_cp0 *cp0 = (aci_gatt_update_char_value_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -325,11 +333,12 @@ tBleStatus aci_gatt_update_char_value(uint16_t Service_Handle,
   }
   return BLE_STATUS_SUCCESS;
 }
+#endif /* !ACI_MARSHAL_TABLE */
 tBleStatus aci_gatt_del_char(uint16_t Serv_Handle,
                              uint16_t Char_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_del_char_cp0 *cp0 = (aci_gatt_del_char_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -354,7 +363,7 @@ tBleStatus aci_gatt_del_char(uint16_t Serv_Handle,
 tBleStatus aci_gatt_del_service(uint16_t Serv_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_del_service_cp0 *cp0 = (aci_gatt_del_service_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -378,7 +387,7 @@ tBleStatus aci_gatt_del_include_service(uint16_t Serv_Handle,
                                         uint16_t Include_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_del_include_service_cp0 *cp0 = (aci_gatt_del_include_service_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -403,7 +412,7 @@ tBleStatus aci_gatt_del_include_service(uint16_t Serv_Handle,
 tBleStatus aci_gatt_set_event_mask(uint32_t GATT_Evt_Mask)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_set_event_mask_cp0 *cp0 = (aci_gatt_set_event_mask_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -426,7 +435,7 @@ tBleStatus aci_gatt_set_event_mask(uint32_t GATT_Evt_Mask)
 tBleStatus aci_gatt_exchange_config(uint16_t Connection_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_exchange_config_cp0 *cp0 = (aci_gatt_exchange_config_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -452,7 +461,7 @@ tBleStatus aci_att_find_info_req(uint16_t Connection_Handle,
                                  uint16_t End_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_att_find_info_req_cp0 *cp0 = (aci_att_find_info_req_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -485,7 +494,7 @@ tBleStatus aci_att_find_by_type_value_req(uint16_t Connection_Handle,
                                           uint8_t Attribute_Val[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_att_find_by_type_value_req_cp0 *cp0 = (aci_att_find_by_type_value_req_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -526,7 +535,7 @@ tBleStatus aci_att_read_by_type_req(uint16_t Connection_Handle,
                                     UUID_t *UUID)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_att_read_by_type_req_cp0 *cp0 = (aci_att_read_by_type_req_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -571,7 +580,7 @@ tBleStatus aci_att_read_by_group_type_req(uint16_t Connection_Handle,
                                           UUID_t *UUID)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_att_read_by_group_type_req_cp0 *cp0 = (aci_att_read_by_group_type_req_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -616,7 +625,7 @@ tBleStatus aci_att_prepare_write_req(uint16_t Connection_Handle,
                                      uint8_t Attribute_Val[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_att_prepare_write_req_cp0 *cp0 = (aci_att_prepare_write_req_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -652,7 +661,7 @@ tBleStatus aci_att_execute_write_req(uint16_t Connection_Handle,
                                      uint8_t Execute)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_att_execute_write_req_cp0 *cp0 = (aci_att_execute_write_req_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -678,7 +687,7 @@ tBleStatus aci_att_execute_write_req(uint16_t Connection_Handle,
 tBleStatus aci_gatt_disc_all_primary_services(uint16_t Connection_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_disc_all_primary_services_cp0 *cp0 = (aci_gatt_disc_all_primary_services_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -704,7 +713,7 @@ tBleStatus aci_gatt_disc_primary_service_by_uuid(uint16_t Connection_Handle,
                                                  UUID_t *UUID)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_disc_primary_service_by_uuid_cp0 *cp0 = (aci_gatt_disc_primary_service_by_uuid_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -743,7 +752,7 @@ tBleStatus aci_gatt_find_included_services(uint16_t Connection_Handle,
                                            uint16_t End_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_find_included_services_cp0 *cp0 = (aci_gatt_find_included_services_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -773,7 +782,7 @@ tBleStatus aci_gatt_disc_all_char_of_service(uint16_t Connection_Handle,
                                              uint16_t End_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_disc_all_char_of_service_cp0 *cp0 = (aci_gatt_disc_all_char_of_service_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -805,7 +814,7 @@ tBleStatus aci_gatt_disc_char_by_uuid(uint16_t Connection_Handle,
                                       UUID_t *UUID)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_disc_char_by_uuid_cp0 *cp0 = (aci_gatt_disc_char_by_uuid_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -848,7 +857,7 @@ tBleStatus aci_gatt_disc_all_char_desc(uint16_t Connection_Handle,
                                        uint16_t End_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_disc_all_char_desc_cp0 *cp0 = (aci_gatt_disc_all_char_desc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -877,7 +886,7 @@ tBleStatus aci_gatt_read_char_value(uint16_t Connection_Handle,
                                     uint16_t Attr_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_read_char_value_cp0 *cp0 = (aci_gatt_read_char_value_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -907,7 +916,7 @@ tBleStatus aci_gatt_read_using_char_uuid(uint16_t Connection_Handle,
                                          UUID_t *UUID)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_read_using_char_uuid_cp0 *cp0 = (aci_gatt_read_using_char_uuid_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -950,7 +959,7 @@ tBleStatus aci_gatt_read_long_char_value(uint16_t Connection_Handle,
                                          uint16_t Val_Offset)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_read_long_char_value_cp0 *cp0 = (aci_gatt_read_long_char_value_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -980,7 +989,7 @@ tBleStatus aci_gatt_read_multiple_char_value(uint16_t Connection_Handle,
                                              Handle_Entry_t Handle_Entry[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_read_multiple_char_value_cp0 *cp0 = (aci_gatt_read_multiple_char_value_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1016,7 +1025,7 @@ tBleStatus aci_gatt_write_char_value(uint16_t Connection_Handle,
                                      uint8_t Attribute_Val[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_write_char_value_cp0 *cp0 = (aci_gatt_write_char_value_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1053,7 +1062,7 @@ tBleStatus aci_gatt_write_long_char_value(uint16_t Connection_Handle,
                                           uint8_t Attribute_Val[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_write_long_char_value_cp0 *cp0 = (aci_gatt_write_long_char_value_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1092,7 +1101,7 @@ tBleStatus aci_gatt_write_char_reliable(uint16_t Connection_Handle,
                                         uint8_t Attribute_Val[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_write_char_reliable_cp0 *cp0 = (aci_gatt_write_char_reliable_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1131,7 +1140,7 @@ tBleStatus aci_gatt_write_long_char_desc(uint16_t Connection_Handle,
                                          uint8_t Attribute_Val[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_write_long_char_desc_cp0 *cp0 = (aci_gatt_write_long_char_desc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1168,7 +1177,7 @@ tBleStatus aci_gatt_read_long_char_desc(uint16_t Connection_Handle,
                                         uint16_t Val_Offset)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_read_long_char_desc_cp0 *cp0 = (aci_gatt_read_long_char_desc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1199,7 +1208,7 @@ tBleStatus aci_gatt_write_char_desc(uint16_t Connection_Handle,
                                     uint8_t Attribute_Val[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_write_char_desc_cp0 *cp0 = (aci_gatt_write_char_desc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1233,7 +1242,7 @@ tBleStatus aci_gatt_read_char_desc(uint16_t Connection_Handle,
                                    uint16_t Attr_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_read_char_desc_cp0 *cp0 = (aci_gatt_read_char_desc_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1262,7 +1271,7 @@ tBleStatus aci_gatt_write_without_resp(uint16_t Connection_Handle,
                                        uint8_t Attribute_Val[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_write_without_resp_cp0 *cp0 = (aci_gatt_write_without_resp_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1297,7 +1306,7 @@ tBleStatus aci_gatt_signed_write_without_resp(uint16_t Connection_Handle,
                                               uint8_t Attribute_Val[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_signed_write_without_resp_cp0 *cp0 = (aci_gatt_signed_write_without_resp_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1329,7 +1338,7 @@ tBleStatus aci_gatt_signed_write_without_resp(uint16_t Connection_Handle,
 tBleStatus aci_gatt_confirm_indication(uint16_t Connection_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_confirm_indication_cp0 *cp0 = (aci_gatt_confirm_indication_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1357,7 +1366,7 @@ tBleStatus aci_gatt_write_resp(uint16_t Connection_Handle,
                                uint8_t Attribute_Val[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_write_resp_cp0 *cp0 = (aci_gatt_write_resp_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1390,10 +1399,11 @@ tBleStatus aci_gatt_write_resp(uint16_t Connection_Handle,
   }
   return BLE_STATUS_SUCCESS;
 }
+#if !ACI_MARSHAL_TABLE
 tBleStatus aci_gatt_allow_read(uint16_t Connection_Handle)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_allow_read_cp0 *cp0 = (aci_gatt_allow_read_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1413,12 +1423,13 @@ tBleStatus aci_gatt_allow_read(uint16_t Connection_Handle)
   }
   return BLE_STATUS_SUCCESS;
 }
+#endif /* !ACI_MARSHAL_TABLE */
 tBleStatus aci_gatt_set_security_permission(uint16_t Serv_Handle,
                                             uint16_t Attr_Handle,
                                             uint8_t Security_Permissions)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_set_security_permission_cp0 *cp0 = (aci_gatt_set_security_permission_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1450,7 +1461,7 @@ tBleStatus aci_gatt_set_desc_value(uint16_t Serv_Handle,
                                    uint8_t Char_Desc_Value[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_set_desc_value_cp0 *cp0 = (aci_gatt_set_desc_value_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1491,7 +1502,7 @@ tBleStatus aci_gatt_read_handle_value(uint16_t Attr_Handle,
                                       uint8_t Value[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_read_handle_value_cp0 *cp0 = (aci_gatt_read_handle_value_cp0*)(cmd_buffer);
   aci_gatt_read_handle_value_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -1529,7 +1540,7 @@ tBleStatus aci_gatt_update_char_value_ext(uint16_t Conn_Handle_To_Notify,
                                           uint8_t Value[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_update_char_value_ext_cp0 *cp0 = (aci_gatt_update_char_value_ext_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1570,7 +1581,7 @@ tBleStatus aci_gatt_deny_read(uint16_t Connection_Handle,
                               uint8_t Error_Code)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_deny_read_cp0 *cp0 = (aci_gatt_deny_read_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -1597,7 +1608,7 @@ tBleStatus aci_gatt_set_access_permission(uint16_t Serv_Handle,
                                           uint8_t Access_Permissions)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_gatt_set_access_permission_cp0 *cp0 = (aci_gatt_set_access_permission_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
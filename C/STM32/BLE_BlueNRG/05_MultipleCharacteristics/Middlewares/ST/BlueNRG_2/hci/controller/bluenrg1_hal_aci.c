@@ -19,6 +19,7 @@
   */
 #include "ble_types.h"
 #include "bluenrg1_hal_aci.h"
+#include "aci_marshal.h"
 tBleStatus aci_hal_get_fw_build_number(uint16_t *Build_Number)
 {
   struct hci_request rq;
@@ -75,12 +76,13 @@ tBleStatus aci_hal_get_firmware_details(uint8_t *DTM_version_major,
   *BTLE_Stack_Build_Number = btoh(resp.BTLE_Stack_Build_Number, 2);
   return BLE_STATUS_SUCCESS;
 }
+#if !ACI_MARSHAL_TABLE
 tBleStatus aci_hal_write_config_data(uint8_t Offset,
                                      uint8_t Length,
                                      uint8_t Value[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_hal_write_config_data_cp0 *cp0 = (aci_hal_write_config_data_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -107,12 +109,13 @@ tBleStatus aci_hal_write_config_data(uint8_t Offset,
   }
   return BLE_STATUS_SUCCESS;
 }
+#endif /* !ACI_MARSHAL_TABLE */
 tBleStatus aci_hal_read_config_data(uint8_t Offset,
                                     uint8_t *Data_Length,
                                     uint8_t Data[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_hal_read_config_data_cp0 *cp0 = (aci_hal_read_config_data_cp0*)(cmd_buffer);
   aci_hal_read_config_data_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -139,7 +142,7 @@ tBleStatus aci_hal_set_tx_power_level(uint8_t En_High_Power,
                                       uint8_t PA_Level)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_hal_set_tx_power_level_cp0 *cp0 = (aci_hal_set_tx_power_level_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -183,7 +186,7 @@ tBleStatus aci_hal_tone_start(uint8_t RF_Channel,
                               uint8_t Offset)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_hal_tone_start_cp0 *cp0 = (aci_hal_tone_start_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -244,7 +247,7 @@ tBleStatus aci_hal_get_link_status(uint8_t Link_Status[8],
 tBleStatus aci_hal_set_radio_activity_mask(uint16_t Radio_Activity_Mask)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_hal_set_radio_activity_mask_cp0 *cp0 = (aci_hal_set_radio_activity_mask_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -287,7 +290,7 @@ tBleStatus aci_hal_get_anchor_period(uint32_t *Anchor_Period,
 tBleStatus aci_hal_set_event_mask(uint32_t Event_Mask)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_hal_set_event_mask_cp0 *cp0 = (aci_hal_set_event_mask_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -410,7 +413,7 @@ tBleStatus aci_hal_updater_reset_blue_flag(void)
 tBleStatus aci_hal_updater_erase_sector(uint32_t Address)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_hal_updater_erase_sector_cp0 *cp0 = (aci_hal_updater_erase_sector_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -435,7 +438,7 @@ tBleStatus aci_hal_updater_prog_data_blk(uint32_t Address,
                                          uint8_t Data[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_hal_updater_prog_data_blk_cp0 *cp0 = (aci_hal_updater_prog_data_blk_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -467,7 +470,7 @@ tBleStatus aci_hal_updater_read_data_blk(uint32_t Address,
                                          uint8_t Data[])
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_hal_updater_read_data_blk_cp0 *cp0 = (aci_hal_updater_read_data_blk_cp0*)(cmd_buffer);
   aci_hal_updater_read_data_blk_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -496,7 +499,7 @@ tBleStatus aci_hal_updater_calc_crc(uint32_t Address,
                                     uint32_t *crc)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_hal_updater_calc_crc_cp0 *cp0 = (aci_hal_updater_calc_crc_cp0*)(cmd_buffer);
   aci_hal_updater_calc_crc_rp0 resp;
   BLUENRG_memset(&resp, 0, sizeof(resp));
@@ -544,7 +547,7 @@ tBleStatus aci_hal_transmitter_test_packets(uint8_t TX_Frequency,
                                             uint16_t Number_Of_Packets)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_hal_transmitter_test_packets_cp0 *cp0 = (aci_hal_transmitter_test_packets_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
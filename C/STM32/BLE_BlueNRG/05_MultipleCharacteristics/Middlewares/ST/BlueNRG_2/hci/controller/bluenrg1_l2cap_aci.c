@@ -26,7 +26,7 @@ tBleStatus aci_l2cap_connection_parameter_update_req(uint16_t Connection_Handle,
                                                      uint16_t Timeout_Multiplier)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_l2cap_connection_parameter_update_req_cp0 *cp0 = (aci_l2cap_connection_parameter_update_req_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -66,7 +66,7 @@ tBleStatus aci_l2cap_connection_parameter_update_resp(uint16_t Connection_Handle
                                                       uint8_t Accept)
 {
   struct hci_request rq;
-  uint8_t cmd_buffer[258];
+  uint8_t *cmd_buffer = hci_get_cmd_buffer();
   aci_l2cap_connection_parameter_update_resp_cp0 *cp0 = (aci_l2cap_connection_parameter_update_resp_cp0*)(cmd_buffer);
   tBleStatus status = 0;
   uint8_t index_input = 0;
@@ -19,6 +19,8 @@
 #include "hci_const.h"
 #include "hci.h"
 #include "hci_tl.h"
+#include "profile.h"
+#include "hci_stats.h"
 
 #define HCI_LOG_ON                      0
 #define HCI_PCK_TYPE_OFFSET             0
@@ -29,7 +31,7 @@
  * or high number of incoming notifications from peripheral devices 
  */
 #ifndef HCI_READ_PACKET_NUM_MAX
-  #define HCI_READ_PACKET_NUM_MAX 	   (5)
+  #define HCI_READ_PACKET_NUM_MAX 	   (HCI_PKT_CLASS0_NUM + HCI_PKT_CLASS1_NUM + HCI_PKT_CLASS2_NUM)
 #endif
 
 #ifndef MIN
@@ -39,11 +41,30 @@
   #define MAX(a,b)      ((a) > (b))? (a) : (b)
 #endif
 
-tListNode             hciReadPktPool;
-tListNode             hciReadPktRxQueue;
+tListNode             hciReadPktPool[HCI_PKT_CLASS_NUM];  /* One free list per size class */
+tListNode             hciReadPktRxQueue;                  /* High lane, also searched by hci_send_req() */
+tListNode             hciReadPktBulkQueue;                /* Bulk lane */
 static tHciDataPacket hciReadPacketBuffer[HCI_READ_PACKET_NUM_MAX];
+static uint8_t        hciReadPacketData[HCI_PKT_CLASS0_NUM * HCI_PKT_CLASS0_SIZE +
+                                        HCI_PKT_CLASS1_NUM * HCI_PKT_CLASS1_SIZE +
+                                        HCI_PKT_CLASS2_NUM * HCI_PKT_CLASS2_SIZE];
+static const uint16_t hciPktClassSize[HCI_PKT_CLASS_NUM] = {HCI_PKT_CLASS0_SIZE, HCI_PKT_CLASS1_SIZE, HCI_PKT_CLASS2_SIZE};
+static const uint8_t  hciPktClassNum[HCI_PKT_CLASS_NUM]  = {HCI_PKT_CLASS0_NUM, HCI_PKT_CLASS1_NUM, HCI_PKT_CLASS2_NUM};
+static tHciDataPacket hciReservePacket;
+static uint8_t        hciReservePacketData[HCI_PKT_RESERVE_SIZE];
+static tHciDataPacket *hciReserveFree;      /* &hciReservePacket when free, NULL while in use */
+static volatile BOOL  hciCmdPending;        /* hci_send_req() is waiting for a completion */
+static volatile BOOL  hciRxThrottled;       /* Events left pending in the BlueNRG */
+static tHciRxStats    hciRxStats;
+static uint8_t        hciRxBulkDepth;       /* Packets queued in the bulk lane */
+static tListNode * const hciRxLaneQueue[HCI_RX_LANE_NUM] = {&hciReadPktRxQueue, &hciReadPktBulkQueue};
 static tHciContext    hciContext;
 
+/* Shared command buffer: packet header followed by the parameters */
+static uint8_t        hciCmdBuffer[HCI_HDR_SIZE + HCI_COMMAND_HDR_SIZE + HCI_CMD_BUFFER_SIZE];
+
+static int send_req(struct hci_request* r, BOOL async);
+
 /************************* Static internal functions **************************/
 
 /**
@@ -65,6 +86,57 @@ static int verify_packet(const tHciDataPacket * hciReadPacket)
   return 0;      
 }
 
+/**
+  * @brief  Take a packet from the smallest size class holding len bytes,
+  *         falling back to the larger classes, then to the reserve packet
+  *         while a command waits for its completion. O(HCI_PKT_CLASS_NUM),
+  *         called from the HCI ISR only.
+  *
+  * @param  len Bytes to be read
+  * @retval The packet, NULL if none holding len bytes is free
+  */
+static tHciDataPacket *pool_alloc(uint16_t len)
+{
+  tHciDataPacket *pckt = NULL;
+  uint8_t cls;
+
+  for (cls = 0; cls < HCI_PKT_CLASS_NUM; cls++)
+  {
+    if ((hciPktClassSize[cls] >= len) && !list_is_empty(&hciReadPktPool[cls]))
+    {
+      list_remove_head(&hciReadPktPool[cls], (tListNode **)&pckt);
+      return pckt;
+    }
+  }
+
+  if (hciCmdPending && (hciReserveFree != NULL) && (len <= HCI_PKT_RESERVE_SIZE))
+  {
+    pckt = hciReserveFree;
+    hciReserveFree = NULL;
+    hciRxStats.reserveUsed++;
+  }
+
+  return pckt;
+}
+
+/**
+  * @brief  Return a packet to the free list of its size class.
+  *
+  * @param  pckt The packet
+  * @retval None
+  */
+static void pool_free(tHciDataPacket *pckt)
+{
+  if (pckt->pool == HCI_PKT_RESERVE)
+  {
+    hciReserveFree = pckt;
+  }
+  else
+  {
+    list_insert_head(&hciReadPktPool[pckt->pool], (tListNode *)pckt);
+  }
+}
+
 /**
   * @brief  Send an HCI command.
   *
@@ -76,7 +148,7 @@ static int verify_packet(const tHciDataPacket * hciReadPacket)
   */
 static void send_cmd(uint16_t ogf, uint16_t ocf, uint8_t plen, void *param)
 {
-  uint8_t payload[HCI_MAX_PAYLOAD_SIZE];  
+  uint8_t *payload = hciCmdBuffer;
   hci_command_hdr hc;
   
   hc.opcode = htobs(cmd_opcode_pack(ogf, ocf));
@@ -84,7 +156,12 @@ static void send_cmd(uint16_t ogf, uint16_t ocf, uint8_t plen, void *param)
 
   payload[0] = HCI_COMMAND_PKT;
   BLUENRG_memcpy(payload + 1, &hc, sizeof(hc));
-  BLUENRG_memcpy(payload + HCI_HDR_SIZE + HCI_COMMAND_HDR_SIZE, param, plen);
+
+  /* Parameters built in place by hci_get_cmd_buffer() users are already there */
+  if ((plen > 0) && (param != payload + HCI_HDR_SIZE + HCI_COMMAND_HDR_SIZE))
+  {
+    BLUENRG_memcpy(payload + HCI_HDR_SIZE + HCI_COMMAND_HDR_SIZE, param, plen);
+  }
   
   if (hciContext.io.Send)
   {
@@ -112,18 +189,230 @@ static void move_list(tListNode * dest_list, tListNode * src_list)
 }
 
 /**
-  * @brief  Free the HCI event list.
+  * @brief  Receive lane of an event, from its code ( and subevent / ecode ).
   *
-  * @param  None
+  * @param  hciReadPacket The verified HCI event packet
+  * @retval HCI_RX_LANE_BULK or HCI_RX_LANE_HIGH
+  */
+static uint8_t rx_lane(const tHciDataPacket * hciReadPacket)
+{
+  const uint8_t *hci_pckt = hciReadPacket->dataBuff;
+  uint16_t ecode;
+
+  if (hci_pckt[1] == EVT_LE_META_EVENT)
+  {
+    /* LE Advertising Report, LE Direct Advertising Report */
+    if ((hci_pckt[3] == EVT_LE_ADVERTISING_REPORT) || (hci_pckt[3] == 0x0B))
+      return HCI_RX_LANE_BULK;
+  }
+  else if (hci_pckt[1] == EVT_VENDOR)
+  {
+    /* Attribute Modified, Indication, Notification */
+    ecode = hci_pckt[3] | (hci_pckt[4] << 8);
+    if ((ecode == 0x0C01) || (ecode == 0x0C0E) || (ecode == 0x0C0F))
+      return HCI_RX_LANE_BULK;
+  }
+
+  return HCI_RX_LANE_HIGH;
+}
+
+/**
+  * @brief  Whether a bulk event may be lost: advertising reports are
+  *         repeated and a notification is superseded by the next one, an
+  *         indication or an attribute write is not.
+  *
+  * @param  hciReadPacket The verified HCI event packet, in the bulk lane
+  * @retval TRUE for LE ( Direct ) Advertising Reports and notifications
+  */
+static BOOL rx_droppable(const tHciDataPacket * hciReadPacket)
+{
+  const uint8_t *hci_pckt = hciReadPacket->dataBuff;
+
+  if (hci_pckt[1] == EVT_LE_META_EVENT)
+    return TRUE;
+
+  /* Notification */
+  return ((hci_pckt[3] | (hci_pckt[4] << 8)) == 0x0C0F);
+}
+
+/**
+  * @brief  Move an event out of the reserve packet so the reserve stays
+  *         available to the pending command's completion: into a free packet
+  *         of the pool, else in place of the oldest droppable bulk event
+  *         large enough, which is dropped.
+  *
+  * @param  reserve The reserve packet, holding a verified event
+  * @retval The packet now holding the event, the reserve itself if none
+  *         could be found
+  */
+static tHciDataPacket *rx_reserve_release(tHciDataPacket *reserve)
+{
+  tHciDataPacket *pckt = NULL;
+  tListNode *node;
+  uint32_t primask;
+  uint8_t cls;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  for (cls = 0; (cls < HCI_PKT_CLASS_NUM) && (pckt == NULL); cls++)
+  {
+    if ((hciPktClassSize[cls] >= reserve->data_len) && !list_is_empty(&hciReadPktPool[cls]))
+    {
+      list_remove_head(&hciReadPktPool[cls], (tListNode **)&pckt);
+    }
+  }
+
+  for (list_get_next_node(&hciReadPktBulkQueue, &node); (pckt == NULL) && (node != &hciReadPktBulkQueue);
+       list_get_next_node(node, &node))
+  {
+    if ((((tHciDataPacket *)node)->size >= reserve->data_len) && rx_droppable((tHciDataPacket *)node))
+    {
+      list_remove_node(node);
+      hciRxBulkDepth--;
+      hciRxStats.lane[HCI_RX_LANE_BULK].dropped++;
+      pckt = (tHciDataPacket *)node;
+    }
+  }
+
+  if (pckt != NULL)
+  {
+    BLUENRG_memcpy(pckt->dataBuff, reserve->dataBuff, reserve->data_len);
+    pckt->data_len = reserve->data_len;
+    pckt->lane = reserve->lane;
+    pckt->rx_stamp = reserve->rx_stamp;
+    pool_free(reserve);
+    hciRxStats.reserveMoved++;
+  }
+  else
+  {
+    pckt = reserve;
+    hciRxStats.reserveHeld++;
+  }
+
+  __set_PRIMASK(primask);
+
+  return pckt;
+}
+
+/**
+  * @brief  Queue a received event in its lane. Bulk traffic goes through
+  *         the receive filter first. Once the bulk lane is full, droppable
+  *         events are dropped and the others queued over the quota: the pool
+  *         running out then holds the BlueNRG off. The reserve packet is kept
+  *         for the high lane, where the completion arrives: a bulk event read
+  *         into it is dropped if droppable, moved out otherwise. HCI ISR.
+  *
+  * @param  hciReadPacket The verified HCI event packet
   * @retval None
   */
-static void free_event_list(void)
+static void rx_enqueue(tHciDataPacket * hciReadPacket)
+{
+  tHciRxLaneStats *lane_stats;
+  uint16_t len;
+
+  hciReadPacket->lane = rx_lane(hciReadPacket);
+  lane_stats = &hciRxStats.lane[hciReadPacket->lane];
+
+  if (hciReadPacket->lane == HCI_RX_LANE_BULK)
+  {
+    if (hciContext.RxFilter != NULL)
+    {
+      len = hciContext.RxFilter(hciReadPacket->dataBuff, hciReadPacket->data_len);
+      if (len == 0)
+      {
+        lane_stats->filtered++;
+        pool_free(hciReadPacket);
+        return;
+      }
+      hciReadPacket->data_len = len;
+    }
+
+    if (hciReadPacket->pool == HCI_PKT_RESERVE)
+    {
+      if (rx_droppable(hciReadPacket))
+      {
+        lane_stats->dropped++;
+        pool_free(hciReadPacket);
+        return;
+      }
+      hciReadPacket = rx_reserve_release(hciReadPacket);
+    }
+
+    /* Packets of any size class are counted, see HCI_RX_HIGH_RESERVE */
+    if (hciRxBulkDepth >= HCI_READ_PACKET_NUM_MAX - HCI_RX_HIGH_RESERVE)
+    {
+      if (rx_droppable(hciReadPacket))
+      {
+        lane_stats->dropped++;
+        pool_free(hciReadPacket);
+        return;
+      }
+      lane_stats->overQuota++;
+    }
+    hciRxBulkDepth++;
+    lane_stats->depthMax = MAX(lane_stats->depthMax, hciRxBulkDepth);
+  }
+
+  lane_stats->queued++;
+  hciReadPacket->rx_stamp = HSTAT_CYCLES();
+  list_insert_tail(hciRxLaneQueue[hciReadPacket->lane], (tListNode *)hciReadPacket);
+}
+
+/**
+  * @brief  Take the oldest event of the high lane, else of the bulk lane,
+  *         and account its residency. Task context.
+  *
+  * @param  None
+  * @retval The packet, NULL if both lanes are empty
+  */
+static tHciDataPacket *rx_dequeue(void)
 {
-  tHciDataPacket * pckt;
+  tHciDataPacket *pckt = NULL;
+  tHciRxLaneStats *lane_stats;
+  uint32_t us, primask;
+  uint8_t lane;
 
-  while(list_get_size(&hciReadPktPool) < HCI_READ_PACKET_NUM_MAX/2){
-    list_remove_head(&hciReadPktRxQueue, (tListNode **)&pckt);    
-    list_insert_tail(&hciReadPktPool, (tListNode *)pckt);
+  for (lane = 0; (lane < HCI_RX_LANE_NUM) && (pckt == NULL); lane++)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (!list_is_empty(hciRxLaneQueue[lane]))
+    {
+      list_remove_head(hciRxLaneQueue[lane], (tListNode **)&pckt);
+      hciRxBulkDepth -= (lane == HCI_RX_LANE_BULK);
+    }
+    __set_PRIMASK(primask);
+  }
+
+  if (pckt != NULL)
+  {
+    us = SystemCoreClock / 1000000UL;
+    us = (HSTAT_CYCLES() - pckt->rx_stamp) / ((us != 0) ? us : 1);
+    lane_stats = &hciRxStats.lane[pckt->lane];
+    lane_stats->processed++;
+    lane_stats->residencyTotalUs += us;
+    lane_stats->residencyMaxUs = MAX(lane_stats->residencyMaxUs, us);
+  }
+
+  return pckt;
+}
+
+/**
+  * @brief  Restart the reads left pending by hci_notify_asynch_evt() for lack
+  *         of a packet. The BlueNRG IRQ line stays high meanwhile, so no new
+  *         edge would do it. Task context, after packets have been freed.
+  *
+  * @param  None
+  * @retval None
+  */
+static void rx_resume(void)
+{
+  if (hciRxThrottled)
+  {
+    hciRxThrottled = FALSE;
+    hciRxStats.resumes++;
+    hci_tl_lowlevel_resume();
   }
 }
 
@@ -131,7 +420,9 @@ static void free_event_list(void)
 
 void hci_init(void(* UserEvtRx)(void* pData), void* pConf)
 {
-  uint8_t index;
+  uint8_t index = 0;
+  uint8_t cls, n;
+  uint8_t *data = hciReadPacketData;
 
   if(UserEvtRx != NULL)
   {
@@ -139,23 +430,43 @@ void hci_init(void(* UserEvtRx)(void* pData), void* pConf)
   }
   
   /* Initialize list heads of ready and free hci data packet queues */
-  list_init_head(&hciReadPktPool);
+  for (cls = 0; cls < HCI_PKT_CLASS_NUM; cls++)
+  {
+    list_init_head(&hciReadPktPool[cls]);
+  }
   list_init_head(&hciReadPktRxQueue);
+  list_init_head(&hciReadPktBulkQueue);
 
   /* Initialize TL BLE layer */
   hci_tl_lowlevel_init();
 
-  /* Initialize the queue of free hci data packets */
-  for (index = 0; index < HCI_READ_PACKET_NUM_MAX; index++)
+  /* Initialize the queues of free hci data packets, carving each class' storage */
+  for (cls = 0; cls < HCI_PKT_CLASS_NUM; cls++)
   {
-    list_insert_tail(&hciReadPktPool, (tListNode *)&hciReadPacketBuffer[index]);
-  } 
+    for (n = 0; n < hciPktClassNum[cls]; n++, index++)
+    {
+      hciReadPacketBuffer[index].dataBuff = data;
+      hciReadPacketBuffer[index].size = hciPktClassSize[cls];
+      hciReadPacketBuffer[index].pool = cls;
+      data += hciPktClassSize[cls];
+      list_insert_tail(&hciReadPktPool[cls], (tListNode *)&hciReadPacketBuffer[index]);
+    }
+  }
+  hciReservePacket.dataBuff = hciReservePacketData;
+  hciReservePacket.size = HCI_PKT_RESERVE_SIZE;
+  hciReservePacket.pool = HCI_PKT_RESERVE;
+  hciReserveFree = &hciReservePacket;
   
   /* Initialize low level driver */
   if (hciContext.io.Init)  hciContext.io.Init(NULL);
   if (hciContext.io.Reset) hciContext.io.Reset();
 }
 
+uint8_t *hci_get_cmd_buffer(void)
+{
+  return hciCmdBuffer + HCI_HDR_SIZE + HCI_COMMAND_HDR_SIZE;
+}
+
 void hci_register_io_bus(tHciIO* fops)
 {
   /* Register bus function */
@@ -164,9 +475,30 @@ void hci_register_io_bus(tHciIO* fops)
   hciContext.io.Send    = fops->Send;
   hciContext.io.GetTick = fops->GetTick;
   hciContext.io.Reset   = fops->Reset;
+  hciContext.io.ReceiveLen  = fops->ReceiveLen;
+  hciContext.io.ReceiveData = fops->ReceiveData;
 }
 
 int hci_send_req(struct hci_request* r, BOOL async)
+{
+  int ret;
+
+  PROF_ENTER(PROF_ZONE_HCI_SEND_REQ);
+  ret = send_req(r, async);
+  PROF_EXIT(PROF_ZONE_HCI_SEND_REQ);
+  PROF_EXIT_AS(PROF_ZONE_HCI_SEND_REQ, PROF_aciZone(r->ogf, r->ocf));
+
+  return ret;
+}
+
+/**
+  * @brief  Send an HCI command and wait for its completion event.
+  *
+  * @param  r The HCI request
+  * @param  async TRUE to return once the command is sent
+  * @retval 0: success, -1: timeout, error status or hardware error
+  */
+static int send_req(struct hci_request* r, BOOL async)
 {
   uint8_t *ptr;
   uint16_t opcode = htobs(cmd_opcode_pack(r->ogf, r->ocf));
@@ -175,15 +507,27 @@ int hci_send_req(struct hci_request* r, BOOL async)
 
   tHciDataPacket * hciReadPacket = NULL;
   tListNode hciTempQueue;
+
+  /* Per-opcode accounting */
+  uint32_t stat_start;
+  uint8_t stat_result = HSTAT_FAILED;
+  uint8_t stat_diverted = 0;
+  uint8_t stat_dropped = 0;
+  uint32_t bulk_dropped;
   
   list_init_head(&hciTempQueue);
 
-  free_event_list();
+  /* Queued events are kept for the application: the completion goes to the
+     reserve packet if every other packet is taken */
+  hciCmdPending = !async;
+  rx_resume();
   
+  stat_start = HSTAT_CYCLES();
   send_cmd(r->ogf, r->ocf, r->clen, r->cparam);
   
   if (async)
   {
+    HSTAT_record(r->ogf, r->ocf, HSTAT_ASYNC, HSTAT_CYCLES() - stat_start, 0, 0);
     return 0;
   }
   
@@ -200,6 +544,7 @@ int hci_send_req(struct hci_request* r, BOOL async)
     {
       if ((HAL_GetTick() - tickstart) > HCI_DEFAULT_TIMEOUT_MS)
       {
+        stat_result = HSTAT_TIMEOUT;
         goto failed;
       }
       
@@ -272,36 +617,42 @@ int hci_send_req(struct hci_request* r, BOOL async)
       }
     }
     
-    /* If there are no more packets to be processed, be sure there is at list one
-       packet in the pool to process the expected event.
-       If no free packets are available, discard the processed event and insert it
-       into the pool. */
-    if (list_is_empty(&hciReadPktPool) && list_is_empty(&hciReadPktRxQueue)) {
-      list_insert_tail(&hciReadPktPool, (tListNode *)hciReadPacket);
-      hciReadPacket=NULL;
+    /* An unrelated event read into the reserve packet is moved out of it,
+       so the completion still finds the reserve free. The move may drop a
+       droppable bulk event, never this one. */
+    if (hciReadPacket->pool == HCI_PKT_RESERVE) {
+      bulk_dropped = hciRxStats.lane[HCI_RX_LANE_BULK].dropped;
+      hciReadPacket = rx_reserve_release(hciReadPacket);
+      stat_dropped += (hciRxStats.lane[HCI_RX_LANE_BULK].dropped != bulk_dropped) && (stat_dropped < 0xFF);
+      if (hciReadPacket->pool != HCI_PKT_RESERVE)
+        rx_resume();
     }
-    else {
-      /* Insert the packet in a different queue. These packets will be
-      inserted back in the main queue just before exiting from send_req(), so that
-      these events can be processed by the application.
+
+    /* Insert the packet in a different queue. These packets will be
+       inserted back in the main queue just before exiting from send_req(), so that
+       these events can be processed by the application.
     */
     list_insert_tail(&hciTempQueue, (tListNode *)hciReadPacket);
-      hciReadPacket=NULL;
-    }
+    hciReadPacket=NULL;
+    stat_diverted += (stat_diverted < 0xFF);
   }
   
 failed: 
+  hciCmdPending = FALSE;
   if (hciReadPacket!=NULL) {
-    list_insert_head(&hciReadPktPool, (tListNode *)hciReadPacket);
+    pool_free(hciReadPacket);
   }
   move_list(&hciReadPktRxQueue, &hciTempQueue);
+  HSTAT_record(r->ogf, r->ocf, stat_result, HSTAT_CYCLES() - stat_start, stat_diverted, stat_dropped);
 
   return -1;
   
 done:
+  hciCmdPending = FALSE;
   /* Insert the packet back into the pool.*/
-  list_insert_head(&hciReadPktPool, (tListNode *)hciReadPacket); 
+  pool_free(hciReadPacket);
   move_list(&hciReadPktRxQueue, &hciTempQueue);
+  HSTAT_record(r->ogf, r->ocf, HSTAT_OK, HSTAT_CYCLES() - stat_start, stat_diverted, stat_dropped);
 
   return 0;
 }
@@ -310,54 +661,102 @@ void hci_user_evt_proc(void)
 {
   tHciDataPacket * hciReadPacket = NULL;
      
-  /* process any pending events read */
-  while (list_is_empty(&hciReadPktRxQueue) == FALSE)
+  /* process any pending events read, high lane first */
+  while ((hciReadPacket = rx_dequeue()) != NULL)
   {
-    list_remove_head (&hciReadPktRxQueue, (tListNode **)&hciReadPacket);
-
     if (hciContext.UserEvtRx != NULL)
     {
       hciContext.UserEvtRx(hciReadPacket->dataBuff);
     }
 
-    list_insert_tail(&hciReadPktPool, (tListNode *)hciReadPacket);
+    pool_free(hciReadPacket);
+    rx_resume();
   }
 }
 
+BOOL hci_rx_throttled(void)
+{
+  return hciRxThrottled;
+}
+
+void hci_get_rx_stats(tHciRxStats *stats)
+{
+  *stats = hciRxStats;
+}
+
+void hci_register_rx_filter(tHciRxFilter filter)
+{
+  hciContext.RxFilter = filter;
+}
+
 int32_t hci_notify_asynch_evt(void* pdata)
 {
   tHciDataPacket * hciReadPacket = NULL;
-  uint8_t data_len;
+  int32_t data_len;
   
   int32_t ret = 0;
+
+  PROF_ENTER(PROF_ZONE_HCI_ASYNCH_EVT);
   
-  if (list_is_empty (&hciReadPktPool) == FALSE)
+  if (hciContext.io.ReceiveLen && hciContext.io.ReceiveData)
   {
-    /* Queuing a packet to read */
-    list_remove_head (&hciReadPktPool, (tListNode **)&hciReadPacket);
-    
-    if (hciContext.io.Receive)
+    /* Size the packet from the length announced by the bus */
+    data_len = hciContext.io.ReceiveLen();
+    if (data_len > 0)
     {
-      data_len = hciContext.io.Receive(hciReadPacket->dataBuff, HCI_READ_PACKET_SIZE);
-      if (data_len > 0)
-      {                    
-        hciReadPacket->data_len = data_len;
-        if (verify_packet(hciReadPacket) == 0)
-          list_insert_tail(&hciReadPktRxQueue, (tListNode *)hciReadPacket);
-        else
-          list_insert_head(&hciReadPktPool, (tListNode *)hciReadPacket);          
-      }
-      else 
+      hciReadPacket = pool_alloc(data_len);
+    }
+
+    if (hciReadPacket != NULL)
+    {
+      data_len = hciContext.io.ReceiveData(hciReadPacket->dataBuff, hciReadPacket->size);
+    }
+    else
+    {
+      /* Nothing to read, or no free packet: the data stays pending */
+      hciContext.io.ReceiveData(NULL, 0);
+      ret = (data_len > 0);
+      if (ret)
       {
-        /* Insert the packet back into the pool*/
-        list_insert_head(&hciReadPktPool, (tListNode *)hciReadPacket);
+        hciRxThrottled = TRUE;
+        hciRxStats.stalls++;
       }
     }
   }
-  else 
+  else if (hciContext.io.Receive)
   {
-    ret = 1;
+    /* Bus without a length query: the largest class holds any packet */
+    hciReadPacket = pool_alloc(HCI_READ_PACKET_SIZE);
+    if (hciReadPacket != NULL)
+    {
+      data_len = hciContext.io.Receive(hciReadPacket->dataBuff, hciReadPacket->size);
+    }
+    else
+    {
+      hciRxThrottled = TRUE;
+      hciRxStats.stalls++;
+      ret = 1;
+    }
+  }
+
+  if (hciReadPacket != NULL)
+  {
+    if (data_len > 0)
+    {                    
+      hciReadPacket->data_len = data_len;
+      if (verify_packet(hciReadPacket) == 0)
+        rx_enqueue(hciReadPacket);
+      else
+        pool_free(hciReadPacket);
+    }
+    else 
+    {
+      /* Insert the packet back into the pool*/
+      pool_free(hciReadPacket);
+    }
   }
+
+  PROF_EXIT(PROF_ZONE_HCI_ASYNCH_EVT);
   return ret;
   
 }
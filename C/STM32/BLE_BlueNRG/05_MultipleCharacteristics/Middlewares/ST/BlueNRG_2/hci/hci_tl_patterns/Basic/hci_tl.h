@@ -46,6 +46,11 @@
  * @brief Structure hosting the HCI request
  * @{
  */ 
+/**
+ * @brief Size of the command parameter area ( cmd_buffer of the ACI wrappers )
+ */
+#define HCI_CMD_BUFFER_SIZE   258
+
 struct hci_request {
   uint16_t ogf;     /**< Opcode Group Field */
   uint16_t ocf;     /**< Opcode Command Field */
@@ -59,6 +64,55 @@ struct hci_request {
  * @}
  */
  
+/**
+ * @brief Read packet size classes ( bluenrg_conf.h ). hci_notify_asynch_evt()
+ *        takes the smallest free packet holding the length announced by the
+ *        SPI header.
+ */
+#ifndef HCI_PKT_CLASS0_SIZE
+  #define HCI_PKT_CLASS0_SIZE   32
+  #define HCI_PKT_CLASS0_NUM    4
+  #define HCI_PKT_CLASS1_SIZE   64
+  #define HCI_PKT_CLASS1_NUM    4
+  #define HCI_PKT_CLASS2_SIZE   HCI_READ_PACKET_SIZE
+  #define HCI_PKT_CLASS2_NUM    2
+#endif
+#define HCI_PKT_CLASS_NUM       3
+
+/**
+ * @brief Reserve packet, outside the classes. It is only read into while
+ *        hci_send_req() waits for a completion, so Command Complete / Status
+ *        is received even when the application holds every other packet.
+ *        A bulk event read into it is dropped, or moved out in place of a
+ *        droppable one, so the reserve is not left in the bulk lane.
+ */
+#ifndef HCI_PKT_RESERVE_SIZE
+  #define HCI_PKT_RESERVE_SIZE  64
+#endif
+#define HCI_PKT_RESERVE         HCI_PKT_CLASS_NUM   /**< pool value of the reserve packet */
+
+/**
+ * @brief Receive lanes. Events are classified once read: bulk traffic
+ *        ( advertising reports, notifications, indications, attribute
+ *        modified ) is queued apart and handed to the application after the
+ *        high lane. Once the bulk lane holds
+ *        HCI_READ_PACKET_NUM_MAX - HCI_RX_HIGH_RESERVE packets, further
+ *        advertising reports and notifications are dropped. Indications and
+ *        attribute modified events are never dropped: they are queued over
+ *        the quota, and when no packet is left the read stays pending in the
+ *        BlueNRG ( back-pressure, see hci_rx_throttled() ).
+ *        HCI_RX_HIGH_RESERVE is a count of packets across all size classes,
+ *        not a reserve per class: bulk events may have taken every packet of
+ *        the 64 and 260 byte classes, so a larger high lane event may find
+ *        only smaller packets free and wait in the BlueNRG meanwhile.
+ */
+#define HCI_RX_LANE_HIGH        0
+#define HCI_RX_LANE_BULK        1
+#define HCI_RX_LANE_NUM         2
+#ifndef HCI_RX_HIGH_RESERVE
+  #define HCI_RX_HIGH_RESERVE   4
+#endif
+
 /**
  * @brief Structure used to read received HCI data packet
  * @{
@@ -66,13 +120,46 @@ struct hci_request {
 typedef struct _tHciDataPacket
 {
   tListNode currentNode;
-  uint8_t dataBuff[HCI_READ_PACKET_SIZE];
-  uint8_t data_len;
+  uint8_t *dataBuff;    /**< Storage of the packet's size class */
+  uint16_t size;        /**< Bytes available in dataBuff */
+  uint16_t data_len;
+  uint8_t pool;         /**< Size class, index of the free list the packet returns to */
+  uint8_t lane;         /**< Receive lane, HCI_RX_LANE_x */
+  uint32_t rx_stamp;    /**< Cycle count when queued, for the lane residency */
 } tHciDataPacket;
 /**
  * @}
  */
 
+/**
+ * @brief Receive path statistics, see hci_get_rx_stats()
+ * @{
+ */
+typedef struct
+{
+  uint32_t queued;          /**< Events queued in the lane */
+  uint32_t dropped;         /**< Advertising reports and notifications dropped, lane full ( bulk lane only ) */
+  uint32_t overQuota;       /**< Indications and attribute modified events queued in a full lane ( bulk lane only ) */
+  uint32_t filtered;        /**< Events discarded by the receive filter ( bulk lane only ) */
+  uint32_t processed;       /**< Events handed to the application by hci_user_evt_proc() */
+  uint32_t residencyMaxUs;  /**< Longest time queued before being handed over */
+  uint64_t residencyTotalUs;
+  uint16_t depthMax;        /**< Deepest queue seen ( bulk lane only ) */
+} tHciRxLaneStats;
+
+typedef struct
+{
+  tHciRxLaneStats lane[HCI_RX_LANE_NUM];
+  uint32_t stalls;          /**< Reads left pending in the BlueNRG for lack of a free packet */
+  uint32_t resumes;         /**< Reads restarted by hci_user_evt_proc() once packets were freed */
+  uint32_t reserveUsed;     /**< Events read into the reserve packet */
+  uint32_t reserveMoved;    /**< Events moved out of the reserve packet into another one */
+  uint32_t reserveHeld;     /**< Events left in the reserve, no packet to move them to: the completion waits for one */
+} tHciRxStats;
+/**
+ * @}
+ */
+
 /**
  * @brief Structure used to manage the BUS IO operations.
  *        All the structure fields will point to functions defined at user level.
@@ -87,6 +174,8 @@ typedef struct
   int32_t (* Send)    (uint8_t*, uint16_t); /**< Pointer to HCI TL function for the IO Bus data transmission */
   int32_t (* DataAck) (uint8_t*, uint16_t* len); /**< Pointer to HCI TL function for the IO Bus data ack reception */	
   int32_t (* GetTick) (void); /**< Pointer to BSP function for getting the HAL time base timestamp */    
+  int32_t (* ReceiveLen)  (void); /**< Opens a read and returns the byte count announced by the bus, 0 if none */
+  int32_t (* ReceiveData) (uint8_t*, uint16_t); /**< Reads up to size announced bytes and closes the read, size 0 leaves them pending */
 } tHciIO;
 /**
  * @}
@@ -105,6 +194,11 @@ typedef enum
  * @}
  */
  
+/**
+ * @brief Receive filter, see hci_register_rx_filter()
+ */
+typedef uint16_t (* tHciRxFilter) (uint8_t *pckt, uint16_t len);
+
 /**
  * @brief Contain the HCI context
  * @{
@@ -113,6 +207,7 @@ typedef struct
 {   
   tHciIO io; /**< Manage the BUS IO operations */
   void (* UserEvtRx) (void * pData); /**< ACI events callback function pointer */
+  tHciRxFilter RxFilter; /**< Bulk events filter, called from the HCI ISR, NULL if none */
 } tHciContext;
 
 /**
@@ -135,7 +230,49 @@ typedef struct
   * @retval int: 0 when success, -1 when failure
   */
 int hci_send_req(struct hci_request *r, BOOL async);
+
+/**
+  * @brief  Parameter area of the shared command buffer. The ACI wrappers build
+  *         their parameters here, right behind the reserved packet header, so
+  *         hci_send_req() sends them without copying. Valid until the next
+  *         command: call from task context only, one command at a time.
+  *
+  * @param  None
+  * @retval uint8_t*: HCI_CMD_BUFFER_SIZE bytes for the command parameters
+  */
+uint8_t *hci_get_cmd_buffer(void);
  
+/**
+  * @brief  Back-pressure: TRUE while events wait in the BlueNRG because every
+  *         packet is queued for the application. hci_user_evt_proc() drains
+  *         them as it frees packets; the application may skip work that
+  *         generates more events meanwhile.
+  *
+  * @param  None
+  * @retval BOOL: TRUE if throttled
+  */
+BOOL hci_rx_throttled(void);
+
+/**
+  * @brief  Copy of the receive path statistics.
+  *
+  * @param  stats: Filled with the counters
+  * @retval None
+  */
+void hci_get_rx_stats(tHciRxStats *stats);
+
+/**
+  * @brief  Register a filter run from the HCI ISR on every bulk lane event,
+  *         before it is queued. It may rewrite the packet in place ( e.g.
+  *         remove reports ) and returns the bytes kept, 0 to discard the
+  *         event. A discarded event frees its packet at once and never
+  *         counts against the bulk lane.
+  *
+  * @param  filter: The filter, NULL to remove it
+  * @retval None
+  */
+void hci_register_rx_filter(tHciRxFilter filter);
+
 /**
  * @brief  Register IO bus services.
  *         The tHciIO structure is initialized here by assigning to each structure field a  
@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file    aci_marshal.h
+  * @author  Zafeer Abbasi
+  * @brief   Table driven encoder / decoder for ACI and HCI commands
+  ******************************************************************************
+  * @attention
+  *
+  * Each command is described by a const descriptor: its opcode, the width of
+  * every parameter and the layout of the response behind the Status byte.
+  * aci_marshal_send() encodes the arguments straight into the shared command
+  * buffer, sends the request and decodes the response into the output
+  * pointers. The public ACI / HCI function signatures stay the same.
+  *
+  * Scope: only the commands the application calls are table driven ( the
+  * list is in aci_marshal.c ). The other generated wrappers are left as they
+  * are: --gc-sections drops them from the image, so converting them would
+  * not save flash. A command moves to the table when the application starts
+  * using it. With the ten commands converted so far the gain is modest:
+  * about 5% of the ACI flash, for an encode a few percent slower than the
+  * generated code ( test_aci_marshal, test_encodeBenchmark ). The table pays
+  * off as more commands move to it. scripts/aci_size.py reports the ACI flash
+  * after each link, and env:nucleo_f411re_aci_generated builds the same
+  * firmware with ACI_MARSHAL_TABLE=0 for comparison.
+  *
+  ******************************************************************************
+  */
+#ifndef ACI_MARSHAL_H
+#define ACI_MARSHAL_H
+
+#include <stdint.h>
+#include "ble_types.h"
+
+/**
+ * @brief 1: the commands implemented in aci_marshal.c use the descriptor
+ *        engine, their generated versions are compiled out.
+ *        0: the generated code is used for every command.
+ */
+#ifndef ACI_MARSHAL_TABLE
+  #define ACI_MARSHAL_TABLE       1
+#endif
+
+/**
+ * @brief Field codes of a descriptor, one per argument, ACI_F_END terminated
+ */
+#define ACI_F_END                 0x00  /**< End of the field list */
+#define ACI_F_U8                  0x01  /**< Integer, little endian */
+#define ACI_F_U16                 0x02
+#define ACI_F_U32                 0x04
+#define ACI_F_VAR                 0x10  /**< Bytes from a pointer, count is the previous argument */
+#define ACI_F_UUID                0x20  /**< UUID from a pointer, previous argument is its type ( 1: 16 bit, 2: 128 bit ) */
+#define ACI_F_FIXED(n)            (0x40 | (n))  /**< n ( < 64 ) bytes from a pointer, e.g. a device address */
+
+/**
+ * @brief Descriptor flags
+ */
+#define ACI_D_CMD_STATUS          0x01  /**< Completes with Command Status instead of Command Complete */
+
+/**
+ * @brief Largest response ( Status included ) a descriptor may describe
+ */
+#define ACI_MARSHAL_RSP_MAX       32
+
+/**
+ * @brief Command Descriptor
+ */
+typedef struct
+{
+  uint16_t ocf;             /**< Opcode Command Field */
+  uint8_t  ogf;             /**< Opcode Group Field */
+  uint8_t  flags;           /**< ACI_D_ flags */
+  const uint8_t *cmd;       /**< Parameter fields, one argument each */
+  const uint8_t *rsp;       /**< Response fields after Status, one output pointer each, NULL if Status only */
+} aci_cmd_desc_t;
+
+/**
+  * @brief  Encode, send and decode one command.
+  *
+  * @param  desc: Command descriptor
+  * @param  args: Parameter values ( pointers for ACI_F_VAR / UUID / FIXED ),
+  *         followed by one output pointer per response field
+  * @retval tBleStatus: BLE_STATUS_SUCCESS, the command status,
+  *         BLE_STATUS_TIMEOUT, BLE_STATUS_ERROR ( bad UUID type ) or
+  *         BLE_STATUS_INVALID_PARAMS ( parameters over
+  *         HCI_MAX_PAYLOAD_SIZE bytes )
+  */
+tBleStatus aci_marshal_send(const aci_cmd_desc_t *desc, const uintptr_t *args);
+
+#endif /* ACI_MARSHAL_H */
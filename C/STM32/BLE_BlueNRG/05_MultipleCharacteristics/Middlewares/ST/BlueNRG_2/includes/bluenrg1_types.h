@@ -21,6 +21,7 @@
 #include "compiler.h"
 #include "ble_const.h"
 #include "ble_types.h"
+#include "bluenrg_events_conf.h"
 
 typedef uint8_t tBleStatus;
 
@@ -30,9 +31,27 @@ typedef struct hci_command_table_type_s {
   hci_event_process process;
 } hci_events_table_type, hci_le_meta_events_table_type, hci_vendor_specific_events_table_type;
 
-extern const hci_events_table_type hci_events_table[7];
-extern const hci_le_meta_events_table_type hci_le_meta_events_table[10];
-extern const hci_vendor_specific_events_table_type hci_vendor_specific_events_table[43];
+#define BLE_EVENTS_COUNT_ONE(code, name) + 1
+#if BLE_EVENTS_PRUNE
+#define HCI_EVENTS_TABLE_SIZE                   (0 BLE_CONF_HCI_EVENTS(BLE_EVENTS_COUNT_ONE))
+#define HCI_LE_META_EVENTS_TABLE_SIZE           (0 BLE_CONF_LE_META_EVENTS(BLE_EVENTS_COUNT_ONE))
+#define HCI_VENDOR_SPECIFIC_EVENTS_TABLE_SIZE   (0 BLE_CONF_VS_EVENTS(BLE_EVENTS_COUNT_ONE))
+#else
+#define HCI_EVENTS_TABLE_SIZE                   7
+#define HCI_LE_META_EVENTS_TABLE_SIZE           10
+#define HCI_VENDOR_SPECIFIC_EVENTS_TABLE_SIZE   43
+#endif
+
+/* An empty event list leaves no table: a zero length array is not valid C */
+#if HCI_EVENTS_TABLE_SIZE > 0
+extern const hci_events_table_type hci_events_table[HCI_EVENTS_TABLE_SIZE];
+#endif
+#if HCI_LE_META_EVENTS_TABLE_SIZE > 0
+extern const hci_le_meta_events_table_type hci_le_meta_events_table[HCI_LE_META_EVENTS_TABLE_SIZE];
+#endif
+#if HCI_VENDOR_SPECIFIC_EVENTS_TABLE_SIZE > 0
+extern const hci_vendor_specific_events_table_type hci_vendor_specific_events_table[HCI_VENDOR_SPECIFIC_EVENTS_TABLE_SIZE];
+#endif
 #include <stdint.h>
 /** Documentation for C struct Whitelist_Entry_t */
 typedef PACKED(struct) packed_Whitelist_Entry_t_s {
@@ -0,0 +1,108 @@
+/**
+  ******************************************************************************
+  * @file    hci_evt_view.h
+  * @author  Zafeer Abbasi
+  * @brief   Zero copy, bounds checked views over received HCI events
+  ******************************************************************************
+  * @attention
+  *
+  * A view points straight into tHciDataPacket.dataBuff, at the parameters
+  * following the event code, and carries their length as received. Handlers
+  * listed in BLE_CONF_VS_EVENT_VIEWS ( bluenrg_events_conf.h ) get the view
+  * instead of the unpacked scalar arguments of the generated callbacks.
+  *
+  * Lifetime: the view, and every pointer obtained from it, is only valid
+  * until the handler returns. hci_user_evt_proc() then puts the packet back
+  * in hciReadPktPool, where the next SPI read overwrites it. Copy out whatever
+  * is needed later.
+  *
+  ******************************************************************************
+  */
+#ifndef HCI_EVT_VIEW_H
+#define HCI_EVT_VIEW_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "bluenrg1_types.h"
+
+/**
+ * @brief View over the parameters of one event
+ */
+typedef struct
+{
+  const uint8_t *data;      /**< First parameter byte, inside the packet buffer */
+  uint16_t len;             /**< Parameter bytes received */
+} hci_evt_view_t;
+
+typedef void (*hci_evt_view_handler)(const hci_evt_view_t *view);
+
+typedef struct
+{
+  uint16_t evt_code;
+  hci_evt_view_handler handler;
+} hci_evt_view_table_type;
+
+/* View handlers declared and tabled from bluenrg_events_conf.h */
+#define BLE_EVENTS_VIEW_DECL(code, name) void name(const hci_evt_view_t *view);
+BLE_CONF_VS_EVENT_VIEWS(BLE_EVENTS_VIEW_DECL)
+
+#define HCI_VENDOR_SPECIFIC_VIEWS_TABLE_SIZE    (0 BLE_CONF_VS_EVENT_VIEWS(BLE_EVENTS_COUNT_ONE))
+#if HCI_VENDOR_SPECIFIC_VIEWS_TABLE_SIZE > 0
+extern const hci_evt_view_table_type hci_vendor_specific_views_table[HCI_VENDOR_SPECIFIC_VIEWS_TABLE_SIZE];
+#endif
+
+/********************** Accessors *****************************/
+
+/**
+  * @brief  Pointer to n bytes at offset off, NULL if the event is too short.
+  */
+static inline const uint8_t *hci_view_ptr(const hci_evt_view_t *view, uint16_t off, uint16_t n)
+{
+  return ((uint32_t)off + n <= view->len) ? view->data + off : NULL;
+}
+
+/**
+  * @brief  Little endian integers at offset off, 0 if the event is too short.
+  */
+static inline uint8_t hci_view_u8(const hci_evt_view_t *view, uint16_t off)
+{
+  return (off < view->len) ? view->data[off] : 0;
+}
+
+static inline uint16_t hci_view_u16(const hci_evt_view_t *view, uint16_t off)
+{
+  const uint8_t *p = hci_view_ptr(view, off, 2);
+  return p ? (uint16_t)(p[0] | (p[1] << 8)) : 0;
+}
+
+/********************** Typed views *****************************/
+
+/**
+  * @brief  Typed views: the packed event layout laid over the view, NULL
+  *         unless the fixed part and the announced variable part were both
+  *         received. Fields are read in place, nothing is copied.
+  */
+static inline const aci_gatt_attribute_modified_event_rp0 *aci_gatt_attribute_modified_view(const hci_evt_view_t *view)
+{
+  if (hci_view_ptr(view, 0, 8) == NULL)
+    return NULL;
+  if (hci_view_ptr(view, 8, hci_view_u16(view, 6)) == NULL)
+    return NULL;
+  return (const aci_gatt_attribute_modified_event_rp0 *)view->data;
+}
+
+static inline const aci_gatt_notification_event_rp0 *aci_gatt_notification_view(const hci_evt_view_t *view)
+{
+  if (hci_view_ptr(view, 0, 5) == NULL)
+    return NULL;
+  if (hci_view_ptr(view, 5, hci_view_u8(view, 4)) == NULL)
+    return NULL;
+  return (const aci_gatt_notification_event_rp0 *)view->data;
+}
+
+static inline const aci_gatt_read_permit_req_event_rp0 *aci_gatt_read_permit_req_view(const hci_evt_view_t *view)
+{
+  return (const aci_gatt_read_permit_req_event_rp0 *)hci_view_ptr(view, 0, sizeof(aci_gatt_read_permit_req_event_rp0));
+}
+
+#endif /* HCI_EVT_VIEW_H */
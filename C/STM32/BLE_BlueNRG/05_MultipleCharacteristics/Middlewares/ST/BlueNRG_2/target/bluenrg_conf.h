@@ -35,12 +35,21 @@ extern "C" {
 #define PRINT_CSV_FORMAT      0
 /*---------- Print messages from BLE2 files at middleware level -----------*/
 #define BLUENRG2_DEBUG      0
-/*---------- Number of Bytes reserved for HCI Read Packet -----------*/
-#define HCI_READ_PACKET_SIZE      128
+/*---------- Number of Bytes reserved for HCI Read Packet ( largest size class: packet type, event header and 255 parameter bytes ) -----------*/
+#define HCI_READ_PACKET_SIZE      260
 /*---------- Number of Bytes reserved for HCI Max Payload -----------*/
-#define HCI_MAX_PAYLOAD_SIZE      128
+#define HCI_MAX_PAYLOAD_SIZE      255
+/*---------- HCI Read Packet size classes: Bytes per packet and number of packets of each class, smallest first -----------*/
+#define HCI_PKT_CLASS0_SIZE      32
+#define HCI_PKT_CLASS0_NUM      8
+#define HCI_PKT_CLASS1_SIZE      64
+#define HCI_PKT_CLASS1_NUM      5
+#define HCI_PKT_CLASS2_SIZE      HCI_READ_PACKET_SIZE
+#define HCI_PKT_CLASS2_NUM      2
 /*---------- Number of incoming packets added to the list of packets to read -----------*/
-#define HCI_READ_PACKET_NUM_MAX      10
+#define HCI_READ_PACKET_NUM_MAX      (HCI_PKT_CLASS0_NUM + HCI_PKT_CLASS1_NUM + HCI_PKT_CLASS2_NUM)
+/*---------- Packets kept for the high priority receive lane: bulk events ( advertising reports, notifications ) never hold them -----------*/
+#define HCI_RX_HIGH_RESERVE      4
 /*---------- Scan Interval: time interval from when the Controller started its last scan until it begins the subsequent scan (for a number N, Time = N x 0.625 msec) -----------*/
 #define SCAN_P      16384
 /*---------- Scan Window: amount of time for the duration of the LE scan (for a number N, Time = N x 0.625 msec) -----------*/
@@ -0,0 +1,49 @@
+/**
+  ******************************************************************************
+  * @file    Target/bluenrg_events_conf.h
+  * @author  Zafeer Abbasi
+  * @brief   Events dispatched to the application
+  ******************************************************************************
+  * @attention
+  *
+  * Each list names the events the application handles, as X( code, callback ).
+  * bluenrg1_events.c builds the three dispatch tables from these lists only,
+  * so the parsers and weak callbacks of every other event are no longer
+  * referenced and the linker ( --gc-sections ) drops them. Events missing from
+  * the lists are ignored, as they were when they hit an empty weak callback.
+  *
+  * An event is added by appending its entry, e.g.
+  * X(0x0002, hci_le_advertising_report_event), and overriding the callback.
+  * A vendor specific event listed in BLE_CONF_VS_EVENT_VIEWS goes to its view
+  * handler instead, and is not unpacked at all. Any list may be left empty:
+  * its table and dispatch loop are then compiled out.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef BLUENRG_EVENTS_CONF_H
+#define BLUENRG_EVENTS_CONF_H
+
+/*---------- 1: dispatch tables hold the listed events only, 0: every generated event -----------*/
+#ifndef BLE_EVENTS_PRUNE
+  #define BLE_EVENTS_PRUNE      1
+#endif
+
+/*---------- HCI events ( event code ) -----------*/
+#define BLE_CONF_HCI_EVENTS(X)                                        \
+  X(0x0005, hci_disconnection_complete_event)
+
+/*---------- HCI LE Meta events ( subevent code ) -----------*/
+#define BLE_CONF_LE_META_EVENTS(X)                                    \
+  X(0x0001, hci_le_connection_complete_event)                         \
+  X(0x0002, hci_le_advertising_report_event)
+
+/*---------- Vendor specific events ( ecode ), empty: the table and its dispatch loop are compiled out -----------*/
+#define BLE_CONF_VS_EVENTS(X)
+
+/*---------- Vendor specific events handed over as a zero copy view ( ecode, view handler ), see hci_evt_view.h -----------*/
+#define BLE_CONF_VS_EVENT_VIEWS(X)                                    \
+  X(0x0c14, GATT_readPermitReqView)
+
+#endif /* BLUENRG_EVENTS_CONF_H */
@@ -21,6 +21,7 @@
 #include "RTE_Components.h"
 
 #include "hci_tl.h"
+#include "profile.h"
 
 /* Defines -------------------------------------------------------------------*/
 
@@ -31,6 +32,7 @@
 
 /* Private variables ---------------------------------------------------------*/
 EXTI_HandleTypeDef hexti0;
+static uint16_t rx_byte_count;  /* Bytes announced by the header of the open read */
 
 /* Private function prototypes -----------------------------------------------*/
 static void HCI_TL_SPI_Enable_IRQ(void);
@@ -130,19 +132,14 @@ int32_t HCI_TL_SPI_Reset(void)
 }
 
 /**
- * @brief  Reads from BlueNRG SPI buffer and store data into local buffer.
+ * @brief  Opens a read: selects the BlueNRG and reads the SPI header. The
+ *         frame stays open until HCI_TL_SPI_ReceiveData().
  *
- * @param  buffer : Buffer where data from SPI are stored
- * @param  size   : Buffer size
- * @retval int32_t: Number of read bytes
+ * @param  None
+ * @retval int32_t: Number of bytes the BlueNRG has ready, 0 if none
  */
-int32_t HCI_TL_SPI_Receive(uint8_t* buffer, uint16_t size)
+int32_t HCI_TL_SPI_ReceiveLen(void)
 {
-  uint16_t byte_count;
-  uint8_t len = 0;
-  uint8_t char_00 = 0x00;
-  volatile uint8_t read_char;
-
   uint8_t header_master[HEADER_SIZE] = {0x0b, 0x00, 0x00, 0x00, 0x00};
   uint8_t header_slave[HEADER_SIZE];
 
@@ -155,7 +152,27 @@ int32_t HCI_TL_SPI_Receive(uint8_t* buffer, uint16_t size)
   BSP_SPI1_SendRecv(header_master, header_slave, HEADER_SIZE);
 
   /* device is ready */
-  byte_count = (header_slave[4] << 8)| header_slave[3];
+  rx_byte_count = (header_slave[4] << 8)| header_slave[3];
+
+  return rx_byte_count;
+}
+
+/**
+ * @brief  Reads the bytes announced by HCI_TL_SPI_ReceiveLen() into a local
+ *         buffer and closes the read.
+ *
+ * @param  buffer : Buffer where data from SPI are stored
+ * @param  size   : Buffer size, 0 to leave the data pending in the BlueNRG
+ * @retval int32_t: Number of read bytes
+ */
+int32_t HCI_TL_SPI_ReceiveData(uint8_t* buffer, uint16_t size)
+{
+  uint16_t byte_count = rx_byte_count;
+  uint16_t len = 0;
+  uint8_t char_00 = 0x00;
+  volatile uint8_t read_char;
+
+  PROF_ENTER(PROF_ZONE_SPI_RECEIVE);
 
   if(byte_count > 0)
   {
@@ -177,21 +194,41 @@ int32_t HCI_TL_SPI_Receive(uint8_t* buffer, uint16_t size)
    * To be aligned to the SPI protocol.
    * Can bring to a delay inside the frame, due to the BlueNRG-2 that needs
    * to check if the header is received or not.
+   * Skipped when the data is left pending: IRQ stays high until it is read.
    */
-  uint32_t tickstart = HAL_GetTick();
-  while ((HAL_GetTick() - tickstart) < TIMEOUT_IRQ_HIGH) {
-    if (HAL_GPIO_ReadPin(HCI_TL_SPI_IRQ_PORT, HCI_TL_SPI_IRQ_PIN)==GPIO_PIN_RESET) {
-      break;
+  if ((len > 0) || (rx_byte_count == 0))
+  {
+    uint32_t tickstart = HAL_GetTick();
+    while ((HAL_GetTick() - tickstart) < TIMEOUT_IRQ_HIGH) {
+      if (HAL_GPIO_ReadPin(HCI_TL_SPI_IRQ_PORT, HCI_TL_SPI_IRQ_PIN)==GPIO_PIN_RESET) {
+        break;
+      }
     }
   }
+  rx_byte_count = 0;
   HCI_TL_SPI_Enable_IRQ();
 
   /* Release CS line */
   HAL_GPIO_WritePin(HCI_TL_SPI_CS_PORT, HCI_TL_SPI_CS_PIN, GPIO_PIN_SET);
 
+  PROF_EXIT(PROF_ZONE_SPI_RECEIVE);
   return len;
 }
 
+/**
+ * @brief  Reads from BlueNRG SPI buffer and store data into local buffer.
+ *
+ * @param  buffer : Buffer where data from SPI are stored
+ * @param  size   : Buffer size
+ * @retval int32_t: Number of read bytes
+ */
+int32_t HCI_TL_SPI_Receive(uint8_t* buffer, uint16_t size)
+{
+  HCI_TL_SPI_ReceiveLen();
+
+  return HCI_TL_SPI_ReceiveData(buffer, size);
+}
+
 /**
  * @brief  Writes data from local buffer to SPI.
  *
@@ -210,6 +247,8 @@ int32_t HCI_TL_SPI_Send(uint8_t* buffer, uint16_t size)
   static uint8_t read_char_buf[MAX_BUFFER_SIZE];
   uint32_t tickstart = HAL_GetTick();
 
+  PROF_ENTER(PROF_ZONE_SPI_SEND);
+
   HCI_TL_SPI_Disable_IRQ();
 
   do
@@ -279,6 +318,7 @@ int32_t HCI_TL_SPI_Send(uint8_t* buffer, uint16_t size)
   }
   HCI_TL_SPI_Enable_IRQ();
 
+  PROF_EXIT(PROF_ZONE_SPI_SEND);
   return result;
 }
 
@@ -312,6 +352,8 @@ void hci_tl_lowlevel_init(void)
   fops.DeInit  = HCI_TL_SPI_DeInit;
   fops.Send    = HCI_TL_SPI_Send;
   fops.Receive = HCI_TL_SPI_Receive;
+  fops.ReceiveLen  = HCI_TL_SPI_ReceiveLen;
+  fops.ReceiveData = HCI_TL_SPI_ReceiveData;
   fops.Reset   = HCI_TL_SPI_Reset;
   fops.GetTick = BSP_GetTick;
 
@@ -333,6 +375,18 @@ void hci_tl_lowlevel_init(void)
 
 }
 
+/**
+  * @brief HCI Transport Layer Low Level read restart: pends the EXTI line by
+  *        software, hci_tl_lowlevel_isr() then drains what the BlueNRG holds
+  *
+  * @param  None
+  * @retval None
+  */
+void hci_tl_lowlevel_resume(void)
+{
+  HAL_EXTI_GenerateSWI(&hexti0);
+}
+
 /**
   * @brief HCI Transport Layer Low Level Interrupt Service Routine
   *
@@ -341,7 +395,8 @@ void hci_tl_lowlevel_init(void)
   */
 void hci_tl_lowlevel_isr(void)
 {
-  /* Call hci_notify_asynch_evt() */
+  /* Call hci_notify_asynch_evt() until the BlueNRG is drained or the packets
+     run out, in which case hci_user_evt_proc() restarts the reads */
   while(IsDataAvailable())
   {
     if (hci_notify_asynch_evt(NULL))
@@ -50,6 +50,8 @@ extern EXTI_HandleTypeDef     hexti0;
 int32_t HCI_TL_SPI_Init    (void* pConf);
 int32_t HCI_TL_SPI_DeInit  (void);
 int32_t HCI_TL_SPI_Receive (uint8_t* buffer, uint16_t size);
+int32_t HCI_TL_SPI_ReceiveLen  (void);
+int32_t HCI_TL_SPI_ReceiveData (uint8_t* buffer, uint16_t size);
 int32_t HCI_TL_SPI_Send    (uint8_t* buffer, uint16_t size);
 int32_t HCI_TL_SPI_Reset   (void);
 
@@ -69,6 +71,15 @@ void hci_tl_lowlevel_init(void);
  */
 void hci_tl_lowlevel_isr(void);
 
+/**
+ * @brief HCI Transport Layer Low Level read restart, runs
+ *        hci_tl_lowlevel_isr() from the EXTI interrupt
+ *
+ * @param  None
+ * @retval None
+ */
+void hci_tl_lowlevel_resume(void);
+
 #ifdef __cplusplus
 }
 #endif
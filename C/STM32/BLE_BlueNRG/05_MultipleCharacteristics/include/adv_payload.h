@@ -0,0 +1,108 @@
+/*
+# ##############################################################################
+# File: adv_payload.h                                                          #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 10:26:05 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:06:27 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_ADV_PAYLOAD_H
+#define INC_ADV_PAYLOAD_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "main.h"
+#include "bluenrg1_types.h"
+#include "bcast_telemetry.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Advertising Interval ( 0.625 ms units ), 0: GAP defaults ( 30 to 60 ms when connectable )*/
+#define ADV_INTERVAL_MIN        0
+#define ADV_INTERVAL_MAX        0
+
+/*Complete Local Name*/
+#define ADV_NAME                'Y', 'O', 'U', 'R', '-', 'M', 'O', 'M'
+#define ADV_NAME_LEN            8
+
+/*Manufacturer Specific Data: Company Identifier ( 0xFFFF: none, testing only ), then the sensor values as int16 little endian, 
+in the order of the broadcast telemetry frames*/
+#define ADV_COMPANY_ID          0xFFFF
+#define ADV_SENSOR_NUM          BCAST_SENSOR_NUM
+#define ADV_SENSOR_BPM          BCAST_SENSOR_BPM
+#define ADV_SENSOR_WEIGHT       BCAST_SENSOR_WEIGHT
+#define ADV_SENSOR_TEMPERATURE  BCAST_SENSOR_TEMPERATURE
+#define ADV_SENSOR_HUMIDITY     BCAST_SENSOR_HUMIDITY
+
+/*Payload Layout: one AD structure each ( length, AD type, data )*/
+#define ADV_FLAGS_OFFSET        0
+#define ADV_FLAGS_AD_LEN        3
+#define ADV_NAME_OFFSET         ( ADV_FLAGS_OFFSET + ADV_FLAGS_AD_LEN )
+#define ADV_NAME_AD_LEN         ( 2 + ADV_NAME_LEN )
+#define ADV_MFR_OFFSET          ( ADV_NAME_OFFSET + ADV_NAME_AD_LEN )
+#define ADV_MFR_AD_LEN          ( 4 + 2 * ADV_SENSOR_NUM )
+#define ADV_MFR_VALUES_OFFSET   ( ADV_MFR_OFFSET + 4 )
+#define ADV_PAYLOAD_LEN         ( ADV_MFR_OFFSET + ADV_MFR_AD_LEN )
+
+#if ADV_PAYLOAD_LEN > 31
+#error "Advertising payload over 31 bytes"
+#endif
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Advertising Counters
+ * 
+ */
+typedef struct
+{
+    uint32_t    starts;             /*aci_gap_set_discoverable( ) calls, full payload pushed*/
+    uint32_t    pushes;             /*aci_gap_update_adv_data( ) calls for changed values*/
+    uint32_t    pushBytes;          /*Bytes sent by those calls*/
+    uint32_t    unchanged;          /*Sensor updates that changed nothing, no command sent*/
+    uint32_t    deferred;           /*Changes held while not advertising, sent by the next start*/
+    uint32_t    failures;
+} ADV_stats_t;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+tBleStatus ADV_start( void );
+void ADV_stopped( void );
+tBleStatus ADV_setSensors( const int32_t values[ ADV_SENSOR_NUM ] );
+void ADV_getStats( ADV_stats_t *stats );
+void ADV_dumpStats( void );
+
+#endif
\ No newline at end of file
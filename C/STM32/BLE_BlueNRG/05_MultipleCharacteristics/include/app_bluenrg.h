@@ -5,7 +5,7 @@
 # Created Date: Sunday, October 22nd 2023, 7:13:02 pm                          #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Tuesday, October 24th 2023, 8:05:58 pm                        #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -35,6 +35,8 @@
 
 void blueNRG_init( void );
 void blueNRG_process( void );
+void blueNRG_task( void *arg );
+void blueNRG_startTasks( void );
 
 // void bluenrg_init(void);
 // void bluenrg_process(void);
@@ -49,6 +51,32 @@ void blueNRG_process( void );
 /*DEFINES_______________________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
+/*Scheduler Task ids ( priority, 0 = highest )*/
+#define APP_TASK_BLE        0
+#define APP_TASK_STATS      1       /*Push_Btn1: dump the profiling, scheduler and low power statistics*/
+
+/*BLE Task poll period: restarts advertising after a disconnection and refreshes the advertised sensor values*/
+#define APP_BLE_POLL_MS     100
+
+/*Observer: scan while advertising, reports go through the Scanner's filters ( scanner.h ). Off by default, scanning 
+keeps the radio busy between advertising events*/
+#define APP_SCAN_ENABLE     0
+
+/*Broadcaster: rotate the sensor values through non-connectable advertising ( broadcaster.h ) instead of advertising 
+the connectable GATT server*/
+#define APP_BROADCAST_ENABLE    0
+
+#if APP_BROADCAST_ENABLE
+#define APP_GAP_ADV_ROLE    GAP_BROADCASTER_ROLE
+#else
+#define APP_GAP_ADV_ROLE    GAP_PERIPHERAL_ROLE
+#endif
+
+#if APP_SCAN_ENABLE
+#define APP_GAP_ROLE        ( APP_GAP_ADV_ROLE | GAP_OBSERVER_ROLE )
+#else
+#define APP_GAP_ROLE        APP_GAP_ADV_ROLE
+#endif
 
 
 /*##############################################################################################################################################*/
@@ -0,0 +1,90 @@
+/*
+# ##############################################################################
+# File: broadcaster.h                                                          #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 10:58:40 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 10:58:40 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_BROADCASTER_H
+#define INC_BROADCASTER_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "main.h"
+#include "bluenrg1_types.h"
+#include "bcast_telemetry.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+/*Non-connectable advertising interval ( 0.625 ms units, 100 ms at least )*/
+#define BCAST_ADV_INTERVAL_MIN      0x00A0
+#define BCAST_ADV_INTERVAL_MAX      0x00F0
+
+/*Default time each frame stays on air before the next sensor's frame replaces it, a full reading takes BCAST_SENSOR_NUM times as long*/
+#define BCAST_FRAME_PERIOD_MS       1000
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Broadcaster Counters
+ * 
+ */
+typedef struct
+{
+    uint32_t    frames;             /*Frames put on air*/
+    uint32_t    rotations;          /*Complete sensor rotations*/
+    uint32_t    failures;           /*Commands refused, the frame is retried on the next run*/
+    uint32_t    periodMs;
+    uint8_t     seq;                /*Sequence of the next frame*/
+} BCAST_stats_t;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+tBleStatus BCAST_start( const int32_t values[ BCAST_SENSOR_NUM ] );
+tBleStatus BCAST_process( const int32_t values[ BCAST_SENSOR_NUM ] );
+void BCAST_setPeriod( uint32_t periodMs );
+void BCAST_getStats( BCAST_stats_t *stats );
+void BCAST_dumpStats( void );
+
+#endif
\ No newline at end of file
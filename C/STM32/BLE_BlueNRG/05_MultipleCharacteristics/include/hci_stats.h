@@ -0,0 +1,114 @@
+/*
+# ##############################################################################
+# File: hci_stats.h                                                            #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 7:41:52 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 7:41:52 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_HCI_STATS_H
+#define INC_HCI_STATS_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "main.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+/*Distinct opcodes tracked, later opcodes share the overflow entry ( opcode HSTAT_OPCODE_OTHER )*/
+#define HSTAT_MAX_OPCODES       32
+#define HSTAT_OPCODE_OTHER      0xFFFF
+
+/*Latency Histogram: bucket n counts [ 2^n, 2^(n+1) ) us, the last bucket everything longer ( timeouts land there )*/
+#define HSTAT_HIST_BUCKETS      16
+
+/*Cycle Counter, started by PROF_init( )*/
+#define HSTAT_CYCLES( )         ( DWT->CYCCNT )
+
+/*Opcode Fields*/
+#define HSTAT_OGF( opcode )     ( ( uint16_t )( ( opcode ) >> 10 ) )
+#define HSTAT_OCF( opcode )     ( ( uint16_t )( ( opcode ) & 0x03FF ) )
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Outcome of one hci_send_req( )
+ * 
+ */
+typedef enum
+{
+    HSTAT_OK = 0,       /*Command Complete / Status ( or the awaited LE Meta event ) received*/
+    HSTAT_FAILED,       /*Error status, opcode mismatch or hardware error*/
+    HSTAT_TIMEOUT,      /*No answer within HCI_DEFAULT_TIMEOUT_MS*/
+    HSTAT_ASYNC         /*Sent without waiting, no latency recorded*/
+} HSTAT_result_t;
+
+/**
+ * @brief Statistics of one opcode
+ * 
+ */
+typedef struct
+{
+    uint16_t    opcode;                         /*( ogf << 10 ) | ocf*/
+    uint32_t    calls;
+    uint32_t    failures;
+    uint32_t    timeouts;
+    uint32_t    async;                          /*Sent without waiting*/
+    uint32_t    diverted;                       /*Unrelated events parked in hciTempQueue while waiting*/
+    uint32_t    dropped;                        /*Unrelated events discarded because the packet pool ran dry*/
+    uint32_t    latencyMinUs;
+    uint32_t    latencyMaxUs;
+    uint64_t    latencyTotalUs;                 /*Over the completed ( HSTAT_OK ) calls*/
+    uint32_t    hist[ HSTAT_HIST_BUCKETS ];
+} HSTAT_entry_t;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+void HSTAT_record( uint16_t ogf, uint16_t ocf, uint8_t result, uint32_t cycles, uint8_t diverted, uint8_t dropped );
+uint8_t HSTAT_getCount( void );
+uint8_t HSTAT_getEntry( uint8_t index, HSTAT_entry_t *entry );
+uint8_t HSTAT_getOpcode( uint16_t ogf, uint16_t ocf, HSTAT_entry_t *entry );
+void HSTAT_reset( void );
+void HSTAT_dump( void );
+
+#endif
\ No newline at end of file
@@ -0,0 +1,113 @@
+/*
+# ##############################################################################
+# File: lowpower.h                                                             #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 6:14:09 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 6:14:09 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_LOWPOWER_H
+#define INC_LOWPOWER_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "main.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+/*0: idle in Sleep only ( SysTick keeps running, e.g. while debugging )*/
+#define LPWR_USE_STOP           1
+
+/*RTC Clock: LSE ( X2 crystal of the Nucleo ) or LSI ( +-50 %, STOP time is measured with it )*/
+#define LPWR_RTC_USE_LSE        1
+
+#if LPWR_RTC_USE_LSE
+#define LPWR_RTC_CLOCK_HZ       LSE_VALUE
+#else
+#define LPWR_RTC_CLOCK_HZ       LSI_VALUE
+#endif
+
+/*Calendar Sub Seconds: asynchronous prescaler of 8 gives a 4096 Hz ( LSE ) time base for the STOP measurement*/
+#define LPWR_RTC_ASYNC_DIV      8
+#define LPWR_RTC_SYNC_HZ        ( LPWR_RTC_CLOCK_HZ / LPWR_RTC_ASYNC_DIV )
+#define LPWR_RTC_DAY_COUNTS     ( 86400UL * LPWR_RTC_SYNC_HZ )
+
+/*Wakeup Timer: RTCCLK / 16, 16 bit counter*/
+#define LPWR_RTC_WAKEUP_HZ      ( LPWR_RTC_CLOCK_HZ / 16 )
+
+/*Idle periods shorter than this use Sleep, STOP entry and the clock restore would cost more than they save*/
+#define LPWR_STOP_MIN_MS        5
+
+/*Longest STOP period, below the 16 bit Wakeup Timer range*/
+#define LPWR_STOP_MAX_MS        30000
+
+/*STOP ends this early to absorb the clock restore before the timer deadline*/
+#define LPWR_WAKE_MARGIN_MS     1
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+extern RTC_HandleTypeDef hrtc;
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Low Power Idle Statistics
+ * 
+ */
+typedef struct
+{
+    uint32_t    sleepEntries;
+    uint32_t    stopEntries;
+    uint32_t    wakeRtc;                /*STOP ended by the Wakeup Timer*/
+    uint32_t    wakeExti;               /*STOP ended early: BlueNRG IRQ ( EXTI0 ), Push_Btn1 or another interrupt*/
+    uint64_t    sleepCycles;            /*Time in Sleep ( SysTick Clock cycles )*/
+    uint32_t    stopMs;                 /*Time in STOP ( RTC measured )*/
+    uint32_t    wakeLatencyLastUs;      /*STOP exit to clocks restored*/
+    uint32_t    wakeLatencyMaxUs;
+    uint64_t    wakeLatencySumUs;
+} LPWR_stats_t;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+HAL_StatusTypeDef LPWR_init( void );
+void LPWR_idle( uint32_t ticksToTimer );
+void LPWR_getStats( LPWR_stats_t *stats );
+void LPWR_dumpStats( void );
+
+#endif
\ No newline at end of file
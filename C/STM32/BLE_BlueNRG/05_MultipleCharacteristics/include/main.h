@@ -5,7 +5,7 @@
 # Created Date: Sunday, October 22nd 2023, 3:13:12 pm                          #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Tuesday, October 24th 2023, 6:31:04 pm                        #
+# Last Modified: Sunday, October 18th 2026, 6:14:09 pm                         #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -70,6 +70,7 @@ extern "C" {
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
+void SystemClock_Config(void);
 
 /* USER CODE END EFP */
 
@@ -0,0 +1,91 @@
+/*
+# ##############################################################################
+# File: memmon.h                                                               #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 8:10:37 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 8:10:37 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_MEMMON_H
+#define INC_MEMMON_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "main.h"
+#include <stddef.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+/*Stack Paint Pattern, a word still holding it was never written*/
+#define MEM_PAINT_PATTERN       0xA5A5A5A5UL
+
+/*Bytes below the current stack pointer left unpainted ( MEM_stackPaint( )'s own frame )*/
+#define MEM_PAINT_MARGIN        64
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Memory Usage: MSP stack high water mark and newlib heap ( _sbrk ), all sizes in bytes
+ * 
+ */
+typedef struct
+{
+    uint32_t    stackUsedPeak;          /*Deepest stack seen since the paint*/
+    uint32_t    stackReserved;          /*_Min_Stack_Size*/
+    uint32_t    heapUsed;               /*Current _sbrk break above _end*/
+    uint32_t    heapPeak;
+    uint32_t    heapLimit;              /*Largest heap _sbrk allows ( up to the reserved stack )*/
+    uint32_t    sbrkFailures;
+    uint32_t    sbrkFailLargest;        /*Largest refused request*/
+    uint32_t    gapMin;                 /*Closest the stack came to the heap peak*/
+} MEM_stats_t;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+void MEM_stackPaint( void );
+void MEM_sbrkGrew( const uint8_t *heapEnd );
+void MEM_sbrkFailed( ptrdiff_t incr );
+void MEM_getStats( MEM_stats_t *stats );
+void MEM_dumpStats( void );
+
+#endif
\ No newline at end of file
@@ -0,0 +1,148 @@
+/*
+# ##############################################################################
+# File: profile.h                                                              #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 7:02:31 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 9:03:27 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_PROFILE_H
+#define INC_PROFILE_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#ifdef PROF_HOST
+#include <stdint.h>
+#include <stdio.h>
+#else
+#include "main.h"
+#endif
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+/*0: every PROF_ macro expands to nothing and the zone table is not built*/
+#ifndef PROF_ENABLED
+#define PROF_ENABLED            1
+#endif
+
+/*Histogram: bucket n counts durations of [ 2^n, 2^(n+1) ) cycles, the last bucket everything longer*/
+#define PROF_HIST_BUCKETS       24
+
+/*Port Layer: cycle counter and its frequency. The host build maps the counter onto CLOCK_MONOTONIC in nanoseconds*/
+#ifdef PROF_HOST
+#define PROF_CYCLES( )              PROF_hostCycles( )
+#define PROF_CLOCK_HZ( )            1000000000UL
+#define PROF_CRITICAL_ENTER( )      do {
+#define PROF_CRITICAL_EXIT( )       } while( 0 )
+#else
+#define PROF_CYCLES( )              ( DWT->CYCCNT )
+#define PROF_CLOCK_HZ( )            SystemCoreClock
+#define PROF_CRITICAL_ENTER( )      do { uint32_t profPrimask = __get_PRIMASK( ); __disable_irq( )
+#define PROF_CRITICAL_EXIT( )       __set_PRIMASK( profPrimask ); } while( 0 )
+#endif
+
+/*Zone Markers: PROF_ENTER( ) opens a zone in the current block, PROF_EXIT( ) records it. 
+  PROF_EXIT_AS( ) records the same start into a zone chosen at run time*/
+#if PROF_ENABLED
+#define PROF_ENTER( zone )              uint32_t profStart_##zone = PROF_CYCLES( )
+#define PROF_EXIT( zone )               PROF_record( ( zone ), PROF_CYCLES( ) - profStart_##zone )
+#define PROF_EXIT_AS( zone, asZone )    PROF_record( ( asZone ), PROF_CYCLES( ) - profStart_##zone )
+#define PROF_DUMP( )                    PROF_dump( )
+#define PROF_RESET( )                   PROF_reset( )
+#else
+#define PROF_ENTER( zone )
+#define PROF_EXIT( zone )
+#define PROF_EXIT_AS( zone, asZone )
+#define PROF_DUMP( )
+#define PROF_RESET( )
+#endif
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Profiling Zones, one entry each in the zone table. The ACI zones are recorded by hci_send_req( ) from the 
+ * command opcode, every ACI wrapper goes through it.
+ * 
+ */
+typedef enum
+{
+    PROF_ZONE_HCI_ASYNCH_EVT = 0,   /*hci_notify_asynch_evt( ): one packet read in the BlueNRG IRQ*/
+    PROF_ZONE_HCI_SEND_REQ,         /*hci_send_req( ): command out to its completion event*/
+    PROF_ZONE_SPI_RECEIVE,          /*HCI_TL_SPI_ReceiveData( ): payload read, after the header*/
+    PROF_ZONE_SPI_SEND,             /*HCI_TL_SPI_Send( )*/
+    PROF_ZONE_USER_EVT_RX,          /*APP_userEvtRx( ): event dispatch and the application callbacks*/
+    PROF_ZONE_ACI_HAL,              /*aci_hal_*( )*/
+    PROF_ZONE_ACI_GAP,              /*aci_gap_*( )*/
+    PROF_ZONE_ACI_GATT,             /*aci_gatt_*( )*/
+    PROF_ZONE_ACI_L2CAP,            /*aci_l2cap_*( )*/
+    PROF_ZONE_HCI_CMD,              /*hci_*( ) standard HCI commands*/
+    PROF_ZONE_COUNT
+} PROF_zoneId_t;
+
+/**
+ * @brief Zone Statistics, durations in PROF_CYCLES( ) units
+ * 
+ */
+typedef struct
+{
+    uint32_t    count;
+    uint32_t    min;
+    uint32_t    max;
+    uint64_t    total;
+    uint32_t    hist[ PROF_HIST_BUCKETS ];
+} PROF_zone_t;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+void PROF_init( void );
+void PROF_record( uint8_t zone, uint32_t cycles );
+uint8_t PROF_aciZone( uint16_t ogf, uint16_t ocf );
+uint8_t PROF_getZone( uint8_t zone, PROF_zone_t *stats );
+void PROF_reset( void );
+void PROF_dump( void );
+
+#ifdef PROF_HOST
+uint32_t PROF_hostCycles( void );
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,136 @@
+/*
+# ##############################################################################
+# File: scanner.h                                                              #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 10:06:12 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 10:06:12 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_SCANNER_H
+#define INC_SCANNER_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "main.h"
+#include "bluenrg1_types.h"
+#include "bluenrg1_events.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+/*Observation Procedure: scan interval and window ( 0.625 ms units ), equal for continuous passive scanning*/
+#define SCAN_INTERVAL               0x0050
+#define SCAN_WINDOW                 0x0050
+
+/*Device Table: open addressing, SCAN_TABLE_SIZE ( power of 2 ) records probed SCAN_PROBE_MAX deep*/
+#define SCAN_TABLE_SIZE             64
+#define SCAN_PROBE_MAX              8
+
+/*Repeats of an address + data pair within the window are coalesced into its record*/
+#define SCAN_DEDUP_WINDOW_MS        1000
+
+/*Reports handed to the application: SCAN_RATE_PER_S on average, bursts of up to SCAN_RATE_BURST*/
+#define SCAN_RATE_PER_S             20
+#define SCAN_RATE_BURST             5
+
+/*Allow List entries, an empty list lets every address through*/
+#define SCAN_ALLOW_LIST_SIZE        8
+
+/*Default RSSI floor ( dBm ), weaker reports are dropped*/
+#define SCAN_RSSI_MIN_DEFAULT       -90
+
+/*RSSI value of a report without RSSI, never filtered*/
+#define SCAN_RSSI_NOT_AVAILABLE     127
+
+/*addrType of a free Device Table slot*/
+#define SCAN_ADDR_TYPE_EMPTY        0xFF
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Device Record: one per address + advertising data pair
+ * 
+ */
+typedef struct
+{
+    uint8_t     addr[ 6 ];
+    uint8_t     addrType;           /*SCAN_ADDR_TYPE_EMPTY while the slot is free*/
+    int8_t      rssi;               /*Last report, coalesced ones included*/
+    uint32_t    dataHash;           /*FNV-1a of the advertising data*/
+    uint32_t    lastReported;       /*HAL tick of the last report handed to the application*/
+    uint16_t    count;              /*Reports heard*/
+    uint8_t     evtType;
+    uint8_t     reserved;
+} SCAN_device_t;
+
+/**
+ * @brief Scanner Counters, all reports counted once
+ * 
+ */
+typedef struct
+{
+    uint32_t    reports;            /*Reports received*/
+    uint32_t    passed;             /*Left in the event for the application*/
+    uint32_t    coalesced;          /*Duplicates within SCAN_DEDUP_WINDOW_MS*/
+    uint32_t    droppedRssi;        /*Below the RSSI floor*/
+    uint32_t    droppedAllow;       /*Not on the Allow List*/
+    uint32_t    droppedRate;        /*Over SCAN_RATE_PER_S*/
+    uint32_t    evictions;          /*Records replaced for lack of a free slot*/
+    uint32_t    delivered;          /*Reports handed to the application callback*/
+    uint16_t    devices;            /*Records in use*/
+} SCAN_stats_t;
+
+/*Application callback, one report at a time from the BLE Task*/
+typedef void ( *SCAN_reportCb_t )( const Advertising_Report_t *report );
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+tBleStatus SCAN_start( SCAN_reportCb_t reportCb );
+tBleStatus SCAN_stop( void );
+void SCAN_setRssiMin( int8_t rssiMin );
+uint8_t SCAN_allowAdd( uint8_t addrType, const uint8_t addr[ 6 ] );
+void SCAN_allowClear( void );
+uint16_t SCAN_rxFilter( uint8_t *pckt, uint16_t len );
+void SCAN_getStats( SCAN_stats_t *stats );
+void SCAN_dumpStats( void );
+
+#endif
\ No newline at end of file
@@ -0,0 +1,152 @@
+/*
+# ##############################################################################
+# File: scheduler.h                                                            #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 5:02:44 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:52:14 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_SCHEDULER_H
+#define INC_SCHEDULER_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#ifdef SCHED_HOST
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#else
+#include "main.h"
+#endif
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+/*Tasks: one per bit of the ready bitmap, the task id is its priority ( 0 = highest )*/
+#define SCHED_MAX_TASKS         32
+
+/*Timer Wheel: one slot per tick, SCHED_WHEEL_SLOTS must be a power of 2*/
+#define SCHED_WHEEL_SLOTS       32
+#define SCHED_WHEEL_MASK        ( SCHED_WHEEL_SLOTS - 1 )
+#define SCHED_TICK_MS           1       /*SCHED_tick( ) is called from SysTick*/
+#define SCHED_NO_TIMER          0xFFFFFFFFUL
+
+#if ( SCHED_WHEEL_SLOTS & SCHED_WHEEL_MASK ) != 0
+#error "SCHED_WHEEL_SLOTS must be a power of 2"
+#endif
+
+/*Port Layer: critical sections, cycle counter and idle. The host build ( pio test -e native ) runs single threaded with a 
+  simulated tick, the test defines SCHED_hostCycles( ) ( its stub clock ) and SCHED_hostIdle( ) ( advances the tick ), 
+  see test/test_scheduler*/
+#ifdef SCHED_HOST
+#define SCHED_CRITICAL_ENTER( )     do {
+#define SCHED_CRITICAL_EXIT( )      } while( 0 )
+#define SCHED_CYCLES( )             SCHED_hostCycles( )
+#define SCHED_IDLE( )               SCHED_hostIdle( )
+#else
+#define SCHED_CRITICAL_ENTER( )     do { uint32_t schedPrimask = __get_PRIMASK( ); __disable_irq( )
+#define SCHED_CRITICAL_EXIT( )      __set_PRIMASK( schedPrimask ); } while( 0 )
+#define SCHED_CYCLES( )             ( DWT->CYCCNT )
+#define SCHED_IDLE( )               __WFI( )
+#endif
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+typedef void ( *SCHED_taskFn_t )( void *arg );
+
+/**
+ * @brief Idle Hook, called with interrupts disabled when no task is ready. Must return with interrupts still disabled, 
+ * a pending interrupt is serviced right after. ticksToTimer is SCHED_NO_TIMER if no timer is running.
+ * 
+ */
+typedef void ( *SCHED_idleHook_t )( uint32_t ticksToTimer );
+
+/**
+ * @brief Timed Event: posts its task on expiry, once or periodically. Caller owned, linked into the Timer Wheel while running.
+ * 
+ */
+typedef struct SCHED_timer_s
+{
+    struct SCHED_timer_s    *next;
+    uint32_t                expiry;     /*Absolute tick*/
+    uint32_t                period;     /*0 for a one shot timer*/
+    uint8_t                 task;
+    uint8_t                 running;
+} SCHED_timer_t;
+
+/**
+ * @brief Run-Time Accounting of one task
+ * 
+ */
+typedef struct
+{
+    const char  *name;
+    uint32_t    posts;          /*Times posted ( including while already ready )*/
+    uint32_t    runs;           /*Times run*/
+    uint64_t    cyclesTotal;    /*Cycles spent running*/
+    uint32_t    cyclesMax;      /*Longest single run*/
+} SCHED_taskStats_t;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+void SCHED_init( void );
+uint8_t SCHED_taskCreate( uint8_t task, SCHED_taskFn_t fn, void *arg, const char *name );
+void SCHED_post( uint8_t task );
+void SCHED_tick( void );
+void SCHED_tickAdvance( uint32_t ticks );
+uint32_t SCHED_getTick( void );
+void SCHED_timerStart( SCHED_timer_t *timer, uint8_t task, uint32_t delayTicks, uint32_t periodTicks );
+void SCHED_timerStop( SCHED_timer_t *timer );
+uint32_t SCHED_ticksToNextTimer( void );
+void SCHED_setIdleHook( SCHED_idleHook_t hook );
+uint8_t SCHED_runOnce( void );
+void SCHED_run( void );
+uint8_t SCHED_getTaskStats( uint8_t task, SCHED_taskStats_t *stats );
+uint32_t SCHED_getIdleCount( void );
+void SCHED_dumpStats( void );
+
+#ifdef SCHED_HOST
+uint32_t SCHED_hostCycles( void );
+void SCHED_hostIdle( void );
+#endif
+
+#endif
\ No newline at end of file
@@ -5,7 +5,7 @@
 # Created Date: Tuesday, October 24th 2023, 9:41:11 pm                         #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Saturday, October 28th 2023, 2:00:28 pm                       #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -22,6 +22,7 @@
 
 #include "bluenrg1_gap.h"
 #include "bluenrg1_gatt_aci.h"
+#include "hci_evt_view.h"
 #include "main.h"
 
 /*##############################################################################################################################################*/
@@ -45,14 +46,33 @@ int32_t swap_int32(int32_t val);
 /*DEFINES_______________________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
+/*Only the tables of non empty event lists exist ( bluenrg_events_conf.h ), their dispatch loops are compiled out otherwise*/
+#if HCI_LE_META_EVENTS_TABLE_SIZE > 0
 #define HCI_LE_META_EVENTS_COUNT            ( sizeof( hci_le_meta_events_table )            / sizeof( hci_le_meta_events_table_type )           )
+#endif
+#if HCI_VENDOR_SPECIFIC_EVENTS_TABLE_SIZE > 0
 #define HCI_VENDOR_SPECIFIC_EVENTS_COUNT    ( sizeof( hci_vendor_specific_events_table )    / sizeof( hci_vendor_specific_events_table_type )   )
+#endif
+#if HCI_EVENTS_TABLE_SIZE > 0
 #define HCI_EVENTS_COUNT                    ( sizeof( hci_events_table )                    / sizeof( hci_events_table_type )                   )
+#endif
+#if HCI_VENDOR_SPECIFIC_VIEWS_TABLE_SIZE > 0
+#define HCI_VENDOR_SPECIFIC_VIEWS_COUNT     ( sizeof( hci_vendor_specific_views_table )     / sizeof( hci_evt_view_table_type )                 )
+#endif
 
 /*##############################################################################################################################################*/
 /*EXTERNS_______________________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
+extern const uint8_t HEALTH_SERVICE_UUID[ 16 ];
+
+extern uint8_t FLAG_CONNECTED;
+extern uint8_t FLAG_SET_CONNECTABLE;
+
+extern int32_t BPM;
+extern int32_t WEIGHT;
+extern int32_t TEMPERATURE;
+extern int32_t HUMIDITY;
 
 
 /*##############################################################################################################################################*/
@@ -0,0 +1,123 @@
+/*
+# ##############################################################################
+# File: bcast_gateway.c                                                        #
+# Project: examples                                                            #
+# Created Date: Sunday, October 18th 2026, 10:52:03 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Host Gateway Example: decodes advertisements read from stdin, one per line, as
+ * 
+ *  12000 AA:BB:CC:DD:EE:FF 08FFFFFFB710055500
+ * 
+ * ( reception time in ms, advertiser address, advertising data in hex ) and prints every complete reading, then the per 
+ * node counters.
+ * 
+ *  cc -I ../src bcast_gateway.c ../src/bcast_telemetry.c -o bcast_gateway
+ */
+
+#include "bcast_telemetry.h"
+#include <stdio.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Broadcasters tracked*/
+#define GATEWAY_NODES       512
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static BCAST_node_t     gatewayNodes[ GATEWAY_NODES ];
+static BCAST_decoder_t  gatewayDecoder;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+int main( void )
+{
+    unsigned int a[ 6 ], byte;
+    unsigned long nowMs;
+    char line[ 160 ], *hex;
+    uint8_t addr[ 6 ], adv[ 31 ], len;
+    BCAST_reading_t reading;
+    BCAST_node_t *node;
+    int index, used;
+
+    BCAST_decoderInit( &gatewayDecoder, gatewayNodes, GATEWAY_NODES, BCAST_STALE_MS );
+
+    while( fgets( line, sizeof( line ), stdin ) != NULL )
+    {
+        if( sscanf( line, "%lu %x:%x:%x:%x:%x:%x %n", &nowMs, &a[ 0 ], &a[ 1 ], &a[ 2 ], &a[ 3 ], &a[ 4 ], &a[ 5 ], &used ) != 7 )
+        {
+            continue;
+        }
+
+        /*Printed most significant byte first, held as in the Advertising Report*/
+        for( index = 0; index < 6; index++ )
+        {
+            addr[ index ] = ( uint8_t )a[ 5 - index ];
+        }
+
+        for( hex = line + used, len = 0; ( len < sizeof( adv ) ) && ( sscanf( hex, "%2x", &byte ) == 1 ); hex += 2 )
+        {
+            adv[ len++ ] = ( uint8_t )byte;
+        }
+
+        if( BCAST_decode( &gatewayDecoder, addr, adv, len, ( uint32_t )nowMs, &reading ) == BCAST_DEC_READING )
+        {
+            printf( "%02X:%02X:%02X:%02X:%02X:%02X seq %3u bpm %d weight %d temperature %d humidity %d\n", 
+                    reading.addr[ 5 ], reading.addr[ 4 ], reading.addr[ 3 ], reading.addr[ 2 ], reading.addr[ 1 ], reading.addr[ 0 ], 
+                    reading.baseSeq, reading.values[ BCAST_SENSOR_BPM ], reading.values[ BCAST_SENSOR_WEIGHT ], 
+                    reading.values[ BCAST_SENSOR_TEMPERATURE ], reading.values[ BCAST_SENSOR_HUMIDITY ] );
+        }
+    }
+
+    printf( "%u nodes, %lu evicted\n", gatewayDecoder.count, ( unsigned long )gatewayDecoder.evictions );
+    for( index = 0; index < GATEWAY_NODES; index++ )
+    {
+        node = &gatewayNodes[ index ];
+        if( node->used )
+        {
+            printf( "%02X:%02X:%02X:%02X:%02X:%02X frames %lu readings %lu duplicates %lu lost %lu restarts %lu stale %lu\n", 
+                    node->addr[ 5 ], node->addr[ 4 ], node->addr[ 3 ], node->addr[ 2 ], node->addr[ 1 ], node->addr[ 0 ], 
+                    ( unsigned long )node->frames, ( unsigned long )node->readings, ( unsigned long )node->duplicates, 
+                    ( unsigned long )node->lost, ( unsigned long )node->restarts, ( unsigned long )node->stale );
+        }
+    }
+
+    return 0;
+}
\ No newline at end of file
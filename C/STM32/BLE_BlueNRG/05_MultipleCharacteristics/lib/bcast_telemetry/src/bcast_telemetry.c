@@ -0,0 +1,276 @@
+/*
+# ##############################################################################
+# File: bcast_telemetry.c                                                      #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 10:44:19 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "bcast_telemetry.h"
+#include <string.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static BCAST_node_t *BCAST_nodeFind( BCAST_decoder_t *decoder, const uint8_t addr[ 6 ], uint32_t nowMs );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#define BCAST_AD_TYPE_MANUFACTURER  0xFF
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Encode a frame as advertising data
+ * 
+ * @param frame Frame
+ * @param adv BCAST_ADV_LEN bytes
+ * @return uint8_t Advertising data length, BCAST_ADV_LEN
+ */
+uint8_t BCAST_encode( const BCAST_frame_t *frame, uint8_t *adv )
+{
+    adv[ 0 ]                        = BCAST_ADV_LEN - 1;
+    adv[ 1 ]                        = BCAST_AD_TYPE_MANUFACTURER;
+    adv[ 2 ]                        = ( uint8_t )BCAST_COMPANY_ID;
+    adv[ 3 ]                        = ( uint8_t )( BCAST_COMPANY_ID >> 8 );
+    adv[ BCAST_OFF_MAGIC ]          = BCAST_MAGIC;
+    adv[ BCAST_OFF_VER_SENSOR ]     = ( uint8_t )( ( BCAST_VERSION << 4 ) | ( frame->sensor & 0x0F ) );
+    adv[ BCAST_OFF_SEQ ]            = frame->seq;
+    adv[ BCAST_OFF_VALUE ]          = ( uint8_t )frame->value;
+    adv[ BCAST_OFF_VALUE + 1 ]      = ( uint8_t )( ( uint16_t )frame->value >> 8 );
+
+    return BCAST_ADV_LEN;
+}
+
+/**
+ * @brief Find a telemetry frame among the AD structures of advertising ( or scan response ) data
+ * 
+ * @param adv Advertising data, as in the Advertising Report
+ * @param len Its length
+ * @param frame Filled when found
+ * @return int 1 if found, 0 otherwise
+ */
+int BCAST_parse( const uint8_t *adv, uint8_t len, BCAST_frame_t *frame )
+{
+    const uint8_t *ad = adv, *end = adv + len;
+
+    while( ( ad < end ) && ( ad[ 0 ] != 0 ) && ( ad + 1 + ad[ 0 ] <= end ) )
+    {
+        if( ( ad[ 0 ] == BCAST_ADV_LEN - 1 ) && ( ad[ 1 ] == BCAST_AD_TYPE_MANUFACTURER ) && 
+            ( ad[ 2 ] == ( uint8_t )BCAST_COMPANY_ID ) && ( ad[ 3 ] == ( uint8_t )( BCAST_COMPANY_ID >> 8 ) ) && 
+            ( ad[ BCAST_OFF_MAGIC ] == BCAST_MAGIC ) && ( ( ad[ BCAST_OFF_VER_SENSOR ] >> 4 ) == BCAST_VERSION ) && 
+            ( ( ad[ BCAST_OFF_VER_SENSOR ] & 0x0F ) < BCAST_SENSOR_NUM ) )
+        {
+            frame->sensor   = ad[ BCAST_OFF_VER_SENSOR ] & 0x0F;
+            frame->seq      = ad[ BCAST_OFF_SEQ ];
+            frame->value    = ( int16_t )( ad[ BCAST_OFF_VALUE ] | ( ad[ BCAST_OFF_VALUE + 1 ] << 8 ) );
+            return 1;
+        }
+
+        ad += 1 + ad[ 0 ];
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Initialise a Decoder over a node table
+ * 
+ * @param decoder Decoder
+ * @param nodes Node table, one entry per broadcaster tracked
+ * @param capacity Its entries
+ * @param staleMs Silence after which a node's rotation and sequence are forgotten, BCAST_STALE_MS suggested
+ */
+void BCAST_decoderInit( BCAST_decoder_t *decoder, BCAST_node_t *nodes, uint16_t capacity, uint32_t staleMs )
+{
+    memset( nodes, 0, capacity * sizeof( BCAST_node_t ) );
+    decoder->nodes      = nodes;
+    decoder->capacity   = capacity;
+    decoder->count      = 0;
+    decoder->staleMs    = staleMs;
+    decoder->evictions  = 0;
+}
+
+/**
+ * @brief Decode one advertisement. Repeats of a frame are recognised by their sequence, skipped sequences are counted 
+ * as lost, and the reading is written once every sensor of a rotation has been received. A frame arriving after more 
+ * than staleMs of silence starts over as a node's first frame: the 8 bit sequence may have wrapped any number of times, 
+ * so neither the rotation being collected nor the last sequence can be trusted.
+ * 
+ * @param decoder Decoder
+ * @param addr Advertiser Address
+ * @param adv Advertising data
+ * @param len Its length
+ * @param nowMs Reception time, any free running millisecond clock ( wraps are handled )
+ * @param reading Written on BCAST_DEC_READING
+ * @return int BCAST_DEC_x
+ */
+int BCAST_decode( BCAST_decoder_t *decoder, const uint8_t addr[ 6 ], const uint8_t *adv, uint8_t len, uint32_t nowMs, 
+                  BCAST_reading_t *reading )
+{
+    BCAST_frame_t frame;
+    BCAST_node_t *node;
+    uint8_t gap, base;
+
+    if( !BCAST_parse( adv, len, &frame ) )
+    {
+        return BCAST_DEC_NONE;
+    }
+
+    node = BCAST_nodeFind( decoder, addr, nowMs );
+    if( node == NULL )
+    {
+        return BCAST_DEC_FULL;
+    }
+
+    if( ( node->frames != 0 ) && ( nowMs - node->lastSeenMs > decoder->staleMs ) )
+    {
+        node->stale++;
+        node->haveMask = 0;
+    }
+    else if( node->frames != 0 )
+    {
+        gap = ( uint8_t )( frame.seq - node->lastSeq );
+        if( gap == 0 )
+        {
+            node->duplicates++;
+            node->lastSeenMs = nowMs;
+            return BCAST_DEC_DUPLICATE;
+        }
+
+        /*A step back, or a jump over half the sequence space, is a broadcaster restart rather than losses*/
+        if( gap < 128 )
+        {
+            node->lost += gap - 1;
+        }
+        else
+        {
+            node->restarts++;
+            node->haveMask = 0;
+        }
+    }
+
+    node->frames++;
+    node->lastSeq       = frame.seq;
+    node->lastSeenMs    = nowMs;
+
+    base = ( uint8_t )( frame.seq - frame.sensor );
+    if( ( node->haveMask == 0 ) || ( base != node->baseSeq ) )
+    {
+        node->baseSeq   = base;
+        node->haveMask  = 0;
+    }
+
+    node->values[ frame.sensor ] = frame.value;
+    node->haveMask |= ( uint8_t )( 1U << frame.sensor );
+
+    if( node->haveMask != ( 1U << BCAST_SENSOR_NUM ) - 1 )
+    {
+        return BCAST_DEC_FRAME;
+    }
+
+    node->haveMask = 0;
+    node->readings++;
+
+    reading->addr       = node->addr;
+    reading->baseSeq    = node->baseSeq;
+    memcpy( reading->values, node->values, sizeof( reading->values ) );
+
+    return BCAST_DEC_READING;
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Node of an address, created if new. Linear probing from an FNV-1a hash of the address. A new address takes 
+ * the first stale node of its probe sequence ( silent for more than staleMs ) if there is one, else the first free 
+ * slot, so broadcasters that went away do not fill the table.
+ * 
+ * @return BCAST_node_t* The node, NULL if the table is full and none is stale
+ */
+static BCAST_node_t *BCAST_nodeFind( BCAST_decoder_t *decoder, const uint8_t addr[ 6 ], uint32_t nowMs )
+{
+    BCAST_node_t *node, *stale = NULL;
+    uint32_t hash = 2166136261UL;
+    uint16_t probe, index;
+
+    for( index = 0; index < 6; index++ )
+    {
+        hash = ( hash ^ addr[ index ] ) * 16777619UL;
+    }
+
+    for( probe = 0; probe < decoder->capacity; probe++ )
+    {
+        node = &decoder->nodes[ ( hash + probe ) % decoder->capacity ];
+
+        if( !node->used )
+        {
+            break;
+        }
+
+        if( memcmp( node->addr, addr, 6 ) == 0 )
+        {
+            return node;
+        }
+
+        if( ( stale == NULL ) && ( nowMs - node->lastSeenMs > decoder->staleMs ) )
+        {
+            stale = node;
+        }
+    }
+
+    /*The address is not in the table: reuse a stale node, the slot stays used so the probe sequences through it hold*/
+    if( stale != NULL )
+    {
+        memset( stale, 0, sizeof( BCAST_node_t ) );
+        node = stale;
+        decoder->evictions++;
+    }
+    else if( probe < decoder->capacity )
+    {
+        decoder->count++;
+    }
+    else
+    {
+        return NULL;
+    }
+
+    memcpy( node->addr, addr, 6 );
+    node->used = 1;
+
+    return node;
+}
\ No newline at end of file
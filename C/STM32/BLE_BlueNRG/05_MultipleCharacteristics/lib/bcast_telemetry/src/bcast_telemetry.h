@@ -0,0 +1,157 @@
+/*
+# ##############################################################################
+# File: bcast_telemetry.h                                                      #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 10:44:19 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_BCAST_TELEMETRY_H
+#define INC_BCAST_TELEMETRY_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include <stdint.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Broadcast Telemetry Frame: one sensor value per non-connectable advertisement, the broadcaster rotating through 
+ * the sensors. Shared by the encoder ( firmware ) and the decoder ( gateway, plain C, no HAL ). The frame is the only 
+ * AD structure of the advertising data:
+ * 
+ *  [ 0 ] length ( 8 )      [ 1 ] 0xFF Manufacturer Specific Data   [ 2..3 ] Company Identifier, little endian
+ *  [ 4 ] BCAST_MAGIC       [ 5 ] version << 4 | sensor             [ 6 ] sequence      [ 7..8 ] value, int16 little endian
+ * 
+ * The sequence counts frames ( modulo 256 ). Sensor k of a rotation is sent with sequence base + k, so the frames of 
+ * one rotation share base = sequence - sensor, which is how the decoder puts a reading back together.
+ */
+#define BCAST_COMPANY_ID        0xFFFF      /*None, testing only*/
+#define BCAST_MAGIC             0xB7
+#define BCAST_VERSION           1
+
+#define BCAST_SENSOR_BPM            0
+#define BCAST_SENSOR_WEIGHT         1
+#define BCAST_SENSOR_TEMPERATURE    2
+#define BCAST_SENSOR_HUMIDITY       3
+#define BCAST_SENSOR_NUM            4
+
+#define BCAST_ADV_LEN           9
+#define BCAST_OFF_MAGIC         4
+#define BCAST_OFF_VER_SENSOR    5
+#define BCAST_OFF_SEQ           6
+#define BCAST_OFF_VALUE         7
+
+/*BCAST_decode( ) results*/
+#define BCAST_DEC_FULL          -1          /*New node, no free or stale slot in the node table*/
+#define BCAST_DEC_NONE          0           /*No telemetry frame in the advertising data*/
+#define BCAST_DEC_DUPLICATE     1           /*Frame already decoded ( advertised again until the next rotation step )*/
+#define BCAST_DEC_FRAME         2           /*Frame stored, reading incomplete*/
+#define BCAST_DEC_READING       3           /*Last frame of a rotation, reading written*/
+
+/**
+ * @brief Suggested silence after which a node's state is stale: the sequence is only 8 bits, so after a long enough 
+ * silence it can come back to any value, including the rotation being collected. Keep it a few rotations long and well 
+ * under 128 frame periods ( the span over which a sequence step is still told apart from a restart ).
+ */
+#define BCAST_STALE_MS          10000
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief One Frame
+ * 
+ */
+typedef struct
+{
+    uint8_t     sensor;             /*BCAST_SENSOR_x*/
+    uint8_t     seq;
+    int16_t     value;
+} BCAST_frame_t;
+
+/**
+ * @brief Decoder State of one broadcaster
+ * 
+ */
+typedef struct
+{
+    uint8_t     addr[ 6 ];
+    uint8_t     used;
+    uint8_t     lastSeq;
+    uint8_t     baseSeq;            /*Rotation being collected*/
+    uint8_t     haveMask;           /*Sensors of that rotation received*/
+    int16_t     values[ BCAST_SENSOR_NUM ];
+    uint32_t    frames;
+    uint32_t    duplicates;
+    uint32_t    lost;               /*Frames skipped in the sequence*/
+    uint32_t    restarts;           /*Sequence went backwards ( broadcaster reset )*/
+    uint32_t    stale;              /*Frames after a silence longer than staleMs, the sequence is not compared*/
+    uint32_t    readings;
+    uint32_t    lastSeenMs;         /*Time of the last frame, duplicates included*/
+} BCAST_node_t;
+
+/**
+ * @brief Decoder: a node table provided by the caller, open addressing on the address
+ * 
+ */
+typedef struct
+{
+    BCAST_node_t    *nodes;
+    uint16_t        capacity;
+    uint16_t        count;
+    uint32_t        staleMs;        /*Silence that breaks the rotation being collected, and frees the node for a new address*/
+    uint32_t        evictions;      /*Stale nodes given to a new address, their counters are lost*/
+} BCAST_decoder_t;
+
+/**
+ * @brief Complete Reading, all sensors of one rotation
+ * 
+ */
+typedef struct
+{
+    const uint8_t   *addr;          /*Points into the node table*/
+    uint8_t         baseSeq;
+    int16_t         values[ BCAST_SENSOR_NUM ];
+} BCAST_reading_t;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+uint8_t BCAST_encode( const BCAST_frame_t *frame, uint8_t *adv );
+int BCAST_parse( const uint8_t *adv, uint8_t len, BCAST_frame_t *frame );
+void BCAST_decoderInit( BCAST_decoder_t *decoder, BCAST_node_t *nodes, uint16_t capacity, uint32_t staleMs );
+int BCAST_decode( BCAST_decoder_t *decoder, const uint8_t addr[ 6 ], const uint8_t *adv, uint8_t len, uint32_t nowMs, BCAST_reading_t *reading );
+
+#endif
\ No newline at end of file
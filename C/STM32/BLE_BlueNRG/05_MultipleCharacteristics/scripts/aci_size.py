@@ -0,0 +1,62 @@
+# ACI Flash Report
+#
+# Runs after each link and prints the flash taken by the ACI / HCI command
+# layer that survived --gc-sections: code, and tables ( descriptors, consts,
+# initialised data is counted too since its image sits in flash ).
+# Compare the descriptor engine against the generated wrappers with:
+#
+#   pio run -e nucleo_f411re -e nucleo_f411re_aci_generated
+
+import glob
+import os
+import subprocess
+
+Import("env")
+
+# Objects of the command layer, the transport and the event parsers are not counted
+ACI_OBJECTS = (
+    "aci_marshal.o",
+    "bluenrg1_hci_le.o",
+    "bluenrg1_gap_aci.o",
+    "bluenrg1_gatt_aci.o",
+    "bluenrg1_hal_aci.o",
+    "bluenrg1_l2cap_aci.o",
+)
+
+
+def nm_lines(nm, path, *args):
+    out = subprocess.check_output([nm, "--defined-only"] + list(args) + [path])
+    return out.decode().splitlines()
+
+
+def aci_size(target, source, env):
+    nm = env.subst("$OBJCOPY").replace("objcopy", "nm")
+    build_dir = env.subst("$BUILD_DIR")
+
+    # Symbols defined by the command layer objects
+    names = set()
+    for obj in glob.glob(os.path.join(build_dir, "**", "*.o"), recursive=True):
+        if os.path.basename(obj) in ACI_OBJECTS:
+            for line in nm_lines(nm, obj):
+                fields = line.split()
+                if len(fields) == 3 and fields[1] in "TtRrDd":
+                    names.add(fields[2])
+
+    # Their sizes in the linked image
+    code = tables = count = 0
+    for line in nm_lines(nm, str(target[0]), "-S"):
+        fields = line.split()
+        if len(fields) != 4 or fields[3] not in names:
+            continue
+        size = int(fields[1], 16)
+        if fields[2] in "Tt":
+            code += size
+            count += 1
+        elif fields[2] in "RrDd":
+            tables += size
+
+    print("ACI flash [%s]: %d functions, code %d bytes, tables %d bytes, total %d bytes" % (
+        env.subst("$PIOENV"), count, code, tables, code + tables))
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", aci_size)
@@ -0,0 +1,216 @@
+/*
+# ##############################################################################
+# File: adv_payload.c                                                          #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 10:26:05 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "adv_payload.h"
+#include "services.h"
+#include "bluenrg1_gap.h"
+#include "bluenrg1_gap_aci.h"
+#include "bluenrg1_hci_le.h"
+#include "hci_const.h"
+#include "link_layer.h"
+#include <stdio.h>
+#include <string.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static void ADV_encodeSensors( const int32_t values[ ADV_SENSOR_NUM ], uint8_t *out );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Scan Response: the Health Service UUID ( 128 bit, incomplete list, a second one would not fit )*/
+#define ADV_SCAN_RSP_LEN        18
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Advertising Payload, assembled at build time: only the sensor values of the Manufacturer Specific Data change*/
+static uint8_t advPayload[ ADV_PAYLOAD_LEN ] = 
+{
+    ADV_FLAGS_AD_LEN - 1,   AD_TYPE_FLAGS,                          FLAG_BIT_LE_GENERAL_DISCOVERABLE_MODE | FLAG_BIT_BR_EDR_NOT_SUPPORTED,
+    ADV_NAME_AD_LEN - 1,    AD_TYPE_COMPLETE_LOCAL_NAME,            ADV_NAME,
+    ADV_MFR_AD_LEN - 1,     AD_TYPE_MANUFACTURER_SPECIFIC_DATA,     ( uint8_t )ADV_COMPANY_ID, ( uint8_t )( ADV_COMPANY_ID >> 8 ),
+};
+
+static uint8_t      advActive       = FALSE;        /*Advertising, changes are pushed at once*/
+static uint8_t      advDirty        = FALSE;        /*Values changed while not advertising*/
+static ADV_stats_t  advStats;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Start connectable undirected advertising with the whole payload. The GAP writes the Flags itself, the Name 
+ * and the Manufacturer Specific Data follow with aci_gap_update_adv_data( ), the Scan Response is set once.
+ * Call again after every disconnection. If a step after aci_gap_set_discoverable( ) fails, advertising is stopped 
+ * again: the device is never left discoverable with part of the payload, and the next call starts over.
+ * 
+ * @return tBleStatus First failing command status, BLE_STATUS_SUCCESS otherwise
+ */
+tBleStatus ADV_start( void )
+{
+    static uint8_t scanRspSet = FALSE;
+    uint8_t scanRsp[ ADV_SCAN_RSP_LEN ];
+    tBleStatus ret;
+
+    advStats.starts++;
+
+    ret = aci_gap_set_discoverable( ADV_IND, ADV_INTERVAL_MIN, ADV_INTERVAL_MAX, PUBLIC_ADDR, NO_WHITE_LIST_USE, 0, NULL, 0, NULL, 0, 0 );
+    if( ret != BLE_STATUS_SUCCESS )
+    {
+        advStats.failures++;
+        return ret;
+    }
+
+    ret = aci_gap_update_adv_data( ADV_NAME_AD_LEN, &advPayload[ ADV_NAME_OFFSET ] );
+    if( ret == BLE_STATUS_SUCCESS )
+    {
+        ret = aci_gap_update_adv_data( ADV_MFR_AD_LEN, &advPayload[ ADV_MFR_OFFSET ] );
+    }
+    if( ( ret == BLE_STATUS_SUCCESS ) && !scanRspSet )
+    {
+        scanRsp[ 0 ] = ADV_SCAN_RSP_LEN - 1;
+        scanRsp[ 1 ] = AD_TYPE_128_BIT_SERV_UUID;
+        memcpy( &scanRsp[ 2 ], HEALTH_SERVICE_UUID, sizeof( HEALTH_SERVICE_UUID ) );
+
+        ret = hci_le_set_scan_response_data( sizeof( scanRsp ), scanRsp );
+        scanRspSet = ( ret == BLE_STATUS_SUCCESS );
+    }
+
+    if( ret != BLE_STATUS_SUCCESS )
+    {
+        aci_gap_set_non_discoverable( );
+        advStats.failures++;
+        return ret;
+    }
+
+    advActive   = TRUE;
+    advDirty    = FALSE;
+    return ret;
+}
+
+/**
+ * @brief Advertising stopped ( connection ): value changes are held until the next ADV_start( )
+ * 
+ */
+void ADV_stopped( void )
+{
+    advActive = FALSE;
+}
+
+/**
+ * @brief New sensor values. Nothing is sent when they encode to the advertised bytes, otherwise only the Manufacturer 
+ * Specific Data AD structure is replaced, while advertising goes on.
+ * 
+ * @param values Sensor values, indexed by ADV_SENSOR_x, clamped to int16
+ * @return tBleStatus aci_gap_update_adv_data( ) status, BLE_STATUS_SUCCESS if nothing had to be sent
+ */
+tBleStatus ADV_setSensors( const int32_t values[ ADV_SENSOR_NUM ] )
+{
+    uint8_t encoded[ 2 * ADV_SENSOR_NUM ];
+    tBleStatus ret;
+
+    ADV_encodeSensors( values, encoded );
+
+    if( memcmp( encoded, &advPayload[ ADV_MFR_VALUES_OFFSET ], sizeof( encoded ) ) == 0 )
+    {
+        advStats.unchanged++;
+        return BLE_STATUS_SUCCESS;
+    }
+
+    memcpy( &advPayload[ ADV_MFR_VALUES_OFFSET ], encoded, sizeof( encoded ) );
+
+    if( !advActive )
+    {
+        advStats.deferred += !advDirty;
+        advDirty = TRUE;
+        return BLE_STATUS_SUCCESS;
+    }
+
+    ret = aci_gap_update_adv_data( ADV_MFR_AD_LEN, &advPayload[ ADV_MFR_OFFSET ] );
+    if( ret != BLE_STATUS_SUCCESS )
+    {
+        advStats.failures++;
+        return ret;
+    }
+
+    advStats.pushes++;
+    advStats.pushBytes += ADV_MFR_AD_LEN;
+    return ret;
+}
+
+/**
+ * @brief Copy of the Advertising Counters
+ * 
+ * @param stats Advertising Counters
+ */
+void ADV_getStats( ADV_stats_t *stats )
+{
+    *stats = advStats;
+}
+
+/**
+ * @brief Print the Advertising Counters over the Serial Port
+ * 
+ */
+void ADV_dumpStats( void )
+{
+    printf( "Advertising: %s \r\n", advActive ? "on" : "off" );
+    printf( "  starts %lu, pushes %lu ( %lu bytes ), unchanged %lu, deferred %lu, failures %lu \r\n", 
+            ( unsigned long )advStats.starts, ( unsigned long )advStats.pushes, ( unsigned long )advStats.pushBytes, 
+            ( unsigned long )advStats.unchanged, ( unsigned long )advStats.deferred, ( unsigned long )advStats.failures );
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Sensor values as int16 little endian, clamped
+ * 
+ */
+static void ADV_encodeSensors( const int32_t values[ ADV_SENSOR_NUM ], uint8_t *out )
+{
+    int32_t value;
+    uint8_t index;
+
+    for( index = 0; index < ADV_SENSOR_NUM; index++ )
+    {
+        value = values[ index ];
+        value = ( value > INT16_MAX ) ? INT16_MAX : ( ( value < INT16_MIN ) ? INT16_MIN : value );
+
+        *out++ = ( uint8_t )value;
+        *out++ = ( uint8_t )( ( uint16_t )value >> 8 );
+    }
+}
\ No newline at end of file
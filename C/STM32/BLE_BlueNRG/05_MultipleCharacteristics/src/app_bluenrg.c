@@ -5,7 +5,7 @@
 # Created Date: Wednesday, October 25th 2023, 5:29:08 pm                       #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Saturday, October 28th 2023, 12:08:12 pm                      #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -18,12 +18,19 @@
 
 #include "app_bluenrg.h"
 #include "services.h"
+#include "scheduler.h"
+#include "scanner.h"
+#include "adv_payload.h"
+#include "broadcaster.h"
 #include <stdio.h>
 
 /*##############################################################################################################################################*/
 /*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
+#if APP_SCAN_ENABLE
+static void APP_scanReportCB( const Advertising_Report_t *report );
+#endif
 
 
 /*##############################################################################################################################################*/
@@ -32,6 +39,9 @@
 
 uint8_t serverBTDeviceAddr[ ] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
 
+/*Periodic BLE Task wake up ( advertising refresh ), events from the BlueNRG post the task directly*/
+static SCHED_timer_t blePollTimer;
+
 /*##############################################################################################################################################*/
 /*DEFINES_______________________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
@@ -60,7 +70,9 @@ uint8_t serverBTDeviceAddr[ ] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
  */
 void blueNRG_init( void ) 
 {
+#if !APP_BROADCAST_ENABLE
     const char *deviceName = "01_BLE";
+#endif
     tBleStatus ret;
     uint8_t BTDeviceAddr[ BD_ADDR_SIZE ];
     memcpy( BTDeviceAddr, serverBTDeviceAddr, sizeof( serverBTDeviceAddr ) );
@@ -122,7 +134,7 @@ void blueNRG_init( void )
     - Appearance
     - Peripheral Preferred Connnection Parameters ( Peripheral Role Only ) */
     ret = aci_gap_init( 
-        GAP_PERIPHERAL_ROLE, 
+        APP_GAP_ROLE, 
         PRIVACY_DISABLED, 
         DEVICE_NAME_LEN,  
         &serviceHdl, 
@@ -134,6 +146,9 @@ void blueNRG_init( void )
         printf( " ACI GAP Init: FAILED !! \r\n " );
     }
 
+#if !APP_BROADCAST_ENABLE
+    /*5. and 6. serve the connectable GATT Server, out of reach of a Broadcaster*/
+
     /*5. Update Device Name Characteristic Value */
     ret = aci_gatt_update_char_value( 
         serviceHdl, 
@@ -153,6 +168,16 @@ void blueNRG_init( void )
     {
         printf( " Add Simple Service: FAILED !! \r\n " );
     }
+#endif
+
+#if APP_SCAN_ENABLE
+    /*7. Start Observing*/
+    ret = SCAN_start( APP_scanReportCB );
+    if( ret != BLE_STATUS_SUCCESS )
+    {
+        printf( " Scanner Start: FAILED !! \r\n " );
+    }
+#endif
     
 }
 
@@ -162,24 +187,63 @@ void blueNRG_init( void )
  */
 void blueNRG_process( void )
 {
-    tBleStatus ret;
-    uint8_t localName[ ] = { AD_TYPE_COMPLETE_LOCAL_NAME, 'Y', 'O', 'U', 'R', '-', 'M', 'O', 'M' };
-    
-    /*Set the server discoverable*/
-    ret = aci_gap_set_discoverable(
-        ADV_IND, 
-        0,
-        0, 
-        PUBLIC_ADDR,
-        NO_WHITE_LIST_USE,
-        sizeof( localName ),
-        localName,
-        0, 
-        NULL,
-        0, 
-        0
-    );
+    int32_t sensors[ BCAST_SENSOR_NUM ];
+
+    sensors[ BCAST_SENSOR_BPM ]         = BPM;
+    sensors[ BCAST_SENSOR_WEIGHT ]      = WEIGHT;
+    sensors[ BCAST_SENSOR_TEMPERATURE ] = TEMPERATURE;
+    sensors[ BCAST_SENSOR_HUMIDITY ]    = HUMIDITY;
+
+#if APP_BROADCAST_ENABLE
+    /*Rotate the sensor frames on air*/
+    BCAST_process( sensors );
+#else
+    /*Set the server discoverable once, again after each disconnection*/
+    if( FLAG_SET_CONNECTABLE && ( ADV_start( ) == BLE_STATUS_SUCCESS ) )
+    {
+        FLAG_SET_CONNECTABLE = FALSE;
+    }
+
+    /*Broadcast the sensor values, only a change reaches the BlueNRG*/
+    ADV_setSensors( sensors );
+#endif
 
     /*Process User Events*/
     hci_user_evt_proc( );
-}
\ No newline at end of file
+}
+
+/**
+ * @brief BLE Scheduler Task: runs blueNRG_process( ) when the BlueNRG raised its IRQ line or the poll timer expired
+ * 
+ * @param arg Unused
+ */
+void blueNRG_task( void *arg )
+{
+    ( void )arg;
+    blueNRG_process( );
+}
+
+/**
+ * @brief Register the BLE Task with the Scheduler and start its poll timer
+ * 
+ */
+void blueNRG_startTasks( void )
+{
+    SCHED_taskCreate( APP_TASK_BLE, blueNRG_task, NULL, "ble" );
+    SCHED_timerStart( &blePollTimer, APP_TASK_BLE, APP_BLE_POLL_MS / SCHED_TICK_MS, APP_BLE_POLL_MS / SCHED_TICK_MS );
+    SCHED_post( APP_TASK_BLE );
+}
+
+#if APP_SCAN_ENABLE
+/**
+ * @brief Scanner Callback: one line per report, at most SCAN_RATE_PER_S of them
+ * 
+ * @param report Advertising Report, valid during the call only
+ */
+static void APP_scanReportCB( const Advertising_Report_t *report )
+{
+    printf( "ADV %02X:%02X:%02X:%02X:%02X:%02X type %u rssi %d len %u \r\n", report->Address[ 5 ], report->Address[ 4 ], 
+            report->Address[ 3 ], report->Address[ 2 ], report->Address[ 1 ], report->Address[ 0 ], report->Event_Type, 
+            report->RSSI, report->Length_Data );
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,184 @@
+/*
+# ##############################################################################
+# File: broadcaster.c                                                          #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 10:58:40 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 10:58:40 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "broadcaster.h"
+#include "bluenrg1_gap.h"
+#include "bluenrg1_gap_aci.h"
+#include "bluenrg1_hci_le.h"
+#include "link_layer.h"
+#include <stdio.h>
+#include <string.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static void BCAST_encodeNext( const int32_t values[ BCAST_SENSOR_NUM ] );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Advertising Data: the current frame, padded to the 31 bytes hci_le_set_advertising_data( ) copies*/
+static uint8_t          bcastAdv[ 31 ];
+
+static uint8_t          bcastActive     = FALSE;
+static uint8_t          bcastSensor     = 0;            /*Sensor of the next frame, advances with the sequence*/
+static uint32_t         bcastStamp      = 0;            /*HAL tick the current frame went on air*/
+static BCAST_stats_t    bcastStats      = { .periodMs = BCAST_FRAME_PERIOD_MS };
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Start non-connectable broadcasting with the first frame of a rotation. The GAP must have been initialised 
+ * with GAP_BROADCASTER_ROLE.
+ * 
+ * @param values Sensor values, indexed by BCAST_SENSOR_x, clamped to int16
+ * @return tBleStatus aci_gap_set_broadcast_mode( ) status
+ */
+tBleStatus BCAST_start( const int32_t values[ BCAST_SENSOR_NUM ] )
+{
+    tBleStatus ret;
+
+    BCAST_encodeNext( values );
+
+    ret = aci_gap_set_broadcast_mode( BCAST_ADV_INTERVAL_MIN, BCAST_ADV_INTERVAL_MAX, ADV_NONCONN_IND, PUBLIC_ADDR, 
+                                      BCAST_ADV_LEN, bcastAdv, 0, NULL );
+    if( ret != BLE_STATUS_SUCCESS )
+    {
+        bcastStats.failures++;
+        return ret;
+    }
+
+    bcastActive = TRUE;
+    bcastStamp  = HAL_GetTick( );
+    bcastStats.frames++;
+    bcastStats.seq++;
+    bcastSensor = ( bcastSensor + 1 ) % BCAST_SENSOR_NUM;
+
+    return ret;
+}
+
+/**
+ * @brief BLE Task hook: start broadcasting, then replace the frame on air with the next sensor's every period. Only 
+ * the advertising data changes, advertising is never restarted.
+ * 
+ * @param values Sensor values, indexed by BCAST_SENSOR_x
+ * @return tBleStatus Status of the command sent, BLE_STATUS_SUCCESS if none was due
+ */
+tBleStatus BCAST_process( const int32_t values[ BCAST_SENSOR_NUM ] )
+{
+    tBleStatus ret;
+
+    if( !bcastActive )
+    {
+        return BCAST_start( values );
+    }
+
+    if( ( HAL_GetTick( ) - bcastStamp ) < bcastStats.periodMs )
+    {
+        return BLE_STATUS_SUCCESS;
+    }
+
+    BCAST_encodeNext( values );
+
+    ret = hci_le_set_advertising_data( BCAST_ADV_LEN, bcastAdv );
+    if( ret != BLE_STATUS_SUCCESS )
+    {
+        bcastStats.failures++;
+        return ret;
+    }
+
+    bcastStamp = HAL_GetTick( );
+    bcastStats.frames++;
+    bcastStats.seq++;
+    bcastSensor = ( bcastSensor + 1 ) % BCAST_SENSOR_NUM;
+    bcastStats.rotations += ( bcastSensor == 0 );
+
+    return ret;
+}
+
+/**
+ * @brief Set the time each frame stays on air
+ * 
+ * @param periodMs Frame period, at least one advertising interval to be heard
+ */
+void BCAST_setPeriod( uint32_t periodMs )
+{
+    bcastStats.periodMs = periodMs;
+}
+
+/**
+ * @brief Copy of the Broadcaster Counters
+ * 
+ * @param stats Broadcaster Counters
+ */
+void BCAST_getStats( BCAST_stats_t *stats )
+{
+    *stats = bcastStats;
+}
+
+/**
+ * @brief Print the Broadcaster Counters over the Serial Port
+ * 
+ */
+void BCAST_dumpStats( void )
+{
+    printf( "Broadcaster: %s, frame period %lu ms \r\n", bcastActive ? "on" : "off", ( unsigned long )bcastStats.periodMs );
+    printf( "  frames %lu, rotations %lu, failures %lu, next seq %u \r\n", ( unsigned long )bcastStats.frames, 
+            ( unsigned long )bcastStats.rotations, ( unsigned long )bcastStats.failures, bcastStats.seq );
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Encode the next sensor's frame into the advertising data
+ * 
+ */
+static void BCAST_encodeNext( const int32_t values[ BCAST_SENSOR_NUM ] )
+{
+    BCAST_frame_t frame;
+    int32_t value = values[ bcastSensor ];
+
+    frame.sensor    = bcastSensor;
+    frame.seq       = bcastStats.seq;
+    frame.value     = ( int16_t )( ( value > INT16_MAX ) ? INT16_MAX : ( ( value < INT16_MIN ) ? INT16_MIN : value ) );
+
+    BCAST_encode( &frame, bcastAdv );
+}
\ No newline at end of file
@@ -0,0 +1,282 @@
+/*
+# ##############################################################################
+# File: hci_stats.c                                                            #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 7:41:52 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "hci_stats.h"
+#include "hci_tl.h"
+#include <string.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static HSTAT_entry_t *HSTAT_lookup( uint16_t opcode, uint8_t create );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static HSTAT_entry_t    hstatTable[ HSTAT_MAX_OPCODES ];
+static uint8_t          hstatCount = 0;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Account one hci_send_req( ). Called from task context only, like hci_send_req( ) itself.
+ * 
+ * @param ogf Opcode Group Field
+ * @param ocf Opcode Command Field
+ * @param result HSTAT_result_t
+ * @param cycles Send to completion ( or failure )
+ * @param diverted Events parked in hciTempQueue
+ * @param dropped Events discarded
+ */
+void HSTAT_record( uint16_t ogf, uint16_t ocf, uint8_t result, uint32_t cycles, uint8_t diverted, uint8_t dropped )
+{
+    HSTAT_entry_t *entry;
+    uint32_t cyclesPerUs, us;
+    uint8_t bucket;
+
+    entry = HSTAT_lookup( ( uint16_t )( ( ogf << 10 ) | ( ocf & 0x03FF ) ), TRUE );
+
+    entry->calls++;
+    entry->diverted += diverted;
+    entry->dropped  += dropped;
+
+    switch( result )
+    {
+        case HSTAT_FAILED:
+            entry->failures++;
+            return;
+
+        case HSTAT_TIMEOUT:
+            entry->timeouts++;
+            break;
+
+        case HSTAT_ASYNC:
+            entry->async++;
+            return;
+
+        default:
+            break;
+    }
+
+    /*Latency: completed calls and timeouts ( the last bucket shows how often the full timeout was paid )*/
+    cyclesPerUs = SystemCoreClock / 1000000UL;
+    us          = cycles / ( ( cyclesPerUs == 0 ) ? 1 : cyclesPerUs );
+    bucket      = ( us == 0 ) ? 0 : ( uint8_t )( 31 - __builtin_clz( us ) );
+    bucket      = ( bucket >= HSTAT_HIST_BUCKETS ) ? ( HSTAT_HIST_BUCKETS - 1 ) : bucket;
+    entry->hist[ bucket ]++;
+
+    if( result != HSTAT_OK )
+    {
+        return;
+    }
+
+    if( ( entry->calls - entry->failures - entry->timeouts - entry->async == 1 ) || ( us < entry->latencyMinUs ) )
+    {
+        entry->latencyMinUs = us;
+    }
+    entry->latencyMaxUs     = ( us > entry->latencyMaxUs ) ? us : entry->latencyMaxUs;
+    entry->latencyTotalUs   += us;
+}
+
+/**
+ * @brief Number of opcodes in the table ( including the overflow entry )
+ * 
+ */
+uint8_t HSTAT_getCount( void )
+{
+    return hstatCount;
+}
+
+/**
+ * @brief Copy a table entry, in order of first use
+ * 
+ * @param index 0..HSTAT_getCount( ) - 1
+ * @param entry Opcode Statistics
+ * @return uint8_t TRUE if copied, FALSE if index is out of range
+ */
+uint8_t HSTAT_getEntry( uint8_t index, HSTAT_entry_t *entry )
+{
+    if( index >= hstatCount )
+    {
+        return FALSE;
+    }
+
+    *entry = hstatTable[ index ];
+
+    return TRUE;
+}
+
+/**
+ * @brief Copy the statistics of one command
+ * 
+ * @param ogf Opcode Group Field
+ * @param ocf Opcode Command Field
+ * @param entry Opcode Statistics
+ * @return uint8_t TRUE if copied, FALSE if the command was never sent
+ */
+uint8_t HSTAT_getOpcode( uint16_t ogf, uint16_t ocf, HSTAT_entry_t *entry )
+{
+    HSTAT_entry_t *found = HSTAT_lookup( ( uint16_t )( ( ogf << 10 ) | ( ocf & 0x03FF ) ), FALSE );
+
+    if( found == NULL )
+    {
+        return FALSE;
+    }
+
+    *entry = *found;
+
+    return TRUE;
+}
+
+/**
+ * @brief Clear the table
+ * 
+ */
+void HSTAT_reset( void )
+{
+    memset( hstatTable, 0, sizeof( hstatTable ) );
+    hstatCount = 0;
+}
+
+/**
+ * @brief Print the table over the Serial Port ( USART2 ): calls, failures, timeouts, diverted / dropped events, 
+ * latency min / mean / max in us and the non empty histogram buckets as "log2:count"
+ * 
+ */
+void HSTAT_dump( void )
+{
+    tHciRxStats rxStats;
+    tHciRxLaneStats *lane;
+    HSTAT_entry_t *entry;
+    uint32_t completed, mean;
+    uint8_t index, bucket;
+
+    printf( "HCI Commands: %u opcodes \r\n", hstatCount );
+    printf( "  ogf  ocf    calls  fail   tmo    divert drop   min us   mean us  max us   histogram \r\n" );
+
+    for( index = 0; index < hstatCount; index++ )
+    {
+        entry       = &hstatTable[ index ];
+        completed   = entry->calls - entry->failures - entry->timeouts - entry->async;
+        mean        = ( completed != 0 ) ? ( uint32_t )( entry->latencyTotalUs / completed ) : 0;
+
+        if( entry->opcode == HSTAT_OPCODE_OTHER )
+        {
+            printf( "  other     " );
+        }
+        else
+        {
+            printf( "  0x%02X 0x%03X ", HSTAT_OGF( entry->opcode ), HSTAT_OCF( entry->opcode ) );
+        }
+
+        printf( "%-6lu %-6lu %-6lu %-6lu %-6lu %-8lu %-8lu %-8lu", ( unsigned long )entry->calls, ( unsigned long )entry->failures, 
+                ( unsigned long )entry->timeouts, ( unsigned long )entry->diverted, ( unsigned long )entry->dropped, 
+                ( unsigned long )entry->latencyMinUs, ( unsigned long )mean, ( unsigned long )entry->latencyMaxUs );
+
+        for( bucket = 0; bucket < HSTAT_HIST_BUCKETS; bucket++ )
+        {
+            if( entry->hist[ bucket ] != 0 )
+            {
+                printf( " %u:%lu", bucket, ( unsigned long )entry->hist[ bucket ] );
+            }
+        }
+        printf( " \r\n" );
+    }
+
+    hci_get_rx_stats( &rxStats );
+    printf( "HCI Receive: stalls %lu resumes %lu reserve used %lu moved %lu held %lu%s \r\n", ( unsigned long )rxStats.stalls, 
+            ( unsigned long )rxStats.resumes, ( unsigned long )rxStats.reserveUsed, ( unsigned long )rxStats.reserveMoved, 
+            ( unsigned long )rxStats.reserveHeld, hci_rx_throttled( ) ? " ( throttled )" : "" );
+    printf( "  lane  queued dropped over   filtered processed depth  mean us  max us \r\n" );
+
+    for( index = 0; index < HCI_RX_LANE_NUM; index++ )
+    {
+        lane = &rxStats.lane[ index ];
+        mean = ( lane->processed != 0 ) ? ( uint32_t )( lane->residencyTotalUs / lane->processed ) : 0;
+
+        printf( "  %-5s %-6lu %-7lu %-6lu %-8lu %-9lu %-6u %-8lu %-8lu \r\n", ( index == HCI_RX_LANE_HIGH ) ? "high" : "bulk", 
+                ( unsigned long )lane->queued, ( unsigned long )lane->dropped, ( unsigned long )lane->overQuota, 
+                ( unsigned long )lane->filtered, ( unsigned long )lane->processed, lane->depthMax, 
+                ( unsigned long )mean, ( unsigned long )lane->residencyMaxUs );
+    }
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Find the entry of an opcode, optionally adding it. The last slot is kept for the overflow entry.
+ * 
+ * @return HSTAT_entry_t* Entry, NULL if not found and create is FALSE
+ */
+static HSTAT_entry_t *HSTAT_lookup( uint16_t opcode, uint8_t create )
+{
+    uint8_t index;
+
+    for( index = 0; index < hstatCount; index++ )
+    {
+        if( hstatTable[ index ].opcode == opcode )
+        {
+            return &hstatTable[ index ];
+        }
+    }
+
+    if( create == FALSE )
+    {
+        return NULL;
+    }
+
+    if( hstatCount >= ( HSTAT_MAX_OPCODES - 1 ) )
+    {
+        /*Table full: share the overflow entry*/
+        opcode = HSTAT_OPCODE_OTHER;
+        for( index = 0; index < hstatCount; index++ )
+        {
+            if( hstatTable[ index ].opcode == opcode )
+            {
+                return &hstatTable[ index ];
+            }
+        }
+    }
+
+    hstatTable[ hstatCount ].opcode = opcode;
+
+    return &hstatTable[ hstatCount++ ];
+}
\ No newline at end of file
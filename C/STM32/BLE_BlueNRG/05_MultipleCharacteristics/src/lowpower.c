@@ -0,0 +1,292 @@
+/*
+# ##############################################################################
+# File: lowpower.c                                                             #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 6:14:09 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 6:14:09 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "lowpower.h"
+#include "scheduler.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static void LPWR_sleep( void );
+static void LPWR_stop( uint32_t ms );
+static uint32_t LPWR_rtcCounts( void );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+RTC_HandleTypeDef hrtc;
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*The STOP time is handed to the Scheduler in milliseconds*/
+#if SCHED_TICK_MS != 1
+#error "LPWR expects a 1 ms Scheduler tick"
+#endif
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static LPWR_stats_t lpwrStats;
+static uint32_t     lpwrSubMs = 0;      /*STOP time not yet handed to the tick, LPWR_RTC_SYNC_HZ / 1000 units*/
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Initialize the Low Power Idle: RTC on LSE ( or LSI ) for the Wakeup Timer, then replace the Scheduler idle. 
+ * Wake Sources from STOP are the RTC Wakeup Timer and the EXTI lines already in interrupt mode: BlueNRG IRQ ( EXTI0 ) and Push_Btn1.
+ * Call after SCHED_init( ).
+ * 
+ * @return HAL_StatusTypeDef HAL_OK, otherwise the Scheduler keeps its WFI idle
+ */
+HAL_StatusTypeDef LPWR_init( void )
+{
+    RCC_OscInitTypeDef RCC_OscInitStruct = { 0 };
+    RCC_PeriphCLKInitTypeDef PeriphClkInitStruct = { 0 };
+
+    /*1. RTC Clock, in the Backup Domain*/
+    __HAL_RCC_PWR_CLK_ENABLE( );
+    HAL_PWR_EnableBkUpAccess( );
+
+#if LPWR_RTC_USE_LSE
+    RCC_OscInitStruct.OscillatorType        = RCC_OSCILLATORTYPE_LSE;
+    RCC_OscInitStruct.LSEState              = RCC_LSE_ON;
+    PeriphClkInitStruct.RTCClockSelection   = RCC_RTCCLKSOURCE_LSE;
+#else
+    RCC_OscInitStruct.OscillatorType        = RCC_OSCILLATORTYPE_LSI;
+    RCC_OscInitStruct.LSIState              = RCC_LSI_ON;
+    PeriphClkInitStruct.RTCClockSelection   = RCC_RTCCLKSOURCE_LSI;
+#endif
+    RCC_OscInitStruct.PLL.PLLState          = RCC_PLL_NONE;
+    if( HAL_RCC_OscConfig( &RCC_OscInitStruct ) != HAL_OK )
+    {
+        return HAL_ERROR;
+    }
+
+    PeriphClkInitStruct.PeriphClockSelection = RCC_PERIPHCLK_RTC;
+    if( HAL_RCCEx_PeriphCLKConfig( &PeriphClkInitStruct ) != HAL_OK )
+    {
+        return HAL_ERROR;
+    }
+    __HAL_RCC_RTC_ENABLE( );
+
+    /*2. RTC: Sub Seconds at LPWR_RTC_SYNC_HZ, read straight from the counters ( the shadow registers are stale after STOP )*/
+    hrtc.Instance               = RTC;
+    hrtc.Init.HourFormat        = RTC_HOURFORMAT_24;
+    hrtc.Init.AsynchPrediv      = LPWR_RTC_ASYNC_DIV - 1;
+    hrtc.Init.SynchPrediv       = LPWR_RTC_SYNC_HZ - 1;
+    hrtc.Init.OutPut            = RTC_OUTPUT_DISABLE;
+    hrtc.Init.OutPutPolarity    = RTC_OUTPUT_POLARITY_HIGH;
+    hrtc.Init.OutPutType        = RTC_OUTPUT_TYPE_OPENDRAIN;
+    if( HAL_RTC_Init( &hrtc ) != HAL_OK )
+    {
+        return HAL_ERROR;
+    }
+    HAL_RTCEx_EnableBypassShadow( &hrtc );
+
+    /*3. Wakeup Timer Interrupt ( EXTI line 22 ), needed for the WFI to leave STOP*/
+    HAL_NVIC_SetPriority( RTC_WKUP_IRQn, 0, 0 );
+    HAL_NVIC_EnableIRQ( RTC_WKUP_IRQn );
+
+    memset( &lpwrStats, 0, sizeof( lpwrStats ) );
+    lpwrSubMs = 0;
+
+    SCHED_setIdleHook( LPWR_idle );
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Scheduler Idle Hook ( interrupts disabled ). Sleeps until the next timer: STOP when the gap is long enough, 
+ * Sleep otherwise or when no timer is running and STOP is disabled.
+ * 
+ * @param ticksToTimer Ticks until the next timer, SCHED_NO_TIMER if none
+ */
+void LPWR_idle( uint32_t ticksToTimer )
+{
+#if LPWR_USE_STOP
+    if( ticksToTimer >= LPWR_STOP_MIN_MS )
+    {
+        LPWR_stop( ( ticksToTimer > LPWR_STOP_MAX_MS ) ? LPWR_STOP_MAX_MS : ticksToTimer );
+        return;
+    }
+#else
+    ( void )ticksToTimer;
+#endif
+
+    LPWR_sleep( );
+}
+
+/**
+ * @brief Copy the Low Power Idle Statistics
+ * 
+ * @param stats Statistics
+ */
+void LPWR_getStats( LPWR_stats_t *stats )
+{
+    uint32_t primask = __get_PRIMASK( );
+
+    __disable_irq( );
+    *stats = lpwrStats;
+    __set_PRIMASK( primask );
+}
+
+/**
+ * @brief Print the residency ( per mille of the uptime in STOP / Sleep / Run ) and the wake latency over the Serial Port
+ * 
+ */
+void LPWR_dumpStats( void )
+{
+    LPWR_stats_t stats;
+    uint32_t uptimeMs, sleepMs, runMs, meanUs;
+
+    LPWR_getStats( &stats );
+
+    uptimeMs    = HAL_GetTick( );
+    uptimeMs    = ( uptimeMs == 0 ) ? 1 : uptimeMs;
+    sleepMs     = ( uint32_t )( stats.sleepCycles / ( SystemCoreClock / 1000 ) );
+    runMs       = ( uptimeMs > ( stats.stopMs + sleepMs ) ) ? ( uptimeMs - stats.stopMs - sleepMs ) : 0;
+    meanUs      = ( stats.stopEntries != 0 ) ? ( uint32_t )( stats.wakeLatencySumUs / stats.stopEntries ) : 0;
+
+    printf( "Low Power: uptime %lu ms \r\n", ( unsigned long )uptimeMs );
+    printf( "  stop  %-10lu ms %4lu permille, entries %lu ( rtc %lu, exti %lu ) \r\n", ( unsigned long )stats.stopMs, 
+            ( unsigned long )( ( uint64_t )stats.stopMs * 1000 / uptimeMs ), ( unsigned long )stats.stopEntries, 
+            ( unsigned long )stats.wakeRtc, ( unsigned long )stats.wakeExti );
+    printf( "  sleep %-10lu ms %4lu permille, entries %lu \r\n", ( unsigned long )sleepMs, 
+            ( unsigned long )( ( uint64_t )sleepMs * 1000 / uptimeMs ), ( unsigned long )stats.sleepEntries );
+    printf( "  run   %-10lu ms %4lu permille \r\n", ( unsigned long )runMs, ( unsigned long )( ( uint64_t )runMs * 1000 / uptimeMs ) );
+    printf( "  wake latency: last %lu us, mean %lu us, max %lu us \r\n", ( unsigned long )stats.wakeLatencyLastUs, 
+            ( unsigned long )meanUs, ( unsigned long )stats.wakeLatencyMaxUs );
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Sleep until the next interrupt, at most until the next SysTick. The SysTick counter measures the time asleep 
+ * ( DWT stops with the core clock ), it wraps at most once since its interrupt ends the Sleep.
+ * 
+ */
+static void LPWR_sleep( void )
+{
+    uint32_t before, after;
+
+    before = SysTick->VAL;
+    HAL_PWR_EnterSLEEPMode( PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI );
+    after = SysTick->VAL;
+
+    lpwrStats.sleepEntries++;
+    lpwrStats.sleepCycles += ( before >= after ) ? ( before - after ) : ( before + SysTick->LOAD + 1 - after );
+}
+
+/**
+ * @brief STOP for up to ms milliseconds. The Wakeup Timer ends it unless an EXTI line does first, the RTC calendar 
+ * measures the time actually spent so HAL_GetTick( ) and the Scheduler time can be moved forward by it.
+ * On exit the PLL is restarted ( STOP falls back to HSI ).
+ * 
+ * @param ms Idle period, >= LPWR_STOP_MIN_MS
+ */
+static void LPWR_stop( uint32_t ms )
+{
+    uint32_t wakeCounts, start, elapsed, cycles, latencyUs, stopMs;
+
+    wakeCounts = ( ( ms - LPWR_WAKE_MARGIN_MS ) * LPWR_RTC_WAKEUP_HZ ) / 1000;
+
+    HAL_SuspendTick( );
+    if( HAL_RTCEx_SetWakeUpTimer_IT( &hrtc, wakeCounts - 1, RTC_WAKEUPCLOCK_RTCCLK_DIV16 ) != HAL_OK )
+    {
+        HAL_ResumeTick( );
+        LPWR_sleep( );
+        return;
+    }
+
+    start = LPWR_rtcCounts( );
+    HAL_PWR_EnterSTOPMode( PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI );
+
+    /*Clocks: measured on HSI up to the PLL switch, the conversion at HSI speed makes it an upper bound*/
+    cycles = DWT->CYCCNT;
+    SystemClock_Config( );
+    HAL_ResumeTick( );
+    cycles      = DWT->CYCCNT - cycles;
+    latencyUs   = cycles / ( HSI_VALUE / 1000000 );
+
+    /*Wake Source, then disarm: the pending RTC_WKUP interrupt is dropped, it only had to end the WFI*/
+    if( __HAL_RTC_WAKEUPTIMER_GET_FLAG( &hrtc, RTC_FLAG_WUTF ) != RESET )
+    {
+        lpwrStats.wakeRtc++;
+    }
+    else
+    {
+        lpwrStats.wakeExti++;
+    }
+    HAL_RTCEx_DeactivateWakeUpTimer( &hrtc );
+    __HAL_RTC_WAKEUPTIMER_CLEAR_FLAG( &hrtc, RTC_FLAG_WUTF );
+    __HAL_RTC_WAKEUPTIMER_EXTI_CLEAR_FLAG( );
+    HAL_NVIC_ClearPendingIRQ( RTC_WKUP_IRQn );
+
+    /*Time in STOP, the sub millisecond rest carries over to the next STOP*/
+    elapsed     = ( LPWR_rtcCounts( ) + LPWR_RTC_DAY_COUNTS - start ) % LPWR_RTC_DAY_COUNTS;
+    elapsed     = elapsed * 1000 + lpwrSubMs;
+    stopMs      = elapsed / LPWR_RTC_SYNC_HZ;
+    lpwrSubMs   = elapsed % LPWR_RTC_SYNC_HZ;
+
+    /*SysTick was stopped: move both time bases forward, timers that came due are posted*/
+    uwTick += stopMs;
+    SCHED_tickAdvance( stopMs );
+
+    lpwrStats.stopEntries++;
+    lpwrStats.stopMs            += stopMs;
+    lpwrStats.wakeLatencyLastUs = latencyUs;
+    lpwrStats.wakeLatencyMaxUs  = ( latencyUs > lpwrStats.wakeLatencyMaxUs ) ? latencyUs : lpwrStats.wakeLatencyMaxUs;
+    lpwrStats.wakeLatencySumUs  += latencyUs;
+}
+
+/**
+ * @brief RTC time of day in Sub Second counts ( LPWR_RTC_SYNC_HZ ). The counters are read twice until stable, 
+ * the shadow registers are bypassed.
+ * 
+ */
+static uint32_t LPWR_rtcCounts( void )
+{
+    uint32_t ssr, tr, seconds;
+
+    do
+    {
+        ssr = RTC->SSR;
+        tr  = RTC->TR;
+    } while( ( ssr != RTC->SSR ) || ( tr != RTC->TR ) );
+
+    seconds = ( ( ( tr >> 20 ) & 0x3 ) * 10 + ( ( tr >> 16 ) & 0xF ) ) * 3600
+            + ( ( ( tr >> 12 ) & 0x7 ) * 10 + ( ( tr >> 8 ) & 0xF ) ) * 60
+            + ( ( ( tr >> 4 ) & 0x7 ) * 10 + ( tr & 0xF ) );
+
+    /*SSR counts down from SynchPrediv*/
+    return ( seconds * LPWR_RTC_SYNC_HZ ) + ( ( LPWR_RTC_SYNC_HZ - 1 ) - ( ssr & 0xFFFF ) );
+}
\ No newline at end of file
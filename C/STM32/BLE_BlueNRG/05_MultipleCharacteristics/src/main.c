@@ -5,7 +5,7 @@
 # Created Date: Sunday, October 22nd 2023, 3:11:07 pm                          #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Thursday, October 26th 2023, 6:30:15 pm                       #
+# Last Modified: Sunday, October 18th 2026, 11:06:27 pm                        #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -35,6 +35,14 @@
 #include "usart.h"
 #include "gpio.h"
 #include "app_bluenrg.h"
+#include "scheduler.h"
+#include "lowpower.h"
+#include "profile.h"
+#include "hci_stats.h"
+#include "memmon.h"
+#include "scanner.h"
+#include "adv_payload.h"
+#include "broadcaster.h"
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
@@ -65,6 +73,7 @@
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 /* USER CODE BEGIN PFP */
+static void APP_statsTask( void *arg );
 
 /* USER CODE END PFP */
 
@@ -79,12 +88,18 @@ void SystemClock_Config(void);
   */
 int main(void)
 {
+  /* Stack high water mark: paint the free stack before anything runs */
+  MEM_stackPaint();
+
   /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
   HAL_Init();
 
   /* Configure the system clock */
   SystemClock_Config();
 
+  /* Profiling Zones ( DWT cycle counter ) from the first HCI command on */
+  PROF_init();
+
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
   MX_USART2_UART_Init();
@@ -96,15 +111,21 @@ int main(void)
   
   printf( " Initialization Successful \r\n" );
 
-  /* Infinite loop */
-  while (1)
+  /*2. Process BLE Events from the Scheduler: the BLE Task runs on BlueNRG IRQs and on its poll timer, the CPU sleeps in between*/
+  SCHED_init( );
+  blueNRG_startTasks( );
+  SCHED_taskCreate( APP_TASK_STATS, APP_statsTask, NULL, "stats" );
+
+  /*3. Idle in STOP between BLE events, woken by the RTC, the BlueNRG IRQ or Push_Btn1*/
+  if( LPWR_init( ) != HAL_OK )
   {
-    /*2. Process BLE Events*/
-    
-    blueNRG_process( );
-    
-    // bluenrg_process( );
+    printf( " Low Power Idle unavailable, idling with WFI \r\n" );
   }
+  
+  // bluenrg_process( );
+
+  /* Infinite loop */
+  SCHED_run( );
 
 }
 
@@ -152,6 +173,40 @@ void SystemClock_Config(void)
 }
 
 /* USER CODE BEGIN 4 */
+/**
+ * @brief Push_Btn1 requests a statistics dump, printed from task context
+ * 
+ * @param GPIO_Pin EXTI Pin
+ */
+void HAL_GPIO_EXTI_Callback( uint16_t GPIO_Pin )
+{
+  if( GPIO_Pin == Push_Btn1_Pin )
+  {
+    SCHED_post( APP_TASK_STATS );
+  }
+}
+
+/**
+ * @brief Statistics Task: profiling zones, HCI command latencies, scheduler accounting, low power residency, memory usage, scanner and advertising counters over USART2
+ * 
+ * @param arg Unused
+ */
+static void APP_statsTask( void *arg )
+{
+  ( void )arg;
+
+  PROF_DUMP( );
+  HSTAT_dump( );
+  SCHED_dumpStats( );
+  LPWR_dumpStats( );
+  MEM_dumpStats( );
+  SCAN_dumpStats( );
+#if APP_BROADCAST_ENABLE
+  BCAST_dumpStats( );
+#else
+  ADV_dumpStats( );
+#endif
+}
 
 /* USER CODE END 4 */
 
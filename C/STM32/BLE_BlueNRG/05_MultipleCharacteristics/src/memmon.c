@@ -0,0 +1,169 @@
+/*
+# ##############################################################################
+# File: memmon.c                                                               #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 8:10:37 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 8:10:37 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "memmon.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static uint32_t *MEM_stackLowWater( void );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Linker Script Symbols*/
+extern uint8_t _end;
+extern uint8_t _estack;
+extern uint32_t _Min_Stack_Size;
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static const uint8_t    *memHeapEnd     = &_end;
+static const uint8_t    *memHeapPeak    = &_end;
+static uint32_t         *memPaintBottom = NULL;    /*Lowest painted word, NULL before MEM_stackPaint( )*/
+static uint32_t         memFailures     = 0;
+static uint32_t         memFailLargest  = 0;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Paint the free MSP stack, from the heap break up to just below the current stack pointer. Call first thing 
+ * in main( ), the high water mark only covers what runs after it.
+ * 
+ */
+void MEM_stackPaint( void )
+{
+    uint32_t *word, *top;
+
+    word    = ( uint32_t * )( ( ( uint32_t )memHeapEnd + 3 ) & ~3UL );
+    top     = ( uint32_t * )( ( __get_MSP( ) - MEM_PAINT_MARGIN ) & ~3UL );
+
+    memPaintBottom = word;
+    while( word < top )
+    {
+        *word++ = MEM_PAINT_PATTERN;
+    }
+}
+
+/**
+ * @brief _sbrk( ) Hook: the heap break moved
+ * 
+ * @param heapEnd New heap break
+ */
+void MEM_sbrkGrew( const uint8_t *heapEnd )
+{
+    memHeapEnd  = heapEnd;
+    memHeapPeak = ( heapEnd > memHeapPeak ) ? heapEnd : memHeapPeak;
+}
+
+/**
+ * @brief _sbrk( ) Hook: a request was refused ( ENOMEM )
+ * 
+ * @param incr Requested size
+ */
+void MEM_sbrkFailed( ptrdiff_t incr )
+{
+    memFailures++;
+    memFailLargest = ( ( uint32_t )incr > memFailLargest ) ? ( uint32_t )incr : memFailLargest;
+}
+
+/**
+ * @brief Current Memory Usage. Scans the painted stack, takes longer the more stack is free.
+ * 
+ * @param stats Memory Usage
+ */
+void MEM_getStats( MEM_stats_t *stats )
+{
+    uint32_t *lowWater = MEM_stackLowWater( );
+
+    stats->stackReserved    = ( uint32_t )&_Min_Stack_Size;
+    stats->stackUsedPeak    = ( uint32_t )&_estack - ( uint32_t )lowWater;
+    stats->heapUsed         = ( uint32_t )( memHeapEnd - &_end );
+    stats->heapPeak         = ( uint32_t )( memHeapPeak - &_end );
+    stats->heapLimit        = ( uint32_t )&_estack - ( uint32_t )&_Min_Stack_Size - ( uint32_t )&_end;
+    stats->sbrkFailures     = memFailures;
+    stats->sbrkFailLargest  = memFailLargest;
+    stats->gapMin           = ( ( uint32_t )lowWater > ( uint32_t )memHeapPeak ) ? ( ( uint32_t )lowWater - ( uint32_t )memHeapPeak ) : 0;
+}
+
+/**
+ * @brief Print the Memory Usage over the Serial Port
+ * 
+ */
+void MEM_dumpStats( void )
+{
+    MEM_stats_t stats;
+
+    MEM_getStats( &stats );
+
+    printf( "Memory: \r\n" );
+    printf( "  stack peak %lu of %lu reserved%s \r\n", ( unsigned long )stats.stackUsedPeak, ( unsigned long )stats.stackReserved, 
+            ( stats.stackUsedPeak > stats.stackReserved ) ? " ( OVER RESERVE )" : "" );
+    printf( "  heap  %lu, peak %lu of %lu, sbrk failures %lu ( largest %lu ) \r\n", ( unsigned long )stats.heapUsed, 
+            ( unsigned long )stats.heapPeak, ( unsigned long )stats.heapLimit, ( unsigned long )stats.sbrkFailures, 
+            ( unsigned long )stats.sbrkFailLargest );
+    printf( "  closest stack to heap gap %lu \r\n", ( unsigned long )stats.gapMin );
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Lowest stack word ever written: the first word above the heap peak that lost the paint pattern. 
+ * Without a paint the current stack pointer is returned.
+ * 
+ */
+static uint32_t *MEM_stackLowWater( void )
+{
+    uint32_t *word, *top;
+
+    top = ( uint32_t * )( __get_MSP( ) & ~3UL );
+    if( memPaintBottom == NULL )
+    {
+        return top;
+    }
+
+    /*The heap may have grown over the bottom of the paint*/
+    word = ( uint32_t * )( ( ( uint32_t )memHeapPeak + 3 ) & ~3UL );
+    word = ( word > memPaintBottom ) ? word : memPaintBottom;
+
+    while( ( word < top ) && ( *word == MEM_PAINT_PATTERN ) )
+    {
+        word++;
+    }
+
+    return word;
+}
\ No newline at end of file
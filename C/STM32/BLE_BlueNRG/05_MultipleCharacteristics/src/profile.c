@@ -0,0 +1,259 @@
+/*
+# ##############################################################################
+# File: profile.c                                                              #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 7:02:31 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 7:02:31 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "profile.h"
+#include <string.h>
+#ifdef PROF_HOST
+#include <time.h>
+#endif
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Vendor specific ( ACI ) Opcode Group, the OCF range selects the ACI layer*/
+#define PROF_OGF_VENDOR         0x3F
+#define PROF_OCF_GAP_FIRST      0x080
+#define PROF_OCF_GATT_FIRST     0x100
+#define PROF_OCF_L2CAP_FIRST    0x180
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#if PROF_ENABLED
+static PROF_zone_t profZones[ PROF_ZONE_COUNT ];
+
+static const char * const profZoneNames[ PROF_ZONE_COUNT ] =
+{
+    "hci_asynch_evt",
+    "hci_send_req",
+    "spi_receive",
+    "spi_send",
+    "user_evt_rx",
+    "aci_hal",
+    "aci_gap",
+    "aci_gatt",
+    "aci_l2cap",
+    "hci_cmd",
+};
+#endif
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Start the cycle counter and clear the zone table. Call before the first zone is entered.
+ * 
+ */
+void PROF_init( void )
+{
+#ifndef PROF_HOST
+    if( ( DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk ) == 0 )
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+#endif
+
+    PROF_reset( );
+}
+
+/**
+ * @brief Record one pass through a zone. Safe from Interrupt Context.
+ * 
+ * @param zone Zone id
+ * @param cycles Duration
+ */
+void PROF_record( uint8_t zone, uint32_t cycles )
+{
+#if PROF_ENABLED
+    PROF_zone_t *z;
+    uint8_t bucket;
+
+    if( zone >= PROF_ZONE_COUNT )
+    {
+        return;
+    }
+
+    bucket = ( cycles == 0 ) ? 0 : ( uint8_t )( 31 - __builtin_clz( cycles ) );
+    bucket = ( bucket >= PROF_HIST_BUCKETS ) ? ( PROF_HIST_BUCKETS - 1 ) : bucket;
+    z      = &profZones[ zone ];
+
+    PROF_CRITICAL_ENTER( );
+    if( ( z->count == 0 ) || ( cycles < z->min ) )
+    {
+        z->min = cycles;
+    }
+    z->max = ( cycles > z->max ) ? cycles : z->max;
+    z->count++;
+    z->total += cycles;
+    z->hist[ bucket ]++;
+    PROF_CRITICAL_EXIT( );
+#else
+    ( void )zone;
+    ( void )cycles;
+#endif
+}
+
+/**
+ * @brief ACI zone of a command: GAP / GATT / L2CAP / HAL by OCF range for the vendor group, PROF_ZONE_HCI_CMD otherwise
+ * 
+ * @param ogf Opcode Group Field
+ * @param ocf Opcode Command Field
+ * @return uint8_t Zone id
+ */
+uint8_t PROF_aciZone( uint16_t ogf, uint16_t ocf )
+{
+    if( ogf != PROF_OGF_VENDOR )
+    {
+        return PROF_ZONE_HCI_CMD;
+    }
+
+    if( ocf >= PROF_OCF_L2CAP_FIRST )
+    {
+        return PROF_ZONE_ACI_L2CAP;
+    }
+    else if( ocf >= PROF_OCF_GATT_FIRST )
+    {
+        return PROF_ZONE_ACI_GATT;
+    }
+    else if( ocf >= PROF_OCF_GAP_FIRST )
+    {
+        return PROF_ZONE_ACI_GAP;
+    }
+
+    return PROF_ZONE_ACI_HAL;
+}
+
+/**
+ * @brief Copy the statistics of a zone
+ * 
+ * @param zone Zone id
+ * @param stats Zone Statistics
+ * @return uint8_t TRUE if copied, FALSE if the zone is invalid or profiling is compiled out
+ */
+uint8_t PROF_getZone( uint8_t zone, PROF_zone_t *stats )
+{
+#if PROF_ENABLED
+    if( zone >= PROF_ZONE_COUNT )
+    {
+        return FALSE;
+    }
+
+    PROF_CRITICAL_ENTER( );
+    *stats = profZones[ zone ];
+    PROF_CRITICAL_EXIT( );
+
+    return TRUE;
+#else
+    ( void )zone;
+    ( void )stats;
+    return FALSE;
+#endif
+}
+
+/**
+ * @brief Clear every zone
+ * 
+ */
+void PROF_reset( void )
+{
+#if PROF_ENABLED
+    PROF_CRITICAL_ENTER( );
+    memset( profZones, 0, sizeof( profZones ) );
+    PROF_CRITICAL_EXIT( );
+#endif
+}
+
+/**
+ * @brief Print the zone table over the Serial Port ( USART2 ): count, min / mean / max in cycles and us, then the 
+ * non empty histogram buckets as "log2:count"
+ * 
+ */
+void PROF_dump( void )
+{
+#if PROF_ENABLED
+    PROF_zone_t stats;
+    uint32_t cyclesPerUs, mean;
+    uint8_t zone, bucket;
+
+    cyclesPerUs = PROF_CLOCK_HZ( ) / 1000000UL;
+    cyclesPerUs = ( cyclesPerUs == 0 ) ? 1 : cyclesPerUs;
+
+    printf( "Profile: %lu cycles/us \r\n", ( unsigned long )cyclesPerUs );
+    printf( "  zone            count      min cyc    mean cyc   max cyc    max us     histogram \r\n" );
+
+    for( zone = 0; zone < PROF_ZONE_COUNT; zone++ )
+    {
+        PROF_getZone( zone, &stats );
+        if( stats.count == 0 )
+        {
+            continue;
+        }
+
+        mean = ( uint32_t )( stats.total / stats.count );
+        printf( "  %-15s %-10lu %-10lu %-10lu %-10lu %-10lu", profZoneNames[ zone ], ( unsigned long )stats.count, 
+                ( unsigned long )stats.min, ( unsigned long )mean, ( unsigned long )stats.max, ( unsigned long )( stats.max / cyclesPerUs ) );
+
+        for( bucket = 0; bucket < PROF_HIST_BUCKETS; bucket++ )
+        {
+            if( stats.hist[ bucket ] != 0 )
+            {
+                printf( " %u:%lu", bucket, ( unsigned long )stats.hist[ bucket ] );
+            }
+        }
+        printf( " \r\n" );
+    }
+#endif
+}
+
+#ifdef PROF_HOST
+/**
+ * @brief Host Cycle Counter: CLOCK_MONOTONIC in nanoseconds, wraps like CYCCNT
+ * 
+ */
+uint32_t PROF_hostCycles( void )
+{
+    struct timespec now;
+
+    clock_gettime( CLOCK_MONOTONIC, &now );
+
+    return ( uint32_t )( ( uint64_t )now.tv_sec * 1000000000ULL + ( uint64_t )now.tv_nsec );
+}
+#endif
\ No newline at end of file
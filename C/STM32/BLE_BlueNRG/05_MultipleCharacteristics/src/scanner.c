@@ -0,0 +1,491 @@
+/*
+# ##############################################################################
+# File: scanner.c                                                              #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 10:06:12 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "scanner.h"
+#include "bluenrg1_gap.h"
+#include "bluenrg1_gap_aci.h"
+#include "hci_const.h"
+#include "hci_tl.h"
+#include "link_layer.h"
+#include <stdio.h>
+#include <string.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static uint32_t SCAN_hash( uint32_t hash, const uint8_t *data, uint8_t len );
+static uint8_t SCAN_allowed( uint8_t addrType, const uint8_t *addr );
+static SCAN_device_t *SCAN_lookup( const uint8_t *report, uint32_t dataHash, uint32_t now, uint8_t *isNew );
+static uint8_t SCAN_rateTake( uint32_t now );
+static uint8_t SCAN_accept( const uint8_t *report, uint32_t now );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*FNV-1a*/
+#define SCAN_FNV_OFFSET         2166136261UL
+#define SCAN_FNV_PRIME          16777619UL
+
+/*Advertising Report layout inside the LE Meta event: Event_Type, Address_Type, Address[ 6 ], Length_Data, Data[ ], RSSI*/
+#define SCAN_RPT_EVT_TYPE       0
+#define SCAN_RPT_ADDR_TYPE      1
+#define SCAN_RPT_ADDR           2
+#define SCAN_RPT_DATA_LEN       8
+#define SCAN_RPT_DATA           9
+#define SCAN_RPT_FIXED_LEN      10      /*Report bytes besides the data*/
+
+/*LE Meta event layout: packet type, event code, parameter length, subevent, Num_Reports, reports*/
+#define SCAN_EVT_PARAM_LEN      2
+#define SCAN_EVT_SUBEVENT       3
+#define SCAN_EVT_NUM_REPORTS    4
+#define SCAN_EVT_REPORTS        5
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Device Table and Counters, written by the HCI ISR ( SCAN_rxFilter( ) )*/
+static SCAN_device_t    scanTable[ SCAN_TABLE_SIZE ];
+static SCAN_stats_t     scanStats;
+
+/*Filters, changed from task context with interrupts masked*/
+static uint8_t          scanAllowList[ SCAN_ALLOW_LIST_SIZE ][ 7 ];        /*Address type, address*/
+static uint8_t          scanAllowCount  = 0;
+static int8_t           scanRssiMin     = SCAN_RSSI_MIN_DEFAULT;
+
+/*Token Bucket bounding the reports handed to the application*/
+static uint8_t          scanTokens      = SCAN_RATE_BURST;
+static uint32_t         scanRateStamp   = 0;
+
+static SCAN_reportCb_t  scanReportCb    = NULL;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Start the Observation Procedure ( passive, continuous ). Duplicates are left to the Device Table instead of the 
+ * controller, which would report each advertiser only once. The GAP must have been initialised with GAP_OBSERVER_ROLE.
+ * 
+ * @param reportCb Receives the reports left after filtering, NULL to only fill the Device Table
+ * @return tBleStatus aci_gap_start_observation_proc( ) status
+ */
+tBleStatus SCAN_start( SCAN_reportCb_t reportCb )
+{
+    tBleStatus ret;
+    uint32_t primask;
+    uint16_t index;
+
+    primask = __get_PRIMASK( );
+    __disable_irq( );
+
+    for( index = 0; index < SCAN_TABLE_SIZE; index++ )
+    {
+        scanTable[ index ].addrType = SCAN_ADDR_TYPE_EMPTY;
+    }
+    scanStats.devices   = 0;
+    scanTokens          = SCAN_RATE_BURST;
+    scanRateStamp       = HAL_GetTick( );
+    scanReportCb        = reportCb;
+
+    __set_PRIMASK( primask );
+
+    hci_register_rx_filter( SCAN_rxFilter );
+
+    ret = aci_gap_start_observation_proc( SCAN_INTERVAL, SCAN_WINDOW, PASSIVE_SCAN, PUBLIC_ADDR, 0x00, 0x00 );
+    if( ret != BLE_STATUS_SUCCESS )
+    {
+        hci_register_rx_filter( NULL );
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Stop the Observation Procedure, reports still queued are delivered
+ * 
+ * @return tBleStatus aci_gap_terminate_gap_proc( ) status
+ */
+tBleStatus SCAN_stop( void )
+{
+    tBleStatus ret;
+
+    ret = aci_gap_terminate_gap_proc( GAP_OBSERVATION_PROC );
+    hci_register_rx_filter( NULL );
+
+    return ret;
+}
+
+/**
+ * @brief Set the RSSI floor
+ * 
+ * @param rssiMin Weakest RSSI let through ( dBm )
+ */
+void SCAN_setRssiMin( int8_t rssiMin )
+{
+    scanRssiMin = rssiMin;
+}
+
+/**
+ * @brief Add an address to the Allow List. Once the list holds an address, only listed addresses get through.
+ * 
+ * @param addrType Address Type, as in the Advertising Report
+ * @param addr Address
+ * @return uint8_t TRUE if added, FALSE if the list is full
+ */
+uint8_t SCAN_allowAdd( uint8_t addrType, const uint8_t addr[ 6 ] )
+{
+    uint32_t primask;
+    uint8_t ret = FALSE;
+
+    primask = __get_PRIMASK( );
+    __disable_irq( );
+
+    if( scanAllowCount < SCAN_ALLOW_LIST_SIZE )
+    {
+        scanAllowList[ scanAllowCount ][ 0 ] = addrType;
+        memcpy( &scanAllowList[ scanAllowCount ][ 1 ], addr, 6 );
+        scanAllowCount++;
+        ret = TRUE;
+    }
+
+    __set_PRIMASK( primask );
+
+    return ret;
+}
+
+/**
+ * @brief Empty the Allow List, every address gets through again
+ * 
+ */
+void SCAN_allowClear( void )
+{
+    scanAllowCount = 0;
+}
+
+/**
+ * @brief HCI Receive Filter ( see hci_register_rx_filter( ) ), runs in the HCI ISR on every bulk event. Advertising 
+ * Reports failing the RSSI floor, the Allow List, the duplicate window or the rate bound are cut out of the event in place, 
+ * so they never take a queued packet nor reach the parser. Other events are left untouched.
+ * 
+ * @param pckt HCI Event packet, packet type first
+ * @param len Packet length
+ * @return uint16_t Packet length once the reports are removed, 0 if none is left
+ */
+uint16_t SCAN_rxFilter( uint8_t *pckt, uint16_t len )
+{
+    const uint8_t *end = pckt + len;
+    uint8_t *in, *out;
+    uint8_t index, numReports, kept = 0;
+    uint16_t reportLen;
+    uint32_t now;
+
+    if( ( len <= SCAN_EVT_REPORTS ) || ( pckt[ 1 ] != EVT_LE_META_EVENT ) || ( pckt[ SCAN_EVT_SUBEVENT ] != EVT_LE_ADVERTISING_REPORT ) )
+    {
+        return len;
+    }
+
+    now         = HAL_GetTick( );
+    numReports  = pckt[ SCAN_EVT_NUM_REPORTS ];
+    in          = pckt + SCAN_EVT_REPORTS;
+    out         = in;
+
+    for( index = 0; index < numReports; index++ )
+    {
+        if( in + SCAN_RPT_FIXED_LEN > end )
+        {
+            break;
+        }
+        reportLen = SCAN_RPT_FIXED_LEN + in[ SCAN_RPT_DATA_LEN ];
+        if( in + reportLen > end )
+        {
+            break;
+        }
+
+        if( SCAN_accept( in, now ) )
+        {
+            if( out != in )
+            {
+                memmove( out, in, reportLen );
+            }
+            out += reportLen;
+            kept++;
+        }
+        in += reportLen;
+    }
+
+    if( kept == 0 )
+    {
+        return 0;
+    }
+
+    pckt[ SCAN_EVT_NUM_REPORTS ]    = kept;
+    pckt[ SCAN_EVT_PARAM_LEN ]      = ( uint8_t )( out - pckt - SCAN_EVT_SUBEVENT );
+
+    return ( uint16_t )( out - pckt );
+}
+
+/**
+ * @brief Copy of the Scanner Counters
+ * 
+ * @param stats Scanner Counters
+ */
+void SCAN_getStats( SCAN_stats_t *stats )
+{
+    uint32_t primask;
+
+    primask = __get_PRIMASK( );
+    __disable_irq( );
+    *stats = scanStats;
+    __set_PRIMASK( primask );
+}
+
+/**
+ * @brief Print the Scanner Counters over the Serial Port
+ * 
+ */
+void SCAN_dumpStats( void )
+{
+    SCAN_stats_t stats;
+
+    SCAN_getStats( &stats );
+
+    printf( "Scanner: \r\n" );
+    printf( "  reports %lu, passed %lu, delivered %lu, coalesced %lu \r\n", ( unsigned long )stats.reports, 
+            ( unsigned long )stats.passed, ( unsigned long )stats.delivered, ( unsigned long )stats.coalesced );
+    printf( "  dropped: rssi %lu, allow list %lu, rate %lu \r\n", ( unsigned long )stats.droppedRssi, 
+            ( unsigned long )stats.droppedAllow, ( unsigned long )stats.droppedRate );
+    printf( "  devices %u of %u, evictions %lu \r\n", stats.devices, SCAN_TABLE_SIZE, ( unsigned long )stats.evictions );
+}
+
+/*Register Custom CallBacks---------------------------------------------------------------------------------*/
+
+void hci_le_advertising_report_event( uint8_t Num_Reports, Advertising_Report_t Advertising_Report[ ] )
+{
+    uint8_t index;
+
+    for( index = 0; index < Num_Reports; index++ )
+    {
+        scanStats.delivered++;
+        if( scanReportCb != NULL )
+        {
+            scanReportCb( &Advertising_Report[ index ] );
+        }
+    }
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief FNV-1a over len bytes, continuing from hash
+ * 
+ */
+static uint32_t SCAN_hash( uint32_t hash, const uint8_t *data, uint8_t len )
+{
+    while( len-- )
+    {
+        hash = ( hash ^ *data++ ) * SCAN_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief TRUE if the Allow List is empty or holds the address
+ * 
+ */
+static uint8_t SCAN_allowed( uint8_t addrType, const uint8_t *addr )
+{
+    uint8_t index;
+
+    if( scanAllowCount == 0 )
+    {
+        return TRUE;
+    }
+
+    for( index = 0; index < scanAllowCount; index++ )
+    {
+        if( ( scanAllowList[ index ][ 0 ] == addrType ) && ( memcmp( &scanAllowList[ index ][ 1 ], addr, 6 ) == 0 ) )
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Record of the report's address + data pair. Linear probing from the hash slot, at most SCAN_PROBE_MAX slots: 
+ * slots are never emptied one by one, so the first free slot ends the search. Without a match or a free slot, the 
+ * probed record reported longest ago is replaced.
+ * 
+ * @param report Advertising Report
+ * @param dataHash Hash of its data
+ * @param now HAL tick
+ * @param isNew Set TRUE if the record was created
+ * @return SCAN_device_t* The record
+ */
+static SCAN_device_t *SCAN_lookup( const uint8_t *report, uint32_t dataHash, uint32_t now, uint8_t *isNew )
+{
+    const uint8_t *addr = &report[ SCAN_RPT_ADDR ];
+    SCAN_device_t *slot, *victim = NULL;
+    uint32_t hash;
+    uint8_t probe;
+
+    hash = SCAN_hash( dataHash ^ report[ SCAN_RPT_ADDR_TYPE ], addr, 6 );
+    hash ^= hash >> 16;
+
+    for( probe = 0; probe < SCAN_PROBE_MAX; probe++ )
+    {
+        slot = &scanTable[ ( hash + probe ) & ( SCAN_TABLE_SIZE - 1 ) ];
+
+        if( slot->addrType == SCAN_ADDR_TYPE_EMPTY )
+        {
+            victim = slot;
+            break;
+        }
+
+        if( ( slot->dataHash == dataHash ) && ( slot->addrType == report[ SCAN_RPT_ADDR_TYPE ] ) && ( memcmp( slot->addr, addr, 6 ) == 0 ) )
+        {
+            *isNew = FALSE;
+            return slot;
+        }
+
+        if( ( victim == NULL ) || ( ( now - slot->lastReported ) > ( now - victim->lastReported ) ) )
+        {
+            victim = slot;
+        }
+    }
+
+    if( probe == SCAN_PROBE_MAX )
+    {
+        /*Every probed slot in use: the victim's record is given up*/
+        scanStats.evictions++;
+        scanStats.devices--;
+    }
+
+    scanStats.devices++;
+    memcpy( victim->addr, addr, 6 );
+    victim->addrType    = report[ SCAN_RPT_ADDR_TYPE ];
+    victim->dataHash    = dataHash;
+    victim->count       = 0;
+    *isNew              = TRUE;
+
+    return victim;
+}
+
+/**
+ * @brief Take a token from the rate bucket, refilled at SCAN_RATE_PER_S up to SCAN_RATE_BURST
+ * 
+ * @return uint8_t TRUE if a report may be handed over
+ */
+static uint8_t SCAN_rateTake( uint32_t now )
+{
+    uint32_t elapsed, refill;
+
+    elapsed = now - scanRateStamp;
+    if( elapsed >= ( SCAN_RATE_BURST * 1000UL ) / SCAN_RATE_PER_S )
+    {
+        scanTokens      = SCAN_RATE_BURST;
+        scanRateStamp   = now;
+    }
+    else
+    {
+        refill = ( elapsed * SCAN_RATE_PER_S ) / 1000UL;
+        if( refill > 0 )
+        {
+            scanTokens      = ( scanTokens + refill < SCAN_RATE_BURST ) ? ( uint8_t )( scanTokens + refill ) : SCAN_RATE_BURST;
+            scanRateStamp   += ( refill * 1000UL ) / SCAN_RATE_PER_S;
+        }
+    }
+
+    if( scanTokens == 0 )
+    {
+        return FALSE;
+    }
+
+    scanTokens--;
+    return TRUE;
+}
+
+/**
+ * @brief Run one report through the filters and the Device Table
+ * 
+ * @param report Advertising Report
+ * @param now HAL tick
+ * @return uint8_t TRUE if the report stays in the event
+ */
+static uint8_t SCAN_accept( const uint8_t *report, uint32_t now )
+{
+    SCAN_device_t *device;
+    uint8_t dataLen = report[ SCAN_RPT_DATA_LEN ];
+    int8_t rssi     = ( int8_t )report[ SCAN_RPT_DATA + dataLen ];
+    uint8_t isNew;
+
+    scanStats.reports++;
+
+    if( ( rssi != SCAN_RSSI_NOT_AVAILABLE ) && ( rssi < scanRssiMin ) )
+    {
+        scanStats.droppedRssi++;
+        return FALSE;
+    }
+
+    if( !SCAN_allowed( report[ SCAN_RPT_ADDR_TYPE ], &report[ SCAN_RPT_ADDR ] ) )
+    {
+        scanStats.droppedAllow++;
+        return FALSE;
+    }
+
+    device = SCAN_lookup( report, SCAN_hash( SCAN_FNV_OFFSET, &report[ SCAN_RPT_DATA ], dataLen ), now, &isNew );
+    device->rssi    = rssi;
+    device->evtType = report[ SCAN_RPT_EVT_TYPE ];
+    device->count   += ( device->count != UINT16_MAX );
+
+    if( !isNew && ( ( now - device->lastReported ) < SCAN_DEDUP_WINDOW_MS ) )
+    {
+        scanStats.coalesced++;
+        return FALSE;
+    }
+
+    if( !SCAN_rateTake( now ) )
+    {
+        /*Left expired, the next report of the pair gets through*/
+        device->lastReported = now - SCAN_DEDUP_WINDOW_MS;
+        scanStats.droppedRate++;
+        return FALSE;
+    }
+
+    device->lastReported = now;
+    scanStats.passed++;
+    return TRUE;
+}
\ No newline at end of file
@@ -0,0 +1,502 @@
+/*
+# ##############################################################################
+# File: scheduler.c                                                            #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 5:02:44 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 6:14:09 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "scheduler.h"
+#include <string.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static void SCHED_wheelInsert( SCHED_timer_t *timer );
+static void SCHED_wheelRemove( SCHED_timer_t *timer );
+static SCHED_timer_t *SCHED_unlinkExpired( SCHED_timer_t **link, SCHED_timer_t *expired, uint32_t now );
+static void SCHED_postExpired( SCHED_timer_t *expired, uint32_t now );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Task Control Block
+ * 
+ */
+typedef struct
+{
+    SCHED_taskFn_t      fn;
+    void                *arg;
+    SCHED_taskStats_t   stats;
+} SCHED_task_t;
+
+static SCHED_task_t         schedTasks[ SCHED_MAX_TASKS ];
+static volatile uint32_t    schedReady = 0;             /*Bit n set: task n is ready*/
+static volatile uint32_t    schedTick = 0;
+static SCHED_timer_t        *schedWheel[ SCHED_WHEEL_SLOTS ];
+static SCHED_idleHook_t     schedIdleHook = NULL;
+static uint32_t             schedIdleCount = 0;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Initialize the Scheduler: no task, no timer, nothing ready
+ * 
+ */
+void SCHED_init( void )
+{
+    SCHED_CRITICAL_ENTER( );
+    memset( schedTasks, 0, sizeof( schedTasks ) );
+    memset( schedWheel, 0, sizeof( schedWheel ) );
+    schedReady      = 0;
+    schedIdleHook   = NULL;
+    schedIdleCount  = 0;
+    SCHED_CRITICAL_EXIT( );
+
+#ifndef SCHED_HOST
+    /*Cycle Counter for the run-time accounting*/
+    if( ( DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk ) == 0 )
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+#endif
+}
+
+/**
+ * @brief Register a task. Tasks run to completion, a lower id runs first when several are ready.
+ * 
+ * @param task Task id and priority ( 0..SCHED_MAX_TASKS - 1, 0 = highest )
+ * @param fn Task Function
+ * @param arg Task Argument
+ * @param name Name shown in the stats dump
+ * @return uint8_t TRUE if registered, FALSE if the id is invalid or taken
+ */
+uint8_t SCHED_taskCreate( uint8_t task, SCHED_taskFn_t fn, void *arg, const char *name )
+{
+    if( ( task >= SCHED_MAX_TASKS ) || ( fn == NULL ) || ( schedTasks[ task ].fn != NULL ) )
+    {
+        return FALSE;
+    }
+
+    schedTasks[ task ].fn           = fn;
+    schedTasks[ task ].arg          = arg;
+    schedTasks[ task ].stats.name   = name;
+
+    return TRUE;
+}
+
+/**
+ * @brief Make a task ready. Safe from Interrupt Context ( EXTI, DMA, Timer CallBacks ). Posting a ready task again runs it once.
+ * 
+ * @param task Task id
+ */
+void SCHED_post( uint8_t task )
+{
+    if( task >= SCHED_MAX_TASKS )
+    {
+        return;
+    }
+
+    SCHED_CRITICAL_ENTER( );
+    schedReady |= ( 1UL << task );
+    schedTasks[ task ].stats.posts++;
+    SCHED_CRITICAL_EXIT( );
+}
+
+/**
+ * @brief Advance the Scheduler time by one tick and post the tasks of the expired timers. Called from SysTick_Handler( ).
+ * Only the wheel slot of the current tick is visited.
+ * 
+ */
+void SCHED_tick( void )
+{
+    SCHED_timer_t *expired;
+    uint32_t now;
+
+    SCHED_CRITICAL_ENTER( );
+    now     = ++schedTick;
+    expired = SCHED_unlinkExpired( &schedWheel[ now & SCHED_WHEEL_MASK ], NULL, now );
+    SCHED_postExpired( expired, now );
+    SCHED_CRITICAL_EXIT( );
+}
+
+/**
+ * @brief Advance the Scheduler time by several ticks at once, after the tick source was stopped ( low power idle ).
+ * Every slot is visited: a timer that expired in between is posted once, a periodic timer skips the periods it missed.
+ * 
+ * @param ticks Elapsed ticks
+ */
+void SCHED_tickAdvance( uint32_t ticks )
+{
+    SCHED_timer_t *expired = NULL;
+    uint32_t now;
+    uint8_t slot;
+
+    if( ticks == 0 )
+    {
+        return;
+    }
+
+    SCHED_CRITICAL_ENTER( );
+    schedTick += ticks;
+    now = schedTick;
+
+    for( slot = 0; slot < SCHED_WHEEL_SLOTS; slot++ )
+    {
+        expired = SCHED_unlinkExpired( &schedWheel[ slot ], expired, now );
+    }
+    SCHED_postExpired( expired, now );
+    SCHED_CRITICAL_EXIT( );
+}
+
+/**
+ * @brief Current Scheduler time
+ * 
+ * @return uint32_t Ticks since start ( SCHED_TICK_MS each )
+ */
+uint32_t SCHED_getTick( void )
+{
+    return schedTick;
+}
+
+/**
+ * @brief Start ( or restart ) a timer
+ * 
+ * @param timer Timer, must stay valid while running
+ * @param task Task posted on expiry
+ * @param delayTicks Ticks until the first expiry ( >= 1 )
+ * @param periodTicks Ticks between expiries, 0 for a one shot timer
+ */
+void SCHED_timerStart( SCHED_timer_t *timer, uint8_t task, uint32_t delayTicks, uint32_t periodTicks )
+{
+    if( task >= SCHED_MAX_TASKS )
+    {
+        return;
+    }
+
+    SCHED_CRITICAL_ENTER( );
+    if( timer->running )
+    {
+        SCHED_wheelRemove( timer );
+    }
+
+    timer->task     = task;
+    timer->period   = periodTicks;
+    timer->expiry   = schedTick + ( ( delayTicks == 0 ) ? 1 : delayTicks );
+    timer->running  = TRUE;
+    SCHED_wheelInsert( timer );
+    SCHED_CRITICAL_EXIT( );
+}
+
+/**
+ * @brief Stop a timer, no effect if not running
+ * 
+ * @param timer Timer
+ */
+void SCHED_timerStop( SCHED_timer_t *timer )
+{
+    SCHED_CRITICAL_ENTER( );
+    if( timer->running )
+    {
+        SCHED_wheelRemove( timer );
+        timer->running = FALSE;
+    }
+    SCHED_CRITICAL_EXIT( );
+}
+
+/**
+ * @brief Ticks until the earliest running timer expires, used to size the idle period
+ * 
+ * @return uint32_t Ticks, 0 if a timer is already due, SCHED_NO_TIMER if none is running
+ */
+uint32_t SCHED_ticksToNextTimer( void )
+{
+    uint32_t next = SCHED_NO_TIMER;
+    SCHED_timer_t *timer;
+    int32_t delta;
+    uint8_t slot;
+
+    SCHED_CRITICAL_ENTER( );
+    for( slot = 0; slot < SCHED_WHEEL_SLOTS; slot++ )
+    {
+        for( timer = schedWheel[ slot ]; timer != NULL; timer = timer->next )
+        {
+            delta = ( int32_t )( timer->expiry - schedTick );
+            delta = ( delta < 0 ) ? 0 : delta;
+            next  = ( ( uint32_t )delta < next ) ? ( uint32_t )delta : next;
+        }
+    }
+    SCHED_CRITICAL_EXIT( );
+
+    return next;
+}
+
+/**
+ * @brief Replace the default idle ( WFI ) with a hook, e.g. a low power idle manager. NULL restores WFI.
+ * 
+ * @param hook Idle Hook
+ */
+void SCHED_setIdleHook( SCHED_idleHook_t hook )
+{
+    schedIdleHook = hook;
+}
+
+/**
+ * @brief Run the highest priority ready task to completion
+ * 
+ * @return uint8_t TRUE if a task was run, FALSE if none was ready
+ */
+uint8_t SCHED_runOnce( void )
+{
+    SCHED_task_t *tcb;
+    uint32_t start, cycles;
+    uint8_t task;
+
+    SCHED_CRITICAL_ENTER( );
+    if( schedReady == 0 )
+    {
+        task = SCHED_MAX_TASKS;
+    }
+    else
+    {
+        task = ( uint8_t )__builtin_ctz( schedReady );
+        schedReady &= ~( 1UL << task );
+    }
+    SCHED_CRITICAL_EXIT( );
+
+    if( task == SCHED_MAX_TASKS )
+    {
+        return FALSE;
+    }
+
+    tcb = &schedTasks[ task ];
+    if( tcb->fn == NULL )
+    {
+        return TRUE;
+    }
+
+    start = SCHED_CYCLES( );
+    tcb->fn( tcb->arg );
+    cycles = SCHED_CYCLES( ) - start;
+
+    tcb->stats.runs++;
+    tcb->stats.cyclesTotal += cycles;
+    tcb->stats.cyclesMax = ( cycles > tcb->stats.cyclesMax ) ? cycles : tcb->stats.cyclesMax;
+
+    return TRUE;
+}
+
+/**
+ * @brief Scheduler Loop, never returns. Runs ready tasks, idles the CPU when none is ready. 
+ * The ready check and the idle entry happen with interrupts disabled so that a post from an interrupt is never missed.
+ * 
+ */
+void SCHED_run( void )
+{
+    while( 1 )
+    {
+        if( SCHED_runOnce( ) )
+        {
+            continue;
+        }
+
+        SCHED_CRITICAL_ENTER( );
+        if( schedReady == 0 )
+        {
+            schedIdleCount++;
+
+            if( schedIdleHook != NULL )
+            {
+                schedIdleHook( SCHED_ticksToNextTimer( ) );
+            }
+            else
+            {
+                SCHED_IDLE( );
+            }
+        }
+        SCHED_CRITICAL_EXIT( );
+    }
+}
+
+/**
+ * @brief Copy the run-time accounting of a task
+ * 
+ * @param task Task id
+ * @param stats Task Stats
+ * @return uint8_t TRUE if the task exists, FALSE otherwise
+ */
+uint8_t SCHED_getTaskStats( uint8_t task, SCHED_taskStats_t *stats )
+{
+    if( ( task >= SCHED_MAX_TASKS ) || ( schedTasks[ task ].fn == NULL ) )
+    {
+        return FALSE;
+    }
+
+    SCHED_CRITICAL_ENTER( );
+    *stats = schedTasks[ task ].stats;
+    SCHED_CRITICAL_EXIT( );
+
+    return TRUE;
+}
+
+/**
+ * @brief Number of times the Scheduler went idle
+ * 
+ */
+uint32_t SCHED_getIdleCount( void )
+{
+    return schedIdleCount;
+}
+
+/**
+ * @brief Print the run-time accounting of every task over the Serial Port
+ * 
+ */
+void SCHED_dumpStats( void )
+{
+    SCHED_taskStats_t stats;
+    uint32_t mean;
+    uint8_t task;
+
+    printf( "Scheduler: tick %lu, idle %lu \r\n", ( unsigned long )schedTick, ( unsigned long )schedIdleCount );
+    printf( "  id name         posts      runs       mean cyc   max cyc \r\n" );
+
+    for( task = 0; task < SCHED_MAX_TASKS; task++ )
+    {
+        if( SCHED_getTaskStats( task, &stats ) == FALSE )
+        {
+            continue;
+        }
+
+        mean = ( stats.runs != 0 ) ? ( uint32_t )( stats.cyclesTotal / stats.runs ) : 0;
+        printf( "  %2u %-12s %-10lu %-10lu %-10lu %-10lu \r\n", task, ( stats.name != NULL ) ? stats.name : "-", 
+                ( unsigned long )stats.posts, ( unsigned long )stats.runs, ( unsigned long )mean, ( unsigned long )stats.cyclesMax );
+    }
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Move the expired timers of a wheel slot to the expired list, timers due in a later round stay ( interrupts disabled )
+ * 
+ * @return SCHED_timer_t* New head of the expired list
+ */
+static SCHED_timer_t *SCHED_unlinkExpired( SCHED_timer_t **link, SCHED_timer_t *expired, uint32_t now )
+{
+    SCHED_timer_t *timer;
+
+    while( *link != NULL )
+    {
+        timer = *link;
+        if( ( int32_t )( now - timer->expiry ) >= 0 )
+        {
+            *link       = timer->next;
+            timer->next = expired;
+            expired     = timer;
+        }
+        else
+        {
+            link = &timer->next;
+        }
+    }
+
+    return expired;
+}
+
+/**
+ * @brief Post the tasks of the expired timers and re-arm the periodic ones past now ( interrupts disabled )
+ * 
+ */
+static void SCHED_postExpired( SCHED_timer_t *expired, uint32_t now )
+{
+    SCHED_timer_t *timer;
+
+    while( expired != NULL )
+    {
+        timer   = expired;
+        expired = timer->next;
+
+        schedReady |= ( 1UL << timer->task );
+        schedTasks[ timer->task ].stats.posts++;
+
+        if( timer->period != 0 )
+        {
+            do
+            {
+                timer->expiry += timer->period;
+            } while( ( int32_t )( now - timer->expiry ) >= 0 );
+            SCHED_wheelInsert( timer );
+        }
+        else
+        {
+            timer->running = FALSE;
+        }
+    }
+}
+
+/**
+ * @brief Link a timer into the wheel slot of its expiry ( interrupts disabled )
+ * 
+ */
+static void SCHED_wheelInsert( SCHED_timer_t *timer )
+{
+    SCHED_timer_t **slot = &schedWheel[ timer->expiry & SCHED_WHEEL_MASK ];
+
+    timer->next = *slot;
+    *slot       = timer;
+}
+
+/**
+ * @brief Unlink a timer from its wheel slot ( interrupts disabled )
+ * 
+ */
+static void SCHED_wheelRemove( SCHED_timer_t *timer )
+{
+    SCHED_timer_t **link = &schedWheel[ timer->expiry & SCHED_WHEEL_MASK ];
+
+    while( *link != NULL )
+    {
+        if( *link == timer )
+        {
+            *link = timer->next;
+            break;
+        }
+        link = &( *link )->next;
+    }
+}
\ No newline at end of file
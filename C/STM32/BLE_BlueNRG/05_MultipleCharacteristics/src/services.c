@@ -5,7 +5,7 @@
 # Created Date: Tuesday, October 24th 2023, 9:41:38 pm                         #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Saturday, October 28th 2023, 2:18:58 pm                       #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -21,6 +21,8 @@
 #include "bluenrg1_gatt_aci.h"
 #include "services.h"
 #include "main.h"
+#include "profile.h"
+#include "adv_payload.h"
 
 /*##############################################################################################################################################*/
 /*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
@@ -299,6 +301,7 @@ void GAP_customConnectionCompleteCB( uint16_t handle )
 {
     FLAG_CONNECTED = TRUE;
     usrConnectionHdl = handle;
+    ADV_stopped( );
     printf( " Connection Complete ... \r\n " );
     HAL_GPIO_WritePin( LED2_GPIO_Port, LED2_Pin, GPIO_PIN_SET );
 }
@@ -405,7 +408,7 @@ void hci_le_connection_complete_event
     GAP_customConnectionCompleteCB( Connection_Handle );
 }
 
-void hci_le_disconnection_complete_event
+void hci_disconnection_complete_event
 										(uint8_t Status,
 										 uint16_t Connection_Handle,
 										 uint8_t Reason
@@ -414,11 +417,15 @@ void hci_le_disconnection_complete_event
     GAP_customDisconnectionCompleteCB( );
 }
 
-void aci_gatt_read_permit_req_event(uint16_t Connection_Handle,
-                                    uint16_t Attribute_Handle,
-                                    uint16_t Offset)
+/*Read Permit Request, read in place from the received packet ( see hci_evt_view.h )*/
+void GATT_readPermitReqView( const hci_evt_view_t *view )
 {
-    GATT_readRqstCB( Attribute_Handle );
+    const aci_gatt_read_permit_req_event_rp0 *readRqst = aci_gatt_read_permit_req_view( view );
+
+    if( readRqst != NULL )
+    {
+        GATT_readRqstCB( readRqst->Attribute_Handle );
+    }
 }
 
 /*User Event Receive Function Implementation*/
@@ -428,6 +435,8 @@ void APP_userEvtRx( void * pData )
 
     hci_spi_pckt *hciPckt = ( hci_spi_pckt * )pData;
 
+    PROF_ENTER( PROF_ZONE_USER_EVT_RX );
+
     /*Process Event Packet*/
     if( hciPckt->type == HCI_EVENT_PKT )
     {
@@ -443,6 +452,7 @@ void APP_userEvtRx( void * pData )
             evt_le_meta_event *metaDataEvt = ( void * )eventPckt->data;
 
             /*Loop through all the possible Meta events and process the specific event which occured*/
+#if HCI_LE_META_EVENTS_TABLE_SIZE > 0
             for( i = 0; i < HCI_LE_META_EVENTS_COUNT; i++ )
             {
                 if( metaDataEvt->subevent == hci_le_meta_events_table[ i ].evt_code )
@@ -450,6 +460,7 @@ void APP_userEvtRx( void * pData )
                     hci_le_meta_events_table[ i ].process( ( void * )metaDataEvt->data );
                 }
             }
+#endif
             
         } 
         else if( eventPckt->evt == EVT_VENDOR )
@@ -458,15 +469,38 @@ void APP_userEvtRx( void * pData )
             /*Process Vendor Event*/
             /*Get Vendor ( BlueNRG ) Data*/
             evt_blue_aci *blueNRGEvt = ( void * )eventPckt->data;
+            uint8_t viewed = FALSE;
+
+#if HCI_VENDOR_SPECIFIC_VIEWS_TABLE_SIZE > 0
+            hci_evt_view_t view;
+
+            /*Events with a View Handler are handed over in place, without being unpacked*/
+            for( i = 0; ( i < HCI_VENDOR_SPECIFIC_VIEWS_COUNT ) && !viewed; i++ )
+            {
+                if( blueNRGEvt->ecode == hci_vendor_specific_views_table[ i ].evt_code )
+                {
+                    view.data   = blueNRGEvt->data;
+                    view.len    = ( eventPckt->plen >= sizeof( blueNRGEvt->ecode ) ) ? eventPckt->plen - sizeof( blueNRGEvt->ecode ) : 0;
+                    hci_vendor_specific_views_table[ i ].handler( &view );
+                    viewed      = TRUE;
+                }
+            }
+#endif
 
-            /*Loop through all the possible Vendor Events and and process the specific event which occured*/
-            for( i = 0; i < HCI_VENDOR_SPECIFIC_EVENTS_COUNT; i++ )
+#if HCI_VENDOR_SPECIFIC_EVENTS_TABLE_SIZE > 0
+            /*No View Handler: loop through all the possible Vendor Events and process the specific event which occured. 
+              Compiled out while BLE_CONF_VS_EVENTS is empty*/
+            if( !viewed )
             {
-                if( blueNRGEvt->ecode == hci_vendor_specific_events_table[ i ].evt_code )
+                for( i = 0; i < HCI_VENDOR_SPECIFIC_EVENTS_COUNT; i++ )
                 {
-                    hci_vendor_specific_events_table[ i ].process( ( void * )blueNRGEvt->data );
+                    if( blueNRGEvt->ecode == hci_vendor_specific_events_table[ i ].evt_code )
+                    {
+                        hci_vendor_specific_events_table[ i ].process( ( void * )blueNRGEvt->data );
+                    }
                 }
             }
+#endif
             
         } 
         else
@@ -474,6 +508,7 @@ void APP_userEvtRx( void * pData )
 
             /*Process Normal Event*/
             /*Loop through all normal events and process the event which occured*/
+#if HCI_EVENTS_TABLE_SIZE > 0
             for( i = 0; i < HCI_EVENTS_COUNT; i++ )
             {
                 if( eventPckt->evt == hci_events_table[ i ].evt_code )
@@ -481,10 +516,12 @@ void APP_userEvtRx( void * pData )
                     hci_events_table[ i ].process( ( void * )eventPckt->data );
                 }
             }
+#endif
             
         }
     }
     
     /*Process other events*/
-    
+
+    PROF_EXIT( PROF_ZONE_USER_EVT_RX );
 }
\ No newline at end of file
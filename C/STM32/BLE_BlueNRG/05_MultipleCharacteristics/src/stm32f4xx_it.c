@@ -5,7 +5,7 @@
 # Created Date: Sunday, October 22nd 2023, 3:11:07 pm                          #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Sunday, October 22nd 2023, 4:56:23 pm                         #
+# Last Modified: Sunday, October 18th 2026, 6:14:09 pm                         #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -37,6 +37,9 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "scheduler.h"
+#include "app_bluenrg.h"
+#include "lowpower.h"
 
 extern EXTI_HandleTypeDef     hexti0;
 /* USER CODE END Includes */
@@ -204,6 +207,7 @@ void SysTick_Handler(void)
   /* USER CODE END SysTick_IRQn 0 */
   HAL_IncTick();
   /* USER CODE BEGIN SysTick_IRQn 1 */
+  SCHED_tick( );
 
   /* USER CODE END SysTick_IRQn 1 */
 }
@@ -225,6 +229,8 @@ void EXTI0_IRQHandler(void)
   /* USER CODE END EXTI0_IRQn 0 */
   HAL_EXTI_IRQHandler(&hexti0);
   /* USER CODE BEGIN EXTI0_IRQn 1 */
+  /*BlueNRG packets were queued by hci_tl_lowlevel_isr( ), let the BLE Task process them*/
+  SCHED_post( APP_TASK_BLE );
 
   /* USER CODE END EXTI0_IRQn 1 */
 }
@@ -244,5 +250,13 @@ void EXTI15_10_IRQHandler(void)
 }
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief This function handles RTC wake-up interrupt through EXTI line 22.
+  *        LPWR_stop( ) normally clears it before it is taken, it only has to end the WFI.
+  */
+void RTC_WKUP_IRQHandler(void)
+{
+  HAL_RTCEx_WakeUpTimerIRQHandler(&hrtc);
+}
 
 /* USER CODE END 1 */
@@ -23,6 +23,7 @@
 /* Includes */
 #include <errno.h>
 #include <stdint.h>
+#include "memmon.h"
 
 /**
  * Pointer to the current high watermark of the heap usage
@@ -69,11 +70,13 @@ void *_sbrk(ptrdiff_t incr)
   if (__sbrk_heap_end + incr > max_heap)
   {
     errno = ENOMEM;
+    MEM_sbrkFailed(incr);
     return (void *)-1;
   }
 
   prev_heap_end = __sbrk_heap_end;
   __sbrk_heap_end += incr;
+  MEM_sbrkGrew(__sbrk_heap_end);
 
   return (void *)prev_heap_end;
 }
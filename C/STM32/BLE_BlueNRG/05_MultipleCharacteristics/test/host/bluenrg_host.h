@@ -0,0 +1,215 @@
+/*
+# ##############################################################################
+# File: bluenrg_host.h                                                         #
+# Project: test                                                                #
+# Created Date: Sunday, October 18th 2026, 11:59:02 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef TEST_HOST_BLUENRG_HOST_H
+#define TEST_HOST_BLUENRG_HOST_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Fake BlueNRG for the native tests. It stands in for hci_tl_interface.c: the test includes hci_tl.c and the 
+  units it needs, then this header to register the bus. Every command sent is captured, and by default 
+  answered with a Command Complete carrying HOST_completeStatus and HOST_completeParams, delivered the way 
+  the EXTI line would*/
+
+#include <string.h>
+#include "hci_const.h"
+#include "hci_tl.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Last command written by the transport, and where it was written from*/
+static uint8_t        HOST_tx[ 1 + 3 + 255 ];
+static uint16_t       HOST_txLen;
+static const uint8_t *HOST_txBuf;
+static uint32_t       HOST_sends;
+static uintptr_t      HOST_sendStack;   /*Address of a local in HOST_send( ), for stack depth*/
+
+/*Packet the BlueNRG has pending, read once*/
+static uint8_t        HOST_rx[ 1 + 2 + 255 ];
+static uint16_t       HOST_rxLen;
+
+static uint8_t        HOST_autoComplete = 1;
+static uint8_t        HOST_completeStatus;
+static uint8_t        HOST_completeParams[ 32 ];    /*Return parameters after the status*/
+static uint8_t        HOST_completeLen;
+static uint32_t       HOST_resumes;
+static uint8_t        HOST_autoResume;              /*A resume reads the pending packet, as the software EXTI would*/
+
+/*Called by HOST_send( ) before the Command Complete is raised, to have events arrive while the command waits*/
+static void         ( *HOST_beforeComplete )( void );
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Announce the length of the pending packet
+ */
+static int32_t HOST_receiveLen( void )
+{
+    return HOST_rxLen;
+}
+
+/**
+ * @brief Hand over the pending packet, a zero length read leaves it pending
+ */
+static int32_t HOST_receiveData( uint8_t *buffer, uint16_t size )
+{
+    uint16_t len = ( HOST_rxLen < size ) ? HOST_rxLen : size;
+
+    if( size == 0 )
+    {
+        return 0;
+    }
+
+    memcpy( buffer, HOST_rx, len );
+    HOST_rxLen = 0;
+
+    return len;
+}
+
+/**
+ * @brief Raise a packet on the simulated EXTI line
+ * 
+ * @param type HCI packet type, HCI_EVENT_PKT for events
+ * @param data Packet after the type byte
+ * @param len Length of data
+ * @return int32_t hci_notify_asynch_evt( ) result, 1 if the packet was left pending
+ */
+static int32_t HOST_packet( uint8_t type, const uint8_t *data, uint16_t len )
+{
+    HOST_rx[ 0 ] = type;
+    memcpy( &HOST_rx[ 1 ], data, len );
+    HOST_rxLen = len + 1;
+
+    return hci_notify_asynch_evt( NULL );
+}
+
+/**
+ * @brief Raise an HCI event with the given code and parameters
+ */
+static int32_t HOST_event( uint8_t evt, const uint8_t *params, uint8_t plen )
+{
+    uint8_t pkt[ 2 + 255 ];
+
+    pkt[ 0 ] = evt;
+    pkt[ 1 ] = plen;
+    memcpy( &pkt[ 2 ], params, plen );
+
+    return HOST_packet( HCI_EVENT_PKT, pkt, plen + 2 );
+}
+
+/**
+ * @brief Capture a command and answer it
+ */
+static int32_t HOST_send( uint8_t *buffer, uint16_t size )
+{
+    uint8_t cc[ 4 + sizeof( HOST_completeParams ) ];
+
+    memcpy( HOST_tx, buffer, size );
+    HOST_txLen = size;
+    HOST_txBuf = buffer;
+    HOST_sends++;
+    HOST_sendStack = ( uintptr_t )cc;
+
+    if( HOST_autoComplete && ( buffer[ 0 ] == HCI_COMMAND_PKT ) )
+    {
+        cc[ 0 ] = 1;
+        cc[ 1 ] = buffer[ 1 ];
+        cc[ 2 ] = buffer[ 2 ];
+        cc[ 3 ] = HOST_completeStatus;
+        memcpy( &cc[ 4 ], HOST_completeParams, HOST_completeLen );
+        if( HOST_beforeComplete != NULL )
+        {
+            HOST_beforeComplete( );
+        }
+        HOST_event( EVT_CMD_COMPLETE, cc, 4 + HOST_completeLen );
+    }
+
+    return size;
+}
+
+/**
+ * @brief Called by hci_init( ), registers the fake bus
+ */
+void hci_tl_lowlevel_init( void )
+{
+    tHciIO fops;
+
+    memset( &fops, 0, sizeof( fops ) );
+    fops.Send        = HOST_send;
+    fops.ReceiveLen  = HOST_receiveLen;
+    fops.ReceiveData = HOST_receiveData;
+    hci_register_io_bus( &fops );
+}
+
+/**
+ * @brief Called when the transport lifts back-pressure
+ */
+void hci_tl_lowlevel_resume( void )
+{
+    HOST_resumes++;
+    if( HOST_autoResume && ( HOST_rxLen != 0 ) )
+    {
+        hci_notify_asynch_evt( NULL );
+    }
+}
+
+/**
+ * @brief Forget everything captured and restore the defaults
+ */
+static void HOST_reset( void )
+{
+    HOST_txLen          = 0;
+    HOST_txBuf          = NULL;
+    HOST_sends          = 0;
+    HOST_rxLen          = 0;
+    HOST_autoComplete   = 1;
+    HOST_completeStatus = 0;
+    HOST_completeLen    = 0;
+    HOST_resumes        = 0;
+    HOST_beforeComplete = NULL;
+    HOST_autoResume     = 0;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,102 @@
+/*
+# ##############################################################################
+# File: stm32f4xx_hal.h                                                        #
+# Project: test                                                                #
+# Created Date: Sunday, October 18th 2026, 11:58:40 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:58:40 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef TEST_HOST_STM32F4XX_HAL_H
+#define TEST_HOST_STM32F4XX_HAL_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*HAL stand-in for the native tests: only what the BlueNRG transport and the ACI layer use. Found first through 
+  -I test/host in [env:native], the target build never sees it*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#define DWT                 ( &hostDwt )
+#define SystemCoreClock     100000000UL
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+typedef enum
+{
+    HAL_OK = 0,
+    HAL_ERROR,
+    HAL_BUSY,
+    HAL_TIMEOUT
+} HAL_StatusTypeDef;
+
+typedef struct { int unused; } SPI_HandleTypeDef;
+typedef struct { int unused; } EXTI_HandleTypeDef;
+typedef struct { volatile uint32_t CTRL, CYCCNT; } DWT_Type;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Simulated core: the cycle counter only moves when a test moves it, the tick advances on every read so that 
+  a command nobody answers times out instead of hanging*/
+static DWT_Type hostDwt;
+static uint32_t hostTick;
+
+static inline uint32_t HAL_GetTick( void )
+{
+    return hostTick++;
+}
+
+static inline uint32_t __get_PRIMASK( void )
+{
+    return 0;
+}
+
+static inline void __set_PRIMASK( uint32_t primask )
+{
+    ( void )primask;
+}
+
+static inline void __disable_irq( void )
+{
+}
+
+static inline void __enable_irq( void )
+{
+}
+
+#endif
\ No newline at end of file
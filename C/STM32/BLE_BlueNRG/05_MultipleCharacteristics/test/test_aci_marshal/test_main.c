@@ -0,0 +1,361 @@
+/*
+# ##############################################################################
+# File: test_main.c                                                            #
+# Project: test                                                                #
+# Created Date: Sunday, October 18th 2026, 11:59:48 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ble_list.c"
+#include "hci_tl.c"
+#include "hci_stats.c"
+#include "profile.c"
+
+/*Generated wrappers first, with ACI_MARSHAL_TABLE=0 and the table driven commands renamed GEN_<name>, then the 
+  descriptor engine under the real names: both versions live in one binary and go through the same transport*/
+#define ACI_MARSHAL_TABLE               0
+#define hci_reset                       GEN_hci_reset
+#define aci_hal_write_config_data       GEN_aci_hal_write_config_data
+#define aci_gap_set_non_discoverable    GEN_aci_gap_set_non_discoverable
+#define aci_gap_set_discoverable        GEN_aci_gap_set_discoverable
+#define aci_gap_init                    GEN_aci_gap_init
+#define aci_gatt_init                   GEN_aci_gatt_init
+#define aci_gatt_add_service            GEN_aci_gatt_add_service
+#define aci_gatt_add_char               GEN_aci_gatt_add_char
+#define aci_gatt_update_char_value      GEN_aci_gatt_update_char_value
+#define aci_gatt_allow_read             GEN_aci_gatt_allow_read
+
+#include "bluenrg1_hci_le.c"
+#include "bluenrg1_hal_aci.c"
+#include "bluenrg1_gap_aci.c"
+#include "bluenrg1_gatt_aci.c"
+
+#undef hci_reset
+#undef aci_hal_write_config_data
+#undef aci_gap_set_non_discoverable
+#undef aci_gap_set_discoverable
+#undef aci_gap_init
+#undef aci_gatt_init
+#undef aci_gatt_add_service
+#undef aci_gatt_add_char
+#undef aci_gatt_update_char_value
+#undef aci_gatt_allow_read
+#undef ACI_MARSHAL_TABLE
+#define ACI_MARSHAL_TABLE               1
+
+#include "aci_marshal.c"
+#include "bluenrg_host.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static void TEST_keepPacket( void );
+static void TEST_assertSamePacket( void );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Packet sent by the generated version, compared against the table driven one*/
+static uint8_t  genTx[ sizeof( HOST_tx ) ];
+static uint16_t genLen;
+
+static uint8_t      bdAddr[ 6 ]     = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+static uint8_t      localName[ ]    = { 0x09, 'J', 'o', 'y', 's', 't', 'i', 'c', 'k' };
+static uint8_t      uuidList[ ]     = { 0x02, 0x0F, 0x18 };
+static uint8_t      charValue[ 20 ] = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19 };
+static Service_UUID_t serviceUuid;
+static Char_UUID_t    charUuid;
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Commands timed by the benchmark, per version and per command of the mix*/
+#define TEST_BENCH_ROUNDS   10000
+
+/*UUID types*/
+#define TEST_UUID_16        1
+#define TEST_UUID_128       2
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+void setUp( void )
+{
+    uint8_t i;
+
+    HOST_reset( );
+    hci_init( NULL, NULL );
+
+    for( i = 0; i < 16; i++ )
+    {
+        serviceUuid.Service_UUID_128[ i ] = i;
+        charUuid.Char_UUID_128[ i ]       = 0x80 + i;
+    }
+}
+
+void tearDown( void )
+{
+}
+
+static void TEST_keepPacket( void )
+{
+    memcpy( genTx, HOST_tx, HOST_txLen );
+    genLen = HOST_txLen;
+}
+
+static void TEST_assertSamePacket( void )
+{
+    TEST_ASSERT_EQUAL_UINT16( genLen, HOST_txLen );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( genTx, HOST_tx, genLen );
+}
+
+/*******************************************************************************************************/
+/*Encoding: every table driven command sends the same bytes as its generated version*/
+void test_noParamCommandsMatch( void )
+{
+    TEST_ASSERT_EQUAL_UINT8( BLE_STATUS_SUCCESS, GEN_hci_reset( ) );
+    TEST_keepPacket( );
+    TEST_ASSERT_EQUAL_UINT8( BLE_STATUS_SUCCESS, hci_reset( ) );
+    TEST_assertSamePacket( );
+
+    GEN_aci_gatt_init( );
+    TEST_keepPacket( );
+    aci_gatt_init( );
+    TEST_assertSamePacket( );
+
+    GEN_aci_gap_set_non_discoverable( );
+    TEST_keepPacket( );
+    aci_gap_set_non_discoverable( );
+    TEST_assertSamePacket( );
+}
+
+void test_writeConfigDataMatches( void )
+{
+    GEN_aci_hal_write_config_data( 0x00, sizeof( bdAddr ), bdAddr );
+    TEST_keepPacket( );
+    aci_hal_write_config_data( 0x00, sizeof( bdAddr ), bdAddr );
+    TEST_assertSamePacket( );
+}
+
+void test_setDiscoverableMatches( void )
+{
+    GEN_aci_gap_set_discoverable( 0x00, 0x0020, 0x0040, 0x00, 0x00, sizeof( localName ), localName, 
+                                  sizeof( uuidList ), uuidList, 0x0006, 0x0010 );
+    TEST_keepPacket( );
+    aci_gap_set_discoverable( 0x00, 0x0020, 0x0040, 0x00, 0x00, sizeof( localName ), localName, 
+                              sizeof( uuidList ), uuidList, 0x0006, 0x0010 );
+    TEST_assertSamePacket( );
+
+    /*Empty name and service list*/
+    GEN_aci_gap_set_discoverable( 0x00, 0x0020, 0x0040, 0x00, 0x00, 0, NULL, 0, NULL, 0x0000, 0x0000 );
+    TEST_keepPacket( );
+    aci_gap_set_discoverable( 0x00, 0x0020, 0x0040, 0x00, 0x00, 0, NULL, 0, NULL, 0x0000, 0x0000 );
+    TEST_assertSamePacket( );
+}
+
+void test_addServiceMatches( void )
+{
+    uint16_t genHandle, handle;
+
+    HOST_completeParams[ 0 ] = 0x0C;
+    HOST_completeParams[ 1 ] = 0x00;
+    HOST_completeLen = 2;
+
+    GEN_aci_gatt_add_service( TEST_UUID_16, &serviceUuid, PRIMARY_SERVICE, 9, &genHandle );
+    TEST_keepPacket( );
+    aci_gatt_add_service( TEST_UUID_16, &serviceUuid, PRIMARY_SERVICE, 9, &handle );
+    TEST_assertSamePacket( );
+    TEST_ASSERT_EQUAL_HEX16( genHandle, handle );
+
+    GEN_aci_gatt_add_service( TEST_UUID_128, &serviceUuid, PRIMARY_SERVICE, 9, &genHandle );
+    TEST_keepPacket( );
+    aci_gatt_add_service( TEST_UUID_128, &serviceUuid, PRIMARY_SERVICE, 9, &handle );
+    TEST_assertSamePacket( );
+    TEST_ASSERT_EQUAL_HEX16( 0x000C, handle );
+    TEST_ASSERT_EQUAL_HEX16( genHandle, handle );
+}
+
+void test_addCharMatches( void )
+{
+    uint16_t genHandle, handle;
+
+    HOST_completeParams[ 0 ] = 0x0E;
+    HOST_completeParams[ 1 ] = 0x01;
+    HOST_completeLen = 2;
+
+    GEN_aci_gatt_add_char( 0x000C, TEST_UUID_128, &charUuid, 20, CHAR_PROP_READ | CHAR_PROP_NOTIFY, 
+                           ATTR_PERMISSION_NONE, GATT_DONT_NOTIFY_EVENTS, 16, 1, &genHandle );
+    TEST_keepPacket( );
+    aci_gatt_add_char( 0x000C, TEST_UUID_128, &charUuid, 20, CHAR_PROP_READ | CHAR_PROP_NOTIFY, 
+                       ATTR_PERMISSION_NONE, GATT_DONT_NOTIFY_EVENTS, 16, 1, &handle );
+    TEST_assertSamePacket( );
+    TEST_ASSERT_EQUAL_HEX16( 0x010E, handle );
+    TEST_ASSERT_EQUAL_HEX16( genHandle, handle );
+
+    GEN_aci_gatt_add_char( 0x000C, TEST_UUID_16, &charUuid, 2, CHAR_PROP_WRITE, ATTR_PERMISSION_NONE, 
+                           GATT_NOTIFY_ATTRIBUTE_WRITE, 16, 0, &genHandle );
+    TEST_keepPacket( );
+    aci_gatt_add_char( 0x000C, TEST_UUID_16, &charUuid, 2, CHAR_PROP_WRITE, ATTR_PERMISSION_NONE, 
+                       GATT_NOTIFY_ATTRIBUTE_WRITE, 16, 0, &handle );
+    TEST_assertSamePacket( );
+}
+
+void test_updateAndAllowReadMatch( void )
+{
+    GEN_aci_gatt_update_char_value( 0x000C, 0x000E, 0, sizeof( charValue ), charValue );
+    TEST_keepPacket( );
+    aci_gatt_update_char_value( 0x000C, 0x000E, 0, sizeof( charValue ), charValue );
+    TEST_assertSamePacket( );
+
+    GEN_aci_gatt_allow_read( 0x0801 );
+    TEST_keepPacket( );
+    aci_gatt_allow_read( 0x0801 );
+    TEST_assertSamePacket( );
+}
+
+/*******************************************************************************************************/
+/*Decoding: response fields land in the output pointers, errors leave them alone*/
+void test_gapInitDecodesHandles( void )
+{
+    const uint8_t rsp[ ] = { 0x05, 0x00, 0x06, 0x00, 0x07, 0x00 };
+    uint16_t genH[ 3 ], h[ 3 ];
+
+    memcpy( HOST_completeParams, rsp, sizeof( rsp ) );
+    HOST_completeLen = sizeof( rsp );
+
+    GEN_aci_gap_init( GAP_PERIPHERAL_ROLE, 0, 9, &genH[ 0 ], &genH[ 1 ], &genH[ 2 ] );
+    TEST_keepPacket( );
+    aci_gap_init( GAP_PERIPHERAL_ROLE, 0, 9, &h[ 0 ], &h[ 1 ], &h[ 2 ] );
+    TEST_assertSamePacket( );
+
+    TEST_ASSERT_EQUAL_HEX16( 0x0005, h[ 0 ] );
+    TEST_ASSERT_EQUAL_HEX16( 0x0006, h[ 1 ] );
+    TEST_ASSERT_EQUAL_HEX16( 0x0007, h[ 2 ] );
+    TEST_ASSERT_EQUAL_UINT16_ARRAY( genH, h, 3 );
+}
+
+void test_errorStatusMatches( void )
+{
+    uint16_t handle = 0xBEEF;
+
+    HOST_completeStatus = BLE_STATUS_INSUFFICIENT_RESOURCES;
+
+    TEST_ASSERT_EQUAL_HEX8( BLE_STATUS_INSUFFICIENT_RESOURCES, 
+                            GEN_aci_gatt_add_service( TEST_UUID_16, &serviceUuid, PRIMARY_SERVICE, 9, &handle ) );
+    TEST_ASSERT_EQUAL_HEX8( BLE_STATUS_INSUFFICIENT_RESOURCES, 
+                            aci_gatt_add_service( TEST_UUID_16, &serviceUuid, PRIMARY_SERVICE, 9, &handle ) );
+    TEST_ASSERT_EQUAL_HEX16( 0xBEEF, handle );
+}
+
+/*A bad UUID type is refused by both versions before anything is sent*/
+void test_invalidUuidTypeRejected( void )
+{
+    uint16_t handle;
+
+    TEST_ASSERT_EQUAL_HEX8( BLE_STATUS_ERROR, GEN_aci_gatt_add_service( 3, &serviceUuid, PRIMARY_SERVICE, 9, &handle ) );
+    TEST_ASSERT_EQUAL_HEX8( BLE_STATUS_ERROR, aci_gatt_add_service( 3, &serviceUuid, PRIMARY_SERVICE, 9, &handle ) );
+    TEST_ASSERT_EQUAL_UINT32( 0, HOST_sends );
+}
+
+/*******************************************************************************************************/
+/*Encode time: the mix the application sends at run time plus a service build, through the same fake bus, so the 
+  difference between the two figures is the encode and decode. Reported only, host timing is not asserted*/
+/*The parameter length is 8 bits in the packet header: a payload over HCI_MAX_PAYLOAD_SIZE is refused, not truncated*/
+void test_payloadOverMaxRejected( void )
+{
+    static uint8_t value[ HCI_MAX_PAYLOAD_SIZE ];
+
+    TEST_ASSERT_EQUAL_HEX8( BLE_STATUS_INVALID_PARAMS, 
+                            aci_gatt_update_char_value( 0x000C, 0x000E, 0, HCI_MAX_PAYLOAD_SIZE - 5, value ) );
+    TEST_ASSERT_EQUAL_UINT32( 0, HOST_sends );
+
+    TEST_ASSERT_EQUAL_HEX8( BLE_STATUS_SUCCESS, aci_gatt_update_char_value( 0x000C, 0x000E, 0, HCI_MAX_PAYLOAD_SIZE - 6, value ) );
+    TEST_ASSERT_EQUAL_UINT16( 4 + HCI_MAX_PAYLOAD_SIZE, HOST_txLen );
+    TEST_ASSERT_EQUAL_HEX8( HCI_MAX_PAYLOAD_SIZE, HOST_tx[ 3 ] );
+}
+
+void test_encodeBenchmark( void )
+{
+    uint32_t start, gen, table;
+    uint16_t handle;
+    uint32_t i;
+    char msg[ 80 ];
+
+    start = PROF_hostCycles( );
+    for( i = 0; i < TEST_BENCH_ROUNDS; i++ )
+    {
+        GEN_aci_gatt_update_char_value( 0x000C, 0x000E, 0, sizeof( charValue ), charValue );
+        GEN_aci_gatt_add_char( 0x000C, TEST_UUID_128, &charUuid, 20, CHAR_PROP_READ, ATTR_PERMISSION_NONE, 
+                               GATT_DONT_NOTIFY_EVENTS, 16, 1, &handle );
+        GEN_aci_gap_set_discoverable( 0x00, 0x0020, 0x0040, 0x00, 0x00, sizeof( localName ), localName, 
+                                      sizeof( uuidList ), uuidList, 0x0006, 0x0010 );
+    }
+    gen = PROF_hostCycles( ) - start;
+
+    start = PROF_hostCycles( );
+    for( i = 0; i < TEST_BENCH_ROUNDS; i++ )
+    {
+        aci_gatt_update_char_value( 0x000C, 0x000E, 0, sizeof( charValue ), charValue );
+        aci_gatt_add_char( 0x000C, TEST_UUID_128, &charUuid, 20, CHAR_PROP_READ, ATTR_PERMISSION_NONE, 
+                           GATT_DONT_NOTIFY_EVENTS, 16, 1, &handle );
+        aci_gap_set_discoverable( 0x00, 0x0020, 0x0040, 0x00, 0x00, sizeof( localName ), localName, 
+                                  sizeof( uuidList ), uuidList, 0x0006, 0x0010 );
+    }
+    table = PROF_hostCycles( ) - start;
+
+    snprintf( msg, sizeof( msg ), "ns/command: generated %lu, table driven %lu", 
+              ( unsigned long )( gen / ( 3 * TEST_BENCH_ROUNDS ) ), ( unsigned long )( table / ( 3 * TEST_BENCH_ROUNDS ) ) );
+    TEST_MESSAGE( msg );
+
+    TEST_ASSERT_EQUAL_UINT32( 6 * TEST_BENCH_ROUNDS, HOST_sends );
+}
+
+int main( void )
+{
+    UNITY_BEGIN( );
+
+    RUN_TEST( test_noParamCommandsMatch );
+    RUN_TEST( test_writeConfigDataMatches );
+    RUN_TEST( test_setDiscoverableMatches );
+    RUN_TEST( test_addServiceMatches );
+    RUN_TEST( test_addCharMatches );
+    RUN_TEST( test_updateAndAllowReadMatch );
+    RUN_TEST( test_gapInitDecodesHandles );
+    RUN_TEST( test_errorStatusMatches );
+    RUN_TEST( test_invalidUuidTypeRejected );
+    RUN_TEST( test_payloadOverMaxRejected );
+    RUN_TEST( test_encodeBenchmark );
+
+    return UNITY_END( );
+}
\ No newline at end of file
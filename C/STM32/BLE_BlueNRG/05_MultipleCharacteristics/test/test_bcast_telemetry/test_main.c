@@ -0,0 +1,293 @@
+/*
+# ##############################################################################
+# File: test_main.c                                                            #
+# Project: test                                                                #
+# Created Date: Sunday, October 18th 2026, 11:59:59 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include <unity.h>
+#include <string.h>
+
+#include "bcast_telemetry.c"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static int TEST_frame( uint8_t sensor, uint8_t seq, int16_t value, uint32_t nowMs );
+static BCAST_node_t *TEST_node( void );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static const uint8_t nodeAddr[ 6 ] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#define TEST_NODES          4
+
+/*Broadcaster rotating one frame per second, each frame heard a few times*/
+#define TEST_PERIOD_MS      1000
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static BCAST_node_t     testNodes[ TEST_NODES ];
+static BCAST_decoder_t  testDecoder;
+static BCAST_reading_t  testReading;
+
+void setUp( void )
+{
+    BCAST_decoderInit( &testDecoder, testNodes, TEST_NODES, BCAST_STALE_MS );
+    memset( &testReading, 0, sizeof( testReading ) );
+}
+
+void tearDown( void )
+{
+}
+
+/*Encode a frame of nodeAddr and decode it*/
+static int TEST_frame( uint8_t sensor, uint8_t seq, int16_t value, uint32_t nowMs )
+{
+    BCAST_frame_t frame = { sensor, seq, value };
+    uint8_t adv[ BCAST_ADV_LEN ];
+
+    BCAST_encode( &frame, adv );
+    return BCAST_decode( &testDecoder, nodeAddr, adv, sizeof( adv ), nowMs, &testReading );
+}
+
+static BCAST_node_t *TEST_node( void )
+{
+    return BCAST_nodeFind( &testDecoder, nodeAddr, 0 );
+}
+
+void test_encodeParseRoundTrip( void )
+{
+    BCAST_frame_t in = { BCAST_SENSOR_TEMPERATURE, 0xA5, -1234 }, out;
+    uint8_t adv[ 3 + BCAST_ADV_LEN ] = { 0x02, 0x01, 0x06 };   /*Flags ahead of the frame*/
+    uint8_t other[ ] = { 0x02, 0x01, 0x06, 0x03, 0xFF, 0x34, 0x12 };
+
+    TEST_ASSERT_EQUAL_UINT8( BCAST_ADV_LEN, BCAST_encode( &in, &adv[ 3 ] ) );
+    TEST_ASSERT_EQUAL_INT( 1, BCAST_parse( adv, sizeof( adv ), &out ) );
+    TEST_ASSERT_EQUAL_UINT8( in.sensor, out.sensor );
+    TEST_ASSERT_EQUAL_UINT8( in.seq, out.seq );
+    TEST_ASSERT_EQUAL_INT16( in.value, out.value );
+
+    /*Truncated, or foreign manufacturer data*/
+    TEST_ASSERT_EQUAL_INT( 0, BCAST_parse( adv, sizeof( adv ) - 1, &out ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_NONE, BCAST_decode( &testDecoder, nodeAddr, other, sizeof( other ), 0, &testReading ) );
+    TEST_ASSERT_EQUAL_UINT16( 0, testDecoder.count );
+}
+
+void test_fullRotationGivesReading( void )
+{
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_BPM, 10, 72, 0 ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_WEIGHT, 11, 80, 1 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_TEMPERATURE, 12, -5, 2 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_READING, TEST_frame( BCAST_SENSOR_HUMIDITY, 13, 40, 3 * TEST_PERIOD_MS ) );
+
+    TEST_ASSERT_EQUAL_MEMORY( nodeAddr, testReading.addr, 6 );
+    TEST_ASSERT_EQUAL_UINT8( 10, testReading.baseSeq );
+    TEST_ASSERT_EQUAL_INT16( 72, testReading.values[ BCAST_SENSOR_BPM ] );
+    TEST_ASSERT_EQUAL_INT16( 80, testReading.values[ BCAST_SENSOR_WEIGHT ] );
+    TEST_ASSERT_EQUAL_INT16( -5, testReading.values[ BCAST_SENSOR_TEMPERATURE ] );
+    TEST_ASSERT_EQUAL_INT16( 40, testReading.values[ BCAST_SENSOR_HUMIDITY ] );
+    TEST_ASSERT_EQUAL_UINT32( 1, TEST_node( )->readings );
+}
+
+void test_repeatsCountedAsDuplicates( void )
+{
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_BPM, 0, 72, 0 ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_DUPLICATE, TEST_frame( BCAST_SENSOR_BPM, 0, 72, 300 ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_DUPLICATE, TEST_frame( BCAST_SENSOR_BPM, 0, 72, 600 ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_WEIGHT, 1, 80, 1000 ) );
+
+    TEST_ASSERT_EQUAL_UINT32( 2, TEST_node( )->frames );
+    TEST_ASSERT_EQUAL_UINT32( 2, TEST_node( )->duplicates );
+    TEST_ASSERT_EQUAL_UINT32( 0, TEST_node( )->lost );
+}
+
+/*A rotation missing a frame gives no reading, the next complete one does*/
+void test_gapsCountedAsLost( void )
+{
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_BPM, 0, 72, 0 ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_TEMPERATURE, 2, -5, 2 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_HUMIDITY, 3, 40, 3 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_WEIGHT, 5, 81, 5 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_TEMPERATURE, 6, -4, 6 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_HUMIDITY, 7, 41, 7 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_BPM, 8, 73, 8 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_WEIGHT, 9, 82, 9 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_TEMPERATURE, 10, -3, 10 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_READING, TEST_frame( BCAST_SENSOR_HUMIDITY, 11, 42, 11 * TEST_PERIOD_MS ) );
+
+    TEST_ASSERT_EQUAL_UINT8( 8, testReading.baseSeq );
+    TEST_ASSERT_EQUAL_INT16( 73, testReading.values[ BCAST_SENSOR_BPM ] );
+    TEST_ASSERT_EQUAL_UINT32( 2, TEST_node( )->lost );
+    TEST_ASSERT_EQUAL_UINT32( 1, TEST_node( )->readings );
+}
+
+/*The broadcaster reset mid rotation: its partial frames are not mixed with the new sequence*/
+void test_stepBackIsRestart( void )
+{
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_BPM, 40, 72, 0 ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_WEIGHT, 41, 80, 1 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_TEMPERATURE, 2, -5, 2 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_HUMIDITY, 3, 40, 3 * TEST_PERIOD_MS ) );
+
+    TEST_ASSERT_EQUAL_UINT32( 1, TEST_node( )->restarts );
+    TEST_ASSERT_EQUAL_UINT32( 0, TEST_node( )->lost );
+    TEST_ASSERT_EQUAL_UINT32( 0, TEST_node( )->readings );
+}
+
+/**
+ * The node goes quiet for exactly 256 frames and comes back on the rotation it left: by sequence alone the new frames 
+ * continue the old rotation, only the silence tells them apart.
+ */
+void test_staleSilenceBreaksRotation( void )
+{
+    uint32_t back = 258 * TEST_PERIOD_MS;
+
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_BPM, 0, 72, 0 ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_WEIGHT, 1, 80, 1 * TEST_PERIOD_MS ) );
+
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_TEMPERATURE, 2, -5, back ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_HUMIDITY, 3, 40, back + TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_UINT32( 1, TEST_node( )->stale );
+    TEST_ASSERT_EQUAL_UINT32( 0, TEST_node( )->lost );
+    TEST_ASSERT_EQUAL_UINT32( 0, TEST_node( )->readings );
+
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_BPM, 4, 90, back + 2 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_WEIGHT, 5, 81, back + 3 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_TEMPERATURE, 6, -4, back + 4 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_READING, TEST_frame( BCAST_SENSOR_HUMIDITY, 7, 41, back + 5 * TEST_PERIOD_MS ) );
+    TEST_ASSERT_EQUAL_INT16( 90, testReading.values[ BCAST_SENSOR_BPM ] );
+    TEST_ASSERT_EQUAL_INT16( 81, testReading.values[ BCAST_SENSOR_WEIGHT ] );
+}
+
+/*Silence right after a restart looks like a step back, it is counted as stale rather than as a restart*/
+void test_staleSkipsSequenceCheck( void )
+{
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_BPM, 100, 72, 0 ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_BPM, 100, 72, BCAST_STALE_MS + 1 ) );
+
+    TEST_ASSERT_EQUAL_UINT32( 0, TEST_node( )->duplicates );
+    TEST_ASSERT_EQUAL_UINT32( 0, TEST_node( )->restarts );
+    TEST_ASSERT_EQUAL_UINT32( 1, TEST_node( )->stale );
+    TEST_ASSERT_EQUAL_UINT32( 2, TEST_node( )->frames );
+}
+
+/*Repeats keep the node fresh, and the millisecond clock may wrap*/
+void test_freshAcrossClockWrap( void )
+{
+    uint32_t start = 0xFFFFFFFFUL - BCAST_STALE_MS / 2;
+
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_BPM, 0, 72, start ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_DUPLICATE, TEST_frame( BCAST_SENSOR_BPM, 0, 72, start + BCAST_STALE_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_WEIGHT, 1, 80, start + 2 * BCAST_STALE_MS ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, TEST_frame( BCAST_SENSOR_TEMPERATURE, 2, -5, start + 2 * BCAST_STALE_MS + 1 ) );
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_READING, TEST_frame( BCAST_SENSOR_HUMIDITY, 3, 40, start + 2 * BCAST_STALE_MS + 2 ) );
+
+    TEST_ASSERT_EQUAL_UINT32( 0, TEST_node( )->stale );
+}
+
+void test_nodeTableFull( void )
+{
+    BCAST_frame_t frame = { BCAST_SENSOR_BPM, 0, 72 };
+    uint8_t adv[ BCAST_ADV_LEN ], addr[ 6 ] = { 0 };
+    uint8_t index;
+
+    BCAST_encode( &frame, adv );
+    for( index = 0; index < TEST_NODES; index++ )
+    {
+        addr[ 0 ] = index;
+        TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, BCAST_decode( &testDecoder, addr, adv, sizeof( adv ), 0, &testReading ) );
+    }
+
+    addr[ 0 ] = TEST_NODES;
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FULL, BCAST_decode( &testDecoder, addr, adv, sizeof( adv ), 0, &testReading ) );
+
+    /*Known nodes are still decoded*/
+    addr[ 0 ] = 0;
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_DUPLICATE, BCAST_decode( &testDecoder, addr, adv, sizeof( adv ), 0, &testReading ) );
+    TEST_ASSERT_EQUAL_UINT16( TEST_NODES, testDecoder.count );
+}
+
+/*A long running gateway: nodes silent for longer than staleMs make room for new addresses*/
+void test_staleNodesEvicted( void )
+{
+    BCAST_frame_t frame = { BCAST_SENSOR_BPM, 0, 72 };
+    uint8_t adv[ BCAST_ADV_LEN ], addr[ 6 ] = { 0 };
+    uint8_t index;
+
+    BCAST_encode( &frame, adv );
+    for( index = 0; index < TEST_NODES; index++ )
+    {
+        addr[ 0 ] = index;
+        TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, BCAST_decode( &testDecoder, addr, adv, sizeof( adv ), index, &testReading ) );
+    }
+
+    /*Node 0 is stale, the others were heard since*/
+    addr[ 0 ] = 1;
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_DUPLICATE, BCAST_decode( &testDecoder, addr, adv, sizeof( adv ), BCAST_STALE_MS, &testReading ) );
+    addr[ 0 ] = 2;
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_DUPLICATE, BCAST_decode( &testDecoder, addr, adv, sizeof( adv ), BCAST_STALE_MS, &testReading ) );
+    addr[ 0 ] = 3;
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_DUPLICATE, BCAST_decode( &testDecoder, addr, adv, sizeof( adv ), BCAST_STALE_MS, &testReading ) );
+
+    addr[ 0 ] = TEST_NODES;
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FRAME, BCAST_decode( &testDecoder, addr, adv, sizeof( adv ), BCAST_STALE_MS + 1, &testReading ) );
+    TEST_ASSERT_EQUAL_UINT32( 1, testDecoder.evictions );
+    TEST_ASSERT_EQUAL_UINT16( TEST_NODES, testDecoder.count );
+
+    /*The new node starts from zero, the evicted address is gone*/
+    TEST_ASSERT_EQUAL_UINT32( 1, BCAST_nodeFind( &testDecoder, addr, BCAST_STALE_MS + 1 )->frames );
+    addr[ 0 ] = 0;
+    TEST_ASSERT_EQUAL_INT( BCAST_DEC_FULL, BCAST_decode( &testDecoder, addr, adv, sizeof( adv ), BCAST_STALE_MS + 1, &testReading ) );
+}
+
+int main( void )
+{
+    UNITY_BEGIN( );
+
+    RUN_TEST( test_encodeParseRoundTrip );
+    RUN_TEST( test_fullRotationGivesReading );
+    RUN_TEST( test_repeatsCountedAsDuplicates );
+    RUN_TEST( test_gapsCountedAsLost );
+    RUN_TEST( test_stepBackIsRestart );
+    RUN_TEST( test_staleSilenceBreaksRotation );
+    RUN_TEST( test_staleSkipsSequenceCheck );
+    RUN_TEST( test_freshAcrossClockWrap );
+    RUN_TEST( test_nodeTableFull );
+    RUN_TEST( test_staleNodesEvicted );
+
+    return UNITY_END( );
+}
\ No newline at end of file
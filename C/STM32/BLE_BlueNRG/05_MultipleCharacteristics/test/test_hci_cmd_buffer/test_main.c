@@ -0,0 +1,237 @@
+/*
+# ##############################################################################
+# File: test_main.c                                                            #
+# Project: test                                                                #
+# Created Date: Sunday, October 18th 2026, 11:59:31 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:31 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ble_list.c"
+#include "hci_tl.c"
+#include "hci_stats.c"
+#include "profile.c"
+#include "bluenrg1_hci_le.c"
+#include "aci_marshal.c"
+#include "bluenrg_host.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static tBleStatus TEST_legacySetAdvData( uint8_t len, uint8_t data[ 31 ] ) __attribute__( ( noinline ) );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static uint8_t advData[ 31 ] = { 0x02, 0x01, 0x06, 0x05, 0x09, 'J', 'o', 'y', '!' };
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Packet header in front of the parameters: type, opcode, length*/
+#define TEST_HDR_LEN        4
+
+/*Commands timed by the benchmark, per variant*/
+#define TEST_BENCH_CMDS     20000
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+void setUp( void )
+{
+    HOST_reset( );
+    hci_init( NULL, NULL );
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief The wrapper as generated before the shared buffer: parameters built in a stack array and copied by 
+ *        send_cmd( ). Kept as the reference for the packet bytes and the stack comparison
+ */
+static tBleStatus TEST_legacySetAdvData( uint8_t len, uint8_t data[ 31 ] )
+{
+    struct hci_request rq;
+    uint8_t cmd_buffer[ 258 ];
+    hci_le_set_advertising_data_cp0 *cp0 = ( hci_le_set_advertising_data_cp0 * )( cmd_buffer );
+    tBleStatus status = 0;
+    uint8_t index_input = 0;
+
+    cp0->Advertising_Data_Length = len;
+    index_input += 1;
+    memcpy( ( void * )&cp0->Advertising_Data, ( const void * )data, 31 );
+    index_input += 31;
+    memset( &rq, 0, sizeof( rq ) );
+    rq.ogf = 0x08;
+    rq.ocf = 0x008;
+    rq.cparam = cmd_buffer;
+    rq.clen = index_input;
+    rq.rparam = &status;
+    rq.rlen = 1;
+    if( hci_send_req( &rq, FALSE ) < 0 )
+    {
+        return BLE_STATUS_TIMEOUT;
+    }
+
+    return status;
+}
+
+/*******************************************************************************************************/
+/*Generated wrappers: parameters go straight behind the reserved header, send_cmd( ) copies nothing*/
+void test_generatedWrapperBuildsInPlace( void )
+{
+    TEST_ASSERT_EQUAL_UINT8( BLE_STATUS_SUCCESS, hci_le_set_advertising_data( 9, advData ) );
+
+    TEST_ASSERT_EQUAL_PTR( hci_get_cmd_buffer( ) - TEST_HDR_LEN, HOST_txBuf );
+    TEST_ASSERT_EQUAL_UINT16( TEST_HDR_LEN + 32, HOST_txLen );
+    TEST_ASSERT_EQUAL_HEX8( HCI_COMMAND_PKT, HOST_tx[ 0 ] );
+    TEST_ASSERT_EQUAL_HEX8( 0x08, HOST_tx[ 1 ] );           /*Opcode 0x2008, little endian*/
+    TEST_ASSERT_EQUAL_HEX8( 0x20, HOST_tx[ 2 ] );
+    TEST_ASSERT_EQUAL_UINT8( 32, HOST_tx[ 3 ] );
+    TEST_ASSERT_EQUAL_UINT8( 9, HOST_tx[ 4 ] );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( advData, &HOST_tx[ 5 ], 31 );
+}
+
+void test_marshalledCommandBuildsInPlace( void )
+{
+    uint8_t value[ 6 ] = { 1, 2, 3, 4, 5, 6 };
+    const uint8_t expect[ ] = { HCI_COMMAND_PKT, 0x06, 0xFD, 12, 0x0C, 0x00, 0x0E, 0x00, 0, 6, 1, 2, 3, 4, 5, 6 };
+
+    TEST_ASSERT_EQUAL_UINT8( BLE_STATUS_SUCCESS, aci_gatt_update_char_value( 0x000C, 0x000E, 0, 6, value ) );
+
+    TEST_ASSERT_EQUAL_PTR( hci_get_cmd_buffer( ) - TEST_HDR_LEN, HOST_txBuf );
+    TEST_ASSERT_EQUAL_UINT16( sizeof( expect ), HOST_txLen );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( expect, HOST_tx, sizeof( expect ) );
+}
+
+/*Parameters from anywhere else are copied behind the header, giving the same packet*/
+void test_foreignParamsCopied( void )
+{
+    uint8_t inPlace[ TEST_HDR_LEN + 32 ];
+
+    hci_le_set_advertising_data( 9, advData );
+    memcpy( inPlace, HOST_tx, sizeof( inPlace ) );
+
+    TEST_ASSERT_EQUAL_UINT8( BLE_STATUS_SUCCESS, TEST_legacySetAdvData( 9, advData ) );
+
+    TEST_ASSERT_EQUAL_PTR( hci_get_cmd_buffer( ) - TEST_HDR_LEN, HOST_txBuf );
+    TEST_ASSERT_EQUAL_UINT16( sizeof( inPlace ), HOST_txLen );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( inPlace, HOST_tx, sizeof( inPlace ) );
+}
+
+void test_completionStatusReturned( void )
+{
+    HOST_completeStatus = BLE_STATUS_INVALID_PARAMS;
+
+    TEST_ASSERT_EQUAL_HEX8( BLE_STATUS_INVALID_PARAMS, hci_le_set_advertising_data( 9, advData ) );
+    TEST_ASSERT_EQUAL_HEX8( BLE_STATUS_INVALID_PARAMS, aci_gatt_allow_read( 0x0801 ) );
+}
+
+/*A command nobody answers times out on the simulated tick, the buffer is free again afterwards*/
+void test_unansweredCommandTimesOut( void )
+{
+    HOST_autoComplete = 0;
+    TEST_ASSERT_EQUAL_HEX8( BLE_STATUS_TIMEOUT, hci_le_set_advertising_data( 9, advData ) );
+
+    HOST_autoComplete = 1;
+    TEST_ASSERT_EQUAL_UINT8( BLE_STATUS_SUCCESS, hci_le_set_advertising_data( 9, advData ) );
+    TEST_ASSERT_EQUAL_UINT8( 9, HOST_tx[ 4 ] );
+}
+
+/*******************************************************************************************************/
+/*Stack: depth from this frame down to the bus write, with the command built in place and in a stack array*/
+void test_stackDepth( void )
+{
+    volatile uint8_t marker = 0;
+    uintptr_t top = ( uintptr_t )&marker;
+    uintptr_t inPlace, legacy;
+    char msg[ 80 ];
+
+    hci_le_set_advertising_data( 9, advData );
+    inPlace = top - HOST_sendStack;
+
+    TEST_legacySetAdvData( 9, advData );
+    legacy = top - HOST_sendStack;
+
+    snprintf( msg, sizeof( msg ), "stack to bus write: in place %lu bytes, stack array %lu bytes", 
+              ( unsigned long )inPlace, ( unsigned long )legacy );
+    TEST_MESSAGE( msg );
+
+    TEST_ASSERT_LESS_THAN_UINT32( legacy, inPlace );
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32( 258, legacy - inPlace );
+}
+
+/*Time: whole command round trips through the fake bus, reported only, host timing is not asserted*/
+void test_benchmark( void )
+{
+    uint32_t start, inPlace, legacy;
+    uint32_t i;
+    char msg[ 80 ];
+
+    start = PROF_hostCycles( );
+    for( i = 0; i < TEST_BENCH_CMDS; i++ )
+    {
+        hci_le_set_advertising_data( 9, advData );
+    }
+    inPlace = PROF_hostCycles( ) - start;
+
+    start = PROF_hostCycles( );
+    for( i = 0; i < TEST_BENCH_CMDS; i++ )
+    {
+        TEST_legacySetAdvData( 9, advData );
+    }
+    legacy = PROF_hostCycles( ) - start;
+
+    snprintf( msg, sizeof( msg ), "ns/command: in place %lu, stack array %lu", 
+              ( unsigned long )( inPlace / TEST_BENCH_CMDS ), ( unsigned long )( legacy / TEST_BENCH_CMDS ) );
+    TEST_MESSAGE( msg );
+
+    TEST_ASSERT_EQUAL_UINT32( 2 * TEST_BENCH_CMDS, HOST_sends );
+}
+
+int main( void )
+{
+    UNITY_BEGIN( );
+
+    RUN_TEST( test_generatedWrapperBuildsInPlace );
+    RUN_TEST( test_marshalledCommandBuildsInPlace );
+    RUN_TEST( test_foreignParamsCopied );
+    RUN_TEST( test_completionStatusReturned );
+    RUN_TEST( test_unansweredCommandTimesOut );
+    RUN_TEST( test_stackDepth );
+    RUN_TEST( test_benchmark );
+
+    return UNITY_END( );
+}
\ No newline at end of file
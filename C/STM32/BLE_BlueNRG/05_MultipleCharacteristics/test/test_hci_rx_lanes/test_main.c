@@ -0,0 +1,395 @@
+/*
+# ##############################################################################
+# File: test_main.c                                                            #
+# Project: test                                                                #
+# Created Date: Sunday, October 18th 2026, 11:59:58 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include <unity.h>
+#include <string.h>
+
+#include "ble_list.c"
+#include "hci_tl.c"
+#include "hci_stats.c"
+#include "profile.c"
+#include "bluenrg_host.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static void TEST_userEvtRx( void *pData );
+static void TEST_vendorEvent( uint16_t ecode );
+static void TEST_advReport( void );
+static void TEST_disconnection( void );
+static uint16_t TEST_dropAdvFilter( uint8_t *pckt, uint16_t len );
+static void TEST_indication( void );
+static int TEST_command( void );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Events handed to the application, as event code or vendor ecode*/
+static uint16_t rxLog[ 32 ];
+static uint8_t  rxCount;
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Vendor specific events of the bulk lane*/
+#define TEST_ATTR_MODIFIED  0x0C01
+#define TEST_INDICATION     0x0C0E
+#define TEST_NOTIFICATION   0x0C0F
+
+/*Bulk events queued before the lane is full*/
+#define TEST_BULK_QUOTA     ( HCI_READ_PACKET_NUM_MAX - HCI_RX_HIGH_RESERVE )
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+void setUp( void )
+{
+    HOST_reset( );
+    hci_init( TEST_userEvtRx, NULL );
+    rxCount = 0;
+}
+
+/*Hand every queued packet back so that the next test starts with a full pool and empty lanes*/
+void tearDown( void )
+{
+    hci_user_evt_proc( );
+    memset( &hciRxStats, 0, sizeof( hciRxStats ) );
+    hciRxThrottled = FALSE;
+}
+
+static void TEST_userEvtRx( void *pData )
+{
+    const uint8_t *pckt = pData;
+
+    if( rxCount < sizeof( rxLog ) / sizeof( rxLog[ 0 ] ) )
+    {
+        rxLog[ rxCount++ ] = ( pckt[ 1 ] == EVT_VENDOR ) ? ( uint16_t )( pckt[ 3 ] | ( pckt[ 4 ] << 8 ) ) : pckt[ 1 ];
+    }
+}
+
+/*Vendor event: ecode, connection handle, attribute handle, 2 data bytes*/
+static void TEST_vendorEvent( uint16_t ecode )
+{
+    const uint8_t params[ ] = { ( uint8_t )ecode, ( uint8_t )( ecode >> 8 ), 0x01, 0x08, 0x0E, 0x00, 0x02, 0xAA, 0xBB };
+
+    HOST_event( EVT_VENDOR, params, sizeof( params ) );
+}
+
+static void TEST_advReport( void )
+{
+    const uint8_t params[ ] = { EVT_LE_ADVERTISING_REPORT, 0x01, 0x00, 0x00, 1, 2, 3, 4, 5, 6, 0x00, 0xC4 };
+
+    HOST_event( EVT_LE_META_EVENT, params, sizeof( params ) );
+}
+
+static void TEST_disconnection( void )
+{
+    const uint8_t params[ ] = { 0x00, 0x01, 0x08, 0x13 };
+
+    HOST_event( EVT_DISCONN_COMPLETE, params, sizeof( params ) );
+}
+
+/*******************************************************************************************************/
+void test_bulkEventsQueuedBehindHighLane( void )
+{
+    TEST_advReport( );
+    TEST_vendorEvent( TEST_NOTIFICATION );
+    TEST_vendorEvent( TEST_INDICATION );
+    TEST_vendorEvent( TEST_ATTR_MODIFIED );
+    TEST_disconnection( );
+
+    hci_user_evt_proc( );
+
+    TEST_ASSERT_EQUAL_UINT8( 5, rxCount );
+    TEST_ASSERT_EQUAL_HEX16( EVT_DISCONN_COMPLETE, rxLog[ 0 ] );
+    TEST_ASSERT_EQUAL_HEX16( EVT_LE_META_EVENT, rxLog[ 1 ] );
+    TEST_ASSERT_EQUAL_HEX16( TEST_NOTIFICATION, rxLog[ 2 ] );
+    TEST_ASSERT_EQUAL_HEX16( TEST_INDICATION, rxLog[ 3 ] );
+    TEST_ASSERT_EQUAL_HEX16( TEST_ATTR_MODIFIED, rxLog[ 4 ] );
+    TEST_ASSERT_EQUAL_UINT32( 4, hciRxStats.lane[ HCI_RX_LANE_BULK ].queued );
+    TEST_ASSERT_EQUAL_UINT32( 1, hciRxStats.lane[ HCI_RX_LANE_HIGH ].queued );
+}
+
+/*Past the quota notifications and advertising reports are dropped, the high lane keeps its packets*/
+void test_droppableEventsDroppedWhenFull( void )
+{
+    uint8_t i;
+
+    for( i = 0; i < TEST_BULK_QUOTA; i++ )
+    {
+        TEST_vendorEvent( TEST_NOTIFICATION );
+    }
+    TEST_vendorEvent( TEST_NOTIFICATION );
+    TEST_advReport( );
+    TEST_disconnection( );
+
+    TEST_ASSERT_EQUAL_UINT32( TEST_BULK_QUOTA, hciRxStats.lane[ HCI_RX_LANE_BULK ].queued );
+    TEST_ASSERT_EQUAL_UINT32( 2, hciRxStats.lane[ HCI_RX_LANE_BULK ].dropped );
+    TEST_ASSERT_EQUAL_UINT32( 0, hciRxStats.lane[ HCI_RX_LANE_BULK ].overQuota );
+    TEST_ASSERT_EQUAL_UINT32( 1, hciRxStats.lane[ HCI_RX_LANE_HIGH ].queued );
+
+    hci_user_evt_proc( );
+    TEST_ASSERT_EQUAL_UINT8( TEST_BULK_QUOTA + 1, rxCount );
+    TEST_ASSERT_EQUAL_HEX16( EVT_DISCONN_COMPLETE, rxLog[ 0 ] );
+}
+
+/*Past the quota indications and attribute writes are still queued, until the pool runs out*/
+void test_losslessEventsQueuedOverQuota( void )
+{
+    uint8_t i;
+
+    for( i = 0; i < TEST_BULK_QUOTA; i++ )
+    {
+        TEST_vendorEvent( TEST_NOTIFICATION );
+    }
+    TEST_vendorEvent( TEST_INDICATION );
+    TEST_vendorEvent( TEST_ATTR_MODIFIED );
+
+    TEST_ASSERT_EQUAL_UINT32( TEST_BULK_QUOTA + 2, hciRxStats.lane[ HCI_RX_LANE_BULK ].queued );
+    TEST_ASSERT_EQUAL_UINT32( 0, hciRxStats.lane[ HCI_RX_LANE_BULK ].dropped );
+    TEST_ASSERT_EQUAL_UINT32( 2, hciRxStats.lane[ HCI_RX_LANE_BULK ].overQuota );
+    TEST_ASSERT_EQUAL_UINT16( TEST_BULK_QUOTA + 2, hciRxStats.lane[ HCI_RX_LANE_BULK ].depthMax );
+    TEST_ASSERT_FALSE( hci_rx_throttled( ) );
+
+    hci_user_evt_proc( );
+    TEST_ASSERT_EQUAL_UINT8( TEST_BULK_QUOTA + 2, rxCount );
+    TEST_ASSERT_EQUAL_HEX16( TEST_INDICATION, rxLog[ TEST_BULK_QUOTA ] );
+    TEST_ASSERT_EQUAL_HEX16( TEST_ATTR_MODIFIED, rxLog[ TEST_BULK_QUOTA + 1 ] );
+}
+
+/*With every packet taken an indication stays in the BlueNRG and is read once the application frees a packet*/
+void test_losslessEventsHeldOffByBackPressure( void )
+{
+    uint8_t i;
+
+    for( i = 0; i < HCI_READ_PACKET_NUM_MAX; i++ )
+    {
+        TEST_vendorEvent( ( i < TEST_BULK_QUOTA ) ? TEST_NOTIFICATION : TEST_INDICATION );
+    }
+    TEST_ASSERT_EQUAL_UINT32( HCI_READ_PACKET_NUM_MAX - TEST_BULK_QUOTA, hciRxStats.lane[ HCI_RX_LANE_BULK ].overQuota );
+
+    /*No packet left: the read is left pending and the bus throttled*/
+    TEST_vendorEvent( TEST_ATTR_MODIFIED );
+    TEST_ASSERT_TRUE( hci_rx_throttled( ) );
+    TEST_ASSERT_EQUAL_UINT32( 1, hciRxStats.stalls );
+    TEST_ASSERT_EQUAL_UINT32( 0, hciRxStats.lane[ HCI_RX_LANE_BULK ].dropped );
+
+    /*The application drains, the transport asks for the pending read, the IRQ line still high delivers it*/
+    hci_user_evt_proc( );
+    TEST_ASSERT_FALSE( hci_rx_throttled( ) );
+    TEST_ASSERT_EQUAL_UINT32( 1, HOST_resumes );
+    TEST_ASSERT_EQUAL_INT32( 0, hci_notify_asynch_evt( NULL ) );
+    hci_user_evt_proc( );
+
+    TEST_ASSERT_EQUAL_UINT8( HCI_READ_PACKET_NUM_MAX + 1, rxCount );
+    TEST_ASSERT_EQUAL_HEX16( TEST_ATTR_MODIFIED, rxLog[ HCI_READ_PACKET_NUM_MAX ] );
+    TEST_ASSERT_EQUAL_UINT32( 0, hciRxStats.lane[ HCI_RX_LANE_BULK ].dropped );
+}
+
+/*The receive filter still sees every bulk event before the quota*/
+static uint16_t TEST_dropAdvFilter( uint8_t *pckt, uint16_t len )
+{
+    return ( pckt[ 1 ] == EVT_LE_META_EVENT ) ? 0 : len;
+}
+
+void test_filterRunsBeforeQuota( void )
+{
+    hci_register_rx_filter( TEST_dropAdvFilter );
+    TEST_advReport( );
+    TEST_vendorEvent( TEST_INDICATION );
+    hci_register_rx_filter( NULL );
+
+    TEST_ASSERT_EQUAL_UINT32( 1, hciRxStats.lane[ HCI_RX_LANE_BULK ].filtered );
+    TEST_ASSERT_EQUAL_UINT32( 1, hciRxStats.lane[ HCI_RX_LANE_BULK ].queued );
+}
+
+static void TEST_indication( void )
+{
+    TEST_vendorEvent( TEST_INDICATION );
+}
+
+/*ACI_HAL_GET_FW_BUILD_NUMBER, waiting for its Command Complete*/
+static int TEST_command( void )
+{
+    struct hci_request rq;
+    uint8_t status;
+
+    memset( &rq, 0, sizeof( rq ) );
+    rq.ogf      = 0x3F;
+    rq.ocf      = 0x000;
+    rq.event    = EVT_CMD_COMPLETE;
+    rq.rparam   = &status;
+    rq.rlen     = sizeof( status );
+
+    return hci_send_req( &rq, FALSE );
+}
+
+/*The pool is taken when an indication arrives ahead of the completion: it moves into a dropped advertising report's 
+  packet and the reserve is still there for the completion*/
+void test_reserveTakenByIndicationWhileCommandPending( void )
+{
+    uint8_t i;
+
+    for( i = 0; i < HCI_READ_PACKET_NUM_MAX; i++ )
+    {
+        if( i < TEST_BULK_QUOTA )
+        {
+            TEST_advReport( );
+        }
+        else
+        {
+            TEST_disconnection( );
+        }
+    }
+
+    HOST_beforeComplete = TEST_indication;
+    TEST_ASSERT_EQUAL_INT( 0, TEST_command( ) );
+
+    TEST_ASSERT_EQUAL_UINT32( 2, hciRxStats.reserveUsed );
+    TEST_ASSERT_EQUAL_UINT32( 1, hciRxStats.reserveMoved );
+    TEST_ASSERT_EQUAL_UINT32( 0, hciRxStats.reserveHeld );
+    TEST_ASSERT_EQUAL_UINT32( 1, hciRxStats.lane[ HCI_RX_LANE_BULK ].dropped );
+    TEST_ASSERT_FALSE( hci_rx_throttled( ) );
+
+    hci_user_evt_proc( );
+    TEST_ASSERT_EQUAL_UINT8( HCI_READ_PACKET_NUM_MAX, rxCount );
+    TEST_ASSERT_EQUAL_HEX16( EVT_DISCONN_COMPLETE, rxLog[ 0 ] );
+    TEST_ASSERT_EQUAL_HEX16( TEST_INDICATION, rxLog[ HCI_READ_PACKET_NUM_MAX - 1 ] );
+}
+
+/*A droppable event read into the reserve is dropped at once*/
+void test_reserveTakenByAdvReportIsDropped( void )
+{
+    uint8_t i;
+
+    for( i = 0; i < HCI_READ_PACKET_NUM_MAX; i++ )
+    {
+        if( i < TEST_BULK_QUOTA )
+        {
+            TEST_vendorEvent( TEST_INDICATION );
+        }
+        else
+        {
+            TEST_disconnection( );
+        }
+    }
+
+    HOST_beforeComplete = TEST_advReport;
+    TEST_ASSERT_EQUAL_INT( 0, TEST_command( ) );
+
+    TEST_ASSERT_EQUAL_UINT32( 0, hciRxStats.reserveMoved );
+    TEST_ASSERT_EQUAL_UINT32( 1, hciRxStats.lane[ HCI_RX_LANE_BULK ].dropped );
+
+    hci_user_evt_proc( );
+    TEST_ASSERT_EQUAL_UINT8( HCI_READ_PACKET_NUM_MAX, rxCount );
+}
+
+/*An unrelated high lane event read into the reserve while a command waits is delivered after it, not dropped*/
+void test_reserveTakenByDisconnectionIsDelivered( void )
+{
+    uint8_t i;
+
+    for( i = 0; i < HCI_READ_PACKET_NUM_MAX; i++ )
+    {
+        if( i < TEST_BULK_QUOTA )
+        {
+            TEST_advReport( );
+        }
+        else
+        {
+            TEST_disconnection( );
+        }
+    }
+
+    /*The completion stays pending in the BlueNRG until the disconnection leaves the reserve*/
+    HOST_beforeComplete = TEST_disconnection;
+    HOST_autoResume     = 1;
+    TEST_ASSERT_EQUAL_INT( 0, TEST_command( ) );
+
+    TEST_ASSERT_EQUAL_UINT32( 1, hciRxStats.stalls );
+    TEST_ASSERT_EQUAL_UINT32( 1, hciRxStats.reserveMoved );
+    TEST_ASSERT_EQUAL_UINT32( 1, hciRxStats.lane[ HCI_RX_LANE_BULK ].dropped );
+
+    hci_user_evt_proc( );
+    TEST_ASSERT_EQUAL_UINT8( HCI_READ_PACKET_NUM_MAX, rxCount );
+    for( i = 0; i < HCI_READ_PACKET_NUM_MAX - TEST_BULK_QUOTA + 1; i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX16( EVT_DISCONN_COMPLETE, rxLog[ i ] );
+    }
+}
+
+/*Nothing droppable to make room: the event keeps the reserve and the command times out, the event is still delivered*/
+void test_reserveHeldWhenNothingDroppable( void )
+{
+    uint8_t i;
+
+    for( i = 0; i < HCI_READ_PACKET_NUM_MAX; i++ )
+    {
+        if( i < TEST_BULK_QUOTA )
+        {
+            TEST_vendorEvent( TEST_INDICATION );
+        }
+        else
+        {
+            TEST_disconnection( );
+        }
+    }
+
+    HOST_beforeComplete = TEST_disconnection;
+    TEST_ASSERT_EQUAL_INT( -1, TEST_command( ) );
+    TEST_ASSERT_EQUAL_UINT32( 1, hciRxStats.reserveHeld );
+    TEST_ASSERT_TRUE( hci_rx_throttled( ) );
+
+    hci_user_evt_proc( );
+    TEST_ASSERT_EQUAL_UINT8( HCI_READ_PACKET_NUM_MAX + 1, rxCount );
+    TEST_ASSERT_EQUAL_UINT32( 0, hciRxStats.lane[ HCI_RX_LANE_BULK ].dropped );
+}
+
+int main( void )
+{
+    UNITY_BEGIN( );
+
+    RUN_TEST( test_bulkEventsQueuedBehindHighLane );
+    RUN_TEST( test_droppableEventsDroppedWhenFull );
+    RUN_TEST( test_losslessEventsQueuedOverQuota );
+    RUN_TEST( test_losslessEventsHeldOffByBackPressure );
+    RUN_TEST( test_filterRunsBeforeQuota );
+    RUN_TEST( test_reserveTakenByIndicationWhileCommandPending );
+    RUN_TEST( test_reserveTakenByAdvReportIsDropped );
+    RUN_TEST( test_reserveTakenByDisconnectionIsDelivered );
+    RUN_TEST( test_reserveHeldWhenNothingDroppable );
+
+    return UNITY_END( );
+}
\ No newline at end of file
@@ -0,0 +1,367 @@
+/*
+# ##############################################################################
+# File: test_main.c                                                            #
+# Project: test                                                                #
+# Created Date: Sunday, October 18th 2026, 11:52:14 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:52:14 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include <unity.h>
+#include <string.h>
+
+#include "scheduler.c"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static void TEST_task( void *arg );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Stub Clock: SCHED_hostCycles( ) returns hostClock, a task advances it by the cycles it pretends to use*/
+static uint32_t hostClock;
+static uint32_t hostIdles;
+
+/*Tasks append their id to runLog when run*/
+static uint8_t  runLog[ 64 ];
+static uint8_t  runCount;
+static uint32_t taskCycles[ SCHED_MAX_TASKS ];
+static uint8_t  taskArgs[ SCHED_MAX_TASKS ];
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Task ids used by the tests, a lower id is a higher priority*/
+#define TASK_HIGH       1
+#define TASK_MID        7
+#define TASK_LOW        31
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Host Port-------------------------------------------------------------------------------------------------*/
+
+uint32_t SCHED_hostCycles( void )
+{
+    return hostClock;
+}
+
+void SCHED_hostIdle( void )
+{
+    hostIdles++;
+    SCHED_tick( );
+}
+
+/*Helpers---------------------------------------------------------------------------------------------------*/
+
+static void TEST_task( void *arg )
+{
+    uint8_t task = *( uint8_t * )arg;
+
+    if( runCount < sizeof( runLog ) )
+    {
+        runLog[ runCount++ ] = task;
+    }
+    hostClock += taskCycles[ task ];
+}
+
+static void TEST_createTask( uint8_t task )
+{
+    taskArgs[ task ] = task;
+    TEST_ASSERT_TRUE( SCHED_taskCreate( task, TEST_task, &taskArgs[ task ], "test" ) );
+}
+
+/**
+ * @brief Run every ready task, returns how many ran
+ * 
+ */
+static uint8_t TEST_runAll( void )
+{
+    uint8_t ran = 0;
+
+    while( SCHED_runOnce( ) )
+    {
+        ran++;
+    }
+
+    return ran;
+}
+
+/**
+ * @brief Tick n times through SCHED_tick( ) and run the ready tasks after each tick
+ * 
+ */
+static void TEST_ticks( uint32_t n )
+{
+    while( n-- )
+    {
+        SCHED_tick( );
+        TEST_runAll( );
+    }
+}
+
+void setUp( void )
+{
+    SCHED_init( );
+    hostClock   = 0;
+    hostIdles   = 0;
+    runCount    = 0;
+    memset( runLog, 0, sizeof( runLog ) );
+    memset( taskCycles, 0, sizeof( taskCycles ) );
+
+    TEST_createTask( TASK_HIGH );
+    TEST_createTask( TASK_MID );
+    TEST_createTask( TASK_LOW );
+}
+
+void tearDown( void )
+{
+}
+
+/*Tests-----------------------------------------------------------------------------------------------------*/
+
+static void test_taskCreateRejectsInvalidIds( void )
+{
+    TEST_ASSERT_FALSE( SCHED_taskCreate( SCHED_MAX_TASKS, TEST_task, NULL, "bad" ) );
+    TEST_ASSERT_FALSE( SCHED_taskCreate( 2, NULL, NULL, "bad" ) );
+    TEST_ASSERT_FALSE( SCHED_taskCreate( TASK_MID, TEST_task, NULL, "dup" ) );
+}
+
+static void test_postRunsHighestPriorityFirst( void )
+{
+    SCHED_post( TASK_LOW );
+    SCHED_post( TASK_MID );
+    SCHED_post( TASK_HIGH );
+
+    TEST_ASSERT_EQUAL( 3, TEST_runAll( ) );
+    TEST_ASSERT_EQUAL( TASK_HIGH, runLog[ 0 ] );
+    TEST_ASSERT_EQUAL( TASK_MID, runLog[ 1 ] );
+    TEST_ASSERT_EQUAL( TASK_LOW, runLog[ 2 ] );
+    TEST_ASSERT_FALSE( SCHED_runOnce( ) );
+}
+
+static void test_postWhileReadyRunsOnce( void )
+{
+    SCHED_taskStats_t stats;
+
+    SCHED_post( TASK_MID );
+    SCHED_post( TASK_MID );
+    SCHED_post( SCHED_MAX_TASKS );
+
+    TEST_ASSERT_EQUAL( 1, TEST_runAll( ) );
+    TEST_ASSERT_TRUE( SCHED_getTaskStats( TASK_MID, &stats ) );
+    TEST_ASSERT_EQUAL( 2, stats.posts );
+    TEST_ASSERT_EQUAL( 1, stats.runs );
+}
+
+static void test_runTimeAccountingUsesTheClock( void )
+{
+    SCHED_taskStats_t stats;
+
+    taskCycles[ TASK_HIGH ] = 100;
+    SCHED_post( TASK_HIGH );
+    TEST_runAll( );
+    taskCycles[ TASK_HIGH ] = 300;
+    SCHED_post( TASK_HIGH );
+    TEST_runAll( );
+
+    TEST_ASSERT_TRUE( SCHED_getTaskStats( TASK_HIGH, &stats ) );
+    TEST_ASSERT_EQUAL( 2, stats.runs );
+    TEST_ASSERT_EQUAL( 400, stats.cyclesTotal );
+    TEST_ASSERT_EQUAL( 300, stats.cyclesMax );
+    TEST_ASSERT_FALSE( SCHED_getTaskStats( 2, &stats ) );
+}
+
+static void test_oneShotTimerExpiresOnItsTick( void )
+{
+    SCHED_timer_t timer = { 0 };
+
+    SCHED_timerStart( &timer, TASK_MID, 5, 0 );
+    TEST_ASSERT_EQUAL( 5, SCHED_ticksToNextTimer( ) );
+
+    TEST_ticks( 4 );
+    TEST_ASSERT_EQUAL( 0, runCount );
+
+    TEST_ticks( 1 );
+    TEST_ASSERT_EQUAL( 1, runCount );
+    TEST_ASSERT_EQUAL( TASK_MID, runLog[ 0 ] );
+    TEST_ASSERT_FALSE( timer.running );
+    TEST_ASSERT_EQUAL( SCHED_NO_TIMER, SCHED_ticksToNextTimer( ) );
+
+    TEST_ticks( 2 * SCHED_WHEEL_SLOTS );
+    TEST_ASSERT_EQUAL( 1, runCount );
+}
+
+static void test_timerBeyondOneWheelTurn( void )
+{
+    SCHED_timer_t timer = { 0 };
+    SCHED_timer_t near = { 0 };
+
+    /*Same slot, one wheel turn apart*/
+    SCHED_timerStart( &timer, TASK_LOW, 3 + SCHED_WHEEL_SLOTS, 0 );
+    SCHED_timerStart( &near, TASK_HIGH, 3, 0 );
+
+    TEST_ticks( 3 );
+    TEST_ASSERT_EQUAL( 1, runCount );
+    TEST_ASSERT_EQUAL( TASK_HIGH, runLog[ 0 ] );
+    TEST_ASSERT_TRUE( timer.running );
+
+    TEST_ticks( SCHED_WHEEL_SLOTS - 1 );
+    TEST_ASSERT_EQUAL( 1, runCount );
+
+    TEST_ticks( 1 );
+    TEST_ASSERT_EQUAL( 2, runCount );
+    TEST_ASSERT_EQUAL( TASK_LOW, runLog[ 1 ] );
+}
+
+static void test_periodicTimerRearms( void )
+{
+    SCHED_timer_t timer = { 0 };
+    uint32_t start = SCHED_getTick( );
+    uint8_t i;
+
+    SCHED_timerStart( &timer, TASK_MID, 2, 10 );
+
+    TEST_ticks( 2 + 10 * 5 );
+    TEST_ASSERT_EQUAL( 6, runCount );
+    TEST_ASSERT_TRUE( timer.running );
+    TEST_ASSERT_EQUAL( start + 2 + 10 * 6, timer.expiry );
+
+    for( i = 0; i < runCount; i++ )
+    {
+        TEST_ASSERT_EQUAL( TASK_MID, runLog[ i ] );
+    }
+
+    SCHED_timerStop( &timer );
+    TEST_ticks( 20 );
+    TEST_ASSERT_EQUAL( 6, runCount );
+    TEST_ASSERT_FALSE( timer.running );
+}
+
+static void test_timerRestartMovesTheExpiry( void )
+{
+    SCHED_timer_t timer = { 0 };
+
+    SCHED_timerStart( &timer, TASK_MID, 3, 0 );
+    TEST_ticks( 2 );
+    SCHED_timerStart( &timer, TASK_MID, 3, 0 );
+
+    TEST_ticks( 2 );
+    TEST_ASSERT_EQUAL( 0, runCount );
+    TEST_ticks( 1 );
+    TEST_ASSERT_EQUAL( 1, runCount );
+
+    /*A zero delay is rounded up to the next tick*/
+    SCHED_timerStart( &timer, TASK_MID, 0, 0 );
+    TEST_ticks( 1 );
+    TEST_ASSERT_EQUAL( 2, runCount );
+}
+
+static void test_tickAdvancePostsMissedTimersOnce( void )
+{
+    SCHED_timer_t oneShot = { 0 };
+    SCHED_timer_t periodic = { 0 };
+    SCHED_timer_t later = { 0 };
+    uint32_t start = SCHED_getTick( );
+
+    SCHED_timerStart( &oneShot, TASK_HIGH, 7, 0 );
+    SCHED_timerStart( &periodic, TASK_MID, 4, 4 );
+    SCHED_timerStart( &later, TASK_LOW, 200, 0 );
+
+    /*Low power idle for 3.5 periods of the periodic timer, across more than one wheel turn*/
+    SCHED_tickAdvance( 50 );
+    TEST_ASSERT_EQUAL( start + 50, SCHED_getTick( ) );
+
+    TEST_ASSERT_EQUAL( 2, TEST_runAll( ) );
+    TEST_ASSERT_EQUAL( TASK_HIGH, runLog[ 0 ] );
+    TEST_ASSERT_EQUAL( TASK_MID, runLog[ 1 ] );
+    TEST_ASSERT_FALSE( oneShot.running );
+    TEST_ASSERT_TRUE( later.running );
+
+    /*The periodic timer skipped the periods it missed and stays on its grid*/
+    TEST_ASSERT_EQUAL( start + 52, periodic.expiry );
+    TEST_ASSERT_EQUAL( 2, SCHED_ticksToNextTimer( ) );
+
+    SCHED_tickAdvance( 0 );
+    TEST_ASSERT_EQUAL( start + 50, SCHED_getTick( ) );
+
+    TEST_ticks( 2 );
+    TEST_ASSERT_EQUAL( 3, runCount );
+    TEST_ASSERT_EQUAL( TASK_MID, runLog[ 2 ] );
+
+    SCHED_tickAdvance( 200 );
+    TEST_ASSERT_EQUAL( 2, TEST_runAll( ) );
+    TEST_ASSERT_FALSE( later.running );
+}
+
+static void test_tickWrapAround( void )
+{
+    SCHED_timer_t timer = { 0 };
+
+    /*Move the tick just before the 32 bit wrap, expiry compares must stay correct across it*/
+    SCHED_tickAdvance( 0xFFFFFFF0UL - SCHED_getTick( ) );
+    SCHED_timerStart( &timer, TASK_MID, 0x20, 0 );
+
+    TEST_ticks( 0x1F );
+    TEST_ASSERT_EQUAL( 0, runCount );
+    TEST_ticks( 1 );
+    TEST_ASSERT_EQUAL( 1, runCount );
+    TEST_ASSERT_EQUAL( 0x10, SCHED_getTick( ) );
+}
+
+static void test_hostIdleAdvancesTheTick( void )
+{
+    uint32_t start = SCHED_getTick( );
+
+    SCHED_IDLE( );
+    SCHED_IDLE( );
+    TEST_ASSERT_EQUAL( 2, hostIdles );
+    TEST_ASSERT_EQUAL( start + 2, SCHED_getTick( ) );
+}
+
+int main( void )
+{
+    UNITY_BEGIN( );
+
+    RUN_TEST( test_taskCreateRejectsInvalidIds );
+    RUN_TEST( test_postRunsHighestPriorityFirst );
+    RUN_TEST( test_postWhileReadyRunsOnce );
+    RUN_TEST( test_runTimeAccountingUsesTheClock );
+    RUN_TEST( test_oneShotTimerExpiresOnItsTick );
+    RUN_TEST( test_timerBeyondOneWheelTurn );
+    RUN_TEST( test_periodicTimerRearms );
+    RUN_TEST( test_timerRestartMovesTheExpiry );
+    RUN_TEST( test_tickAdvancePostsMissedTimersOnce );
+    RUN_TEST( test_tickWrapAround );
+    RUN_TEST( test_hostIdleAdvancesTheTick );
+
+    return UNITY_END( );
+}
\ No newline at end of file
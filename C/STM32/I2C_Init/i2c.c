@@ -5,7 +5,7 @@
 # Created Date: Saturday, October 28th 2023, 6:18:44 pm                        #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Saturday, October 28th 2023, 6:55:39 pm                       #
+# Last Modified: Sunday, October 18th 2026, 11:08:52 am                        #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -32,6 +32,23 @@
 /*##############################################################################################################################################*/
 
 I2C_HandleTypeDef hi2c1;
+/**
+ * @brief Speed Profiles. Fast-mode Plus ( 1 MHz ) is not supported by the STM32F4 I2C peripheral.
+ * 
+ */
+static const I2C_speedProfileCfg_t i2cSpeedProfiles[ I2C_SPEED_PROFILE_COUNT ] = 
+{
+    [ I2C_SPEED_STANDARD_100K ]         = { 100000, I2C_DUTYCYCLE_2,    "100k" },
+    [ I2C_SPEED_FAST_400K_DUTY2 ]       = { 400000, I2C_DUTYCYCLE_2,    "400k Duty 2" },
+    [ I2C_SPEED_FAST_400K_DUTY16_9 ]    = { 400000, I2C_DUTYCYCLE_16_9, "400k Duty 16/9" },
+};
+
+static I2C_speedProfile_t i2cSpeedProfile = I2C_SPEED_STANDARD_100K;
+
+#if I2C_USE_DMA
+DMA_HandleTypeDef hdma_i2c1_tx;
+DMA_HandleTypeDef hdma_i2c1_rx;
+#endif
 
 /*##############################################################################################################################################*/
 /*DEFINES_______________________________________________________________________________________________________________________________________*/
@@ -61,9 +78,27 @@ I2C_HandleTypeDef hi2c1;
  */
 void I2C_init( void )
 {
+    I2C_initWithSpeed( I2C_SPEED_DEFAULT );
+}
+
+/**
+ * @brief I2C Initialization Function with a Speed Profile. The profile is validated against the APB1 clock configured 
+ * by SystemClock_Config( ), which must have been called before.
+ * 
+ * @param profile Bus Speed Profile
+ */
+void I2C_initWithSpeed( I2C_speedProfile_t profile )
+{
+    I2C_speedInfo_t info;
+
+    if( I2C_speedValidate( profile, &info ) != HAL_OK )
+    {
+        Error_Handler();
+    }
+
     hi2c1.Instance = I2C1;
-    hi2c1.Init.ClockSpeed = 100000;
-    hi2c1.Init.DutyCycle = I2C_DUTYCYCLE_2;
+    hi2c1.Init.ClockSpeed = i2cSpeedProfiles[ profile ].clockSpeed;
+    hi2c1.Init.DutyCycle = i2cSpeedProfiles[ profile ].dutyCycle;
     hi2c1.Init.OwnAddress1 = 0;
     hi2c1.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
     hi2c1.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
@@ -75,6 +110,233 @@ void I2C_init( void )
     {
         Error_Handler();
     }
+
+    i2cSpeedProfile = profile;
+    I2C_cycleCounterInit( );
+}
+
+/**
+ * @brief Validate a Speed Profile against the current APB1 ( PCLK1 ) clock and compute the resulting bus timing.
+ * 
+ * The I2C peripheral needs PCLK1 >= 2 MHz for Standard-mode and >= 4 MHz for Fast-mode. The SCL frequency is derived
+ * from PCLK1 by an integer divider ( CCR ), so the real frequency is at or below the target: Duty 16/9 only reaches 
+ * 400 kHz when PCLK1 is a multiple of 10 MHz, Duty 2 when it is a multiple of 1.2 MHz.
+ * 
+ * @param profile Bus Speed Profile
+ * @param info Resulting Timing ( may be NULL )
+ * @return HAL_StatusTypeDef HAL_OK if usable, HAL_ERROR if PCLK1 is too slow or the real SCL frequency is below I2C_SPEED_MIN_PERCENT of the target
+ */
+HAL_StatusTypeDef I2C_speedValidate( I2C_speedProfile_t profile, I2C_speedInfo_t *info )
+{
+    const I2C_speedProfileCfg_t *cfg;
+    I2C_speedInfo_t result;
+    uint32_t pclk1MHz;
+    uint32_t divider;
+
+    if( profile >= I2C_SPEED_PROFILE_COUNT )
+    {
+        return HAL_ERROR;
+    }
+
+    cfg = &i2cSpeedProfiles[ profile ];
+
+    result.pclk1Hz  = HAL_RCC_GetPCLK1Freq( );
+    result.targetHz = cfg->clockSpeed;
+    pclk1MHz        = result.pclk1Hz / 1000000U;
+
+    if( cfg->clockSpeed <= I2C_SPEED_STANDARD_MAX_HZ )
+    {
+        if( result.pclk1Hz < I2C_PCLK1_MIN_STANDARD_HZ )
+        {
+            return HAL_ERROR;
+        }
+
+        /*Thigh = Tlow = CCR x Tpclk1, CCR >= 4*/
+        divider     = 2;
+        result.ccr  = ( ( result.pclk1Hz - 1U ) / ( cfg->clockSpeed * divider ) ) + 1U;
+        if( result.ccr < 4U )
+        {
+            result.ccr = 4U;
+        }
+        /*Max Rise Time 1000 ns*/
+        result.trise = pclk1MHz + 1U;
+    }
+    else
+    {
+        if( result.pclk1Hz < I2C_PCLK1_MIN_FAST_HZ )
+        {
+            return HAL_ERROR;
+        }
+
+        /*Duty 2: Tlow/Thigh = 2, Duty 16/9: Tlow/Thigh = 16/9*/
+        divider     = ( cfg->dutyCycle == I2C_DUTYCYCLE_2 ) ? 3U : 25U;
+        result.ccr  = ( ( result.pclk1Hz - 1U ) / ( cfg->clockSpeed * divider ) ) + 1U;
+        /*Max Rise Time 300 ns*/
+        result.trise = ( ( pclk1MHz * 300U ) / 1000U ) + 1U;
+    }
+
+    if( result.ccr > I2C_CCR_CCR )
+    {
+        return HAL_ERROR;
+    }
+
+    result.actualHz = result.pclk1Hz / ( result.ccr * divider );
+
+    if( info != NULL )
+    {
+        *info = result;
+    }
+
+    if( result.actualHz < ( ( cfg->clockSpeed / 100U ) * I2C_SPEED_MIN_PERCENT ) )
+    {
+        return HAL_ERROR;
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Switch the bus speed at runtime. Only allowed between transactions: the peripheral must be idle and the bus free.
+ * Only the timing registers are reprogrammed, GPIO / DMA / NVIC setup is kept.
+ * 
+ * @param profile New Bus Speed Profile
+ * @return HAL_StatusTypeDef HAL_OK on success, HAL_BUSY if a transaction is in progress, HAL_ERROR if the profile is not usable
+ */
+HAL_StatusTypeDef I2C_setSpeed( I2C_speedProfile_t profile )
+{
+    HAL_StatusTypeDef ret;
+    uint32_t uwPRIMASK_Bit;
+
+    if( I2C_speedValidate( profile, NULL ) != HAL_OK )
+    {
+        return HAL_ERROR;
+    }
+
+    if( profile == i2cSpeedProfile )
+    {
+        return HAL_OK;
+    }
+
+    uwPRIMASK_Bit = __get_PRIMASK( );
+    __disable_irq( );
+
+    if( ( hi2c1.State != HAL_I2C_STATE_READY ) || ( __HAL_I2C_GET_FLAG( &hi2c1, I2C_FLAG_BUSY ) != RESET ) )
+    {
+        __set_PRIMASK( uwPRIMASK_Bit );
+        return HAL_BUSY;
+    }
+
+    hi2c1.Init.ClockSpeed   = i2cSpeedProfiles[ profile ].clockSpeed;
+    hi2c1.Init.DutyCycle    = i2cSpeedProfiles[ profile ].dutyCycle;
+
+    /*State is READY, so HAL_I2C_Init( ) does not call HAL_I2C_MspInit( ) again*/
+    ret = HAL_I2C_Init( &hi2c1 );
+    if( ret == HAL_OK )
+    {
+        i2cSpeedProfile = profile;
+    }
+
+    __set_PRIMASK( uwPRIMASK_Bit );
+
+    return ret;
+}
+
+/**
+ * @brief Get the active Speed Profile
+ * 
+ * @return I2C_speedProfile_t Active Bus Speed Profile
+ */
+I2C_speedProfile_t I2C_getSpeed( void )
+{
+    return i2cSpeedProfile;
+}
+
+/**
+ * @brief Measure the throughput of burst register reads at every Speed Profile and print it over the Serial Port.
+ * Blocking, intended for bring-up only. The Speed Profile active before the call is restored.
+ * 
+ * @param devAddr 7 bit Slave Address of a device on the bus
+ * @param regAddr First register of the burst
+ * @param len Burst length in bytes ( <= I2C_BENCH_MAX_LEN )
+ * @param iterations Number of bursts per Speed Profile
+ */
+void I2C_benchmarkSpeeds( uint8_t devAddr, uint8_t regAddr, uint16_t len, uint16_t iterations )
+{
+    static uint8_t benchBuf[ I2C_BENCH_MAX_LEN ];
+    I2C_speedProfile_t initialProfile = i2cSpeedProfile;
+    I2C_speedProfile_t profile;
+    I2C_speedInfo_t info;
+    uint32_t startCycles, elapsedUs, okCount, i;
+
+    if( ( len == 0 ) || ( len > I2C_BENCH_MAX_LEN ) || ( iterations == 0 ) )
+    {
+        return;
+    }
+
+    printf( "I2C Benchmark: Device 0x%02X, %u byte burst, %u iterations \r\n", devAddr, len, iterations );
+
+    for( profile = 0; profile < I2C_SPEED_PROFILE_COUNT; profile++ )
+    {
+        if( I2C_speedValidate( profile, &info ) != HAL_OK )
+        {
+            printf( "  %-16s: not usable with PCLK1 = %lu Hz \r\n", i2cSpeedProfiles[ profile ].name, HAL_RCC_GetPCLK1Freq( ) );
+            continue;
+        }
+
+        if( I2C_setSpeed( profile ) != HAL_OK )
+        {
+            printf( "  %-16s: bus busy \r\n", i2cSpeedProfiles[ profile ].name );
+            continue;
+        }
+
+        okCount = 0;
+        startCycles = DWT->CYCCNT;
+
+        for( i = 0; i < iterations; i++ )
+        {
+            if( HAL_I2C_Mem_Read( &hi2c1, ( uint16_t )devAddr << 1, regAddr, I2C_MEMADD_SIZE_8BIT, benchBuf, len, I2C_BENCH_TIMEOUT_MS ) == HAL_OK )
+            {
+                okCount++;
+            }
+        }
+
+        elapsedUs = I2C_cyclesToUs( DWT->CYCCNT - startCycles );
+
+        printf( "  %-16s: SCL %lu Hz, %lu us, %lu bytes/s, %lu errors \r\n",
+            i2cSpeedProfiles[ profile ].name,
+            info.actualHz,
+            elapsedUs,
+            ( elapsedUs > 0 ) ? ( uint32_t )( ( ( uint64_t )okCount * len * 1000000U ) / elapsedUs ) : 0,
+            iterations - okCount
+        );
+    }
+
+    I2C_setSpeed( initialProfile );
+}
+
+/**
+ * @brief Enable the DWT Cycle Counter used to time I2C transfers
+ * 
+ */
+void I2C_cycleCounterInit( void )
+{
+    if( ( DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk ) == 0 )
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+/**
+ * @brief Convert a number of Core Clock Cycles to Microseconds
+ * 
+ * @param cycles Elapsed Core Clock Cycles
+ * @return uint32_t Elapsed Microseconds
+ */
+uint32_t I2C_cyclesToUs( uint32_t cycles )
+{
+    return cycles / ( SystemCoreClock / 1000000U );
 }
 
 /**
@@ -101,6 +363,55 @@ void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c)
 
         /* Peripheral clock enable */
         __HAL_RCC_I2C1_CLK_ENABLE();
+
+#if I2C_USE_DMA
+        __HAL_RCC_DMA1_CLK_ENABLE();
+
+        /* I2C1_TX: DMA1 Stream6 Channel 1 */
+        hdma_i2c1_tx.Instance                   = DMA1_Stream6;
+        hdma_i2c1_tx.Init.Channel               = DMA_CHANNEL_1;
+        hdma_i2c1_tx.Init.Direction             = DMA_MEMORY_TO_PERIPH;
+        hdma_i2c1_tx.Init.PeriphInc             = DMA_PINC_DISABLE;
+        hdma_i2c1_tx.Init.MemInc                = DMA_MINC_ENABLE;
+        hdma_i2c1_tx.Init.PeriphDataAlignment   = DMA_PDATAALIGN_BYTE;
+        hdma_i2c1_tx.Init.MemDataAlignment      = DMA_MDATAALIGN_BYTE;
+        hdma_i2c1_tx.Init.Mode                  = DMA_NORMAL;
+        hdma_i2c1_tx.Init.Priority              = DMA_PRIORITY_LOW;
+        hdma_i2c1_tx.Init.FIFOMode              = DMA_FIFOMODE_DISABLE;
+        if( HAL_DMA_Init( &hdma_i2c1_tx ) != HAL_OK )
+        {
+            Error_Handler( );
+        }
+        __HAL_LINKDMA( hi2c, hdmatx, hdma_i2c1_tx );
+
+        /* I2C1_RX: DMA1 Stream0 Channel 1 */
+        hdma_i2c1_rx.Instance                   = DMA1_Stream0;
+        hdma_i2c1_rx.Init.Channel               = DMA_CHANNEL_1;
+        hdma_i2c1_rx.Init.Direction             = DMA_PERIPH_TO_MEMORY;
+        hdma_i2c1_rx.Init.PeriphInc             = DMA_PINC_DISABLE;
+        hdma_i2c1_rx.Init.MemInc                = DMA_MINC_ENABLE;
+        hdma_i2c1_rx.Init.PeriphDataAlignment   = DMA_PDATAALIGN_BYTE;
+        hdma_i2c1_rx.Init.MemDataAlignment      = DMA_MDATAALIGN_BYTE;
+        hdma_i2c1_rx.Init.Mode                  = DMA_NORMAL;
+        hdma_i2c1_rx.Init.Priority              = DMA_PRIORITY_LOW;
+        hdma_i2c1_rx.Init.FIFOMode              = DMA_FIFOMODE_DISABLE;
+        if( HAL_DMA_Init( &hdma_i2c1_rx ) != HAL_OK )
+        {
+            Error_Handler( );
+        }
+        __HAL_LINKDMA( hi2c, hdmarx, hdma_i2c1_rx );
+
+        HAL_NVIC_SetPriority( DMA1_Stream6_IRQn, 1, 0 );
+        HAL_NVIC_EnableIRQ( DMA1_Stream6_IRQn );
+        HAL_NVIC_SetPriority( DMA1_Stream0_IRQn, 1, 0 );
+        HAL_NVIC_EnableIRQ( DMA1_Stream0_IRQn );
+#endif
+
+        /* I2C1 interrupts, used by the transaction queue. Lower priority than the BlueNRG EXTI line */
+        HAL_NVIC_SetPriority( I2C1_EV_IRQn, 1, 0 );
+        HAL_NVIC_EnableIRQ( I2C1_EV_IRQn );
+        HAL_NVIC_SetPriority( I2C1_ER_IRQn, 1, 0 );
+        HAL_NVIC_EnableIRQ( I2C1_ER_IRQn );
     }
 }
 
@@ -116,6 +427,16 @@ void HAL_I2C_MspDeInit(I2C_HandleTypeDef* hi2c)
   {
     /* Peripheral clock disable */
     __HAL_RCC_I2C1_CLK_DISABLE();
+
+    HAL_NVIC_DisableIRQ( I2C1_EV_IRQn );
+    HAL_NVIC_DisableIRQ( I2C1_ER_IRQn );
+
+#if I2C_USE_DMA
+    HAL_DMA_DeInit( hi2c->hdmatx );
+    HAL_DMA_DeInit( hi2c->hdmarx );
+    HAL_NVIC_DisableIRQ( DMA1_Stream6_IRQn );
+    HAL_NVIC_DisableIRQ( DMA1_Stream0_IRQn );
+#endif
   
     /**I2C1 GPIO Configuration    
     PB6     ------> I2C1_SCL
@@ -126,6 +447,44 @@ void HAL_I2C_MspDeInit(I2C_HandleTypeDef* hi2c)
 
 }
 
+/**
+ * @brief I2C1 Event Interrupt Handler
+ * 
+ */
+void I2C1_EV_IRQHandler( void )
+{
+    HAL_I2C_EV_IRQHandler( &hi2c1 );
+}
+
+/**
+ * @brief I2C1 Error Interrupt Handler
+ * 
+ */
+void I2C1_ER_IRQHandler( void )
+{
+    HAL_I2C_ER_IRQHandler( &hi2c1 );
+}
+
+#if I2C_USE_DMA
+/**
+ * @brief DMA1 Stream0 ( I2C1_RX ) Interrupt Handler
+ * 
+ */
+void DMA1_Stream0_IRQHandler( void )
+{
+    HAL_DMA_IRQHandler( &hdma_i2c1_rx );
+}
+
+/**
+ * @brief DMA1 Stream6 ( I2C1_TX ) Interrupt Handler
+ * 
+ */
+void DMA1_Stream6_IRQHandler( void )
+{
+    HAL_DMA_IRQHandler( &hdma_i2c1_tx );
+}
+#endif
+
 /**
  * @brief This function Scans the I2C bus for connected Slave Devices and reports their Addresses.
  * 
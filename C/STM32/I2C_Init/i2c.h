@@ -5,7 +5,7 @@
 # Created Date: Saturday, October 28th 2023, 6:18:51 pm                        #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Saturday, October 28th 2023, 6:38:42 pm                       #
+# Last Modified: Sunday, October 18th 2026, 11:08:52 am                        #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -26,9 +26,45 @@
 /*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
+/**
+ * @brief Bus Speed Profiles
+ * 
+ */
+typedef enum
+{
+    I2C_SPEED_STANDARD_100K = 0,    /*Standard-mode 100 kHz*/
+    I2C_SPEED_FAST_400K_DUTY2,      /*Fast-mode 400 kHz, Tlow/Thigh = 2*/
+    I2C_SPEED_FAST_400K_DUTY16_9,   /*Fast-mode 400 kHz, Tlow/Thigh = 16/9*/
+    I2C_SPEED_PROFILE_COUNT
+} I2C_speedProfile_t;
+
+/**
+ * @brief Bus Timing resulting from a Speed Profile and the current PCLK1
+ * 
+ */
+typedef struct
+{
+    uint32_t pclk1Hz;
+    uint32_t targetHz;
+    uint32_t actualHz;  /*Real SCL frequency ( before rise time effects )*/
+    uint32_t ccr;       /*CCR Clock Control value*/
+    uint32_t trise;     /*TRISE value*/
+} I2C_speedInfo_t;
+
 void I2C_init( void );
+void I2C_initWithSpeed( I2C_speedProfile_t profile );
+HAL_StatusTypeDef I2C_speedValidate( I2C_speedProfile_t profile, I2C_speedInfo_t *info );
+HAL_StatusTypeDef I2C_setSpeed( I2C_speedProfile_t profile );
+I2C_speedProfile_t I2C_getSpeed( void );
+void I2C_benchmarkSpeeds( uint8_t devAddr, uint8_t regAddr, uint16_t len, uint16_t iterations );
+void I2C_cycleCounterInit( void );
+uint32_t I2C_cyclesToUs( uint32_t cycles );
 void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c);
 void HAL_I2C_MspDeInit(I2C_HandleTypeDef* hi2c);
+void I2C1_EV_IRQHandler( void );
+void I2C1_ER_IRQHandler( void );
+void DMA1_Stream0_IRQHandler( void );
+void DMA1_Stream6_IRQHandler( void );
 void I2C_scanBus( void );
 
 /*##############################################################################################################################################*/
@@ -41,19 +77,54 @@ void I2C_scanBus( void );
 /*DEFINES_______________________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+/*Speed Profile used by I2C_init( )*/
+#ifndef I2C_SPEED_DEFAULT
+#define I2C_SPEED_DEFAULT           I2C_SPEED_FAST_400K_DUTY2
+#endif
+
+#define I2C_SPEED_STANDARD_MAX_HZ   100000U
+#define I2C_PCLK1_MIN_STANDARD_HZ   2000000U
+#define I2C_PCLK1_MIN_FAST_HZ       4000000U
 
+/*Minimum real SCL frequency accepted by I2C_speedValidate( ), in percent of the profile target*/
+#define I2C_SPEED_MIN_PERCENT       75U
+
+/*I2C_benchmarkSpeeds( ) limits*/
+#define I2C_BENCH_MAX_LEN           32
+#define I2C_BENCH_TIMEOUT_MS        10
+
+/*Use DMA for I2C1 transfers ( DMA1 Stream6 Channel 1 TX, DMA1 Stream0 Channel 1 RX )*/
+#ifndef I2C_USE_DMA
+#define I2C_USE_DMA     1
+#endif
 
 /*##############################################################################################################################################*/
 /*EXTERNS_______________________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
-
+extern I2C_HandleTypeDef hi2c1;
 
 /*##############################################################################################################################################*/
 /*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
-
+/**
+ * @brief Speed Profile Settings
+ * 
+ */
+typedef struct
+{
+    uint32_t    clockSpeed;
+    uint32_t    dutyCycle;
+    const char  *name;
+} I2C_speedProfileCfg_t;
 
 /*##############################################################################################################################################*/
 /*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
@@ -0,0 +1,542 @@
+/*
+# ##############################################################################
+# File: i2c_dev.c                                                              #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 1:36:05 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:31:42 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "i2c_dev.h"
+#include <string.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static I2C_devStatus_t    I2C_devBusRead( I2C_dev_t *dev, uint8_t reg, uint8_t *data, uint16_t len );
+static I2C_devStatus_t    I2C_devBusWrite( I2C_dev_t *dev, uint8_t reg, const uint8_t *data, uint16_t len );
+static void                 I2C_devRefreshShadow( I2C_dev_t *dev, uint8_t reg, const uint8_t *data, uint16_t len );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Register inside the shadowed range*/
+#define I2C_DEV_IN_SHADOW( dev, reg )   ( ( ( reg ) >= ( dev )->shadowFirst ) && ( ( uint16_t )( reg ) < ( ( uint16_t )( dev )->shadowFirst + ( dev )->shadowCount ) ) )
+
+/*Shadow index and mask bit of a register inside the shadowed range*/
+#define I2C_DEV_IDX( dev, reg )         ( ( uint8_t )( ( reg ) - ( dev )->shadowFirst ) )
+#define I2C_DEV_BIT( dev, reg )         ( 1UL << I2C_DEV_IDX( dev, reg ) )
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Initialize a Device. The shadow starts invalid, the first access to each register goes to the bus ( or call I2C_devSync( ) ).
+ * 
+ * @param dev Device
+ * @param bus Bus Operations ( &I2C_devQueueBus for hi2c1 )
+ * @param devAddr 7 bit Slave Address
+ * @param shadowFirst First configuration register to shadow
+ * @param shadowCount Number of configuration registers to shadow ( <= I2C_DEV_SHADOW_MAX, 0 for no shadow )
+ * @param autoIncrement TRUE if the device auto-increments the register address during bursts
+ * @return I2C_devStatus_t I2C_DEV_OK or I2C_DEV_ERROR on invalid parameters
+ */
+I2C_devStatus_t I2C_devInit( I2C_dev_t *dev, const I2C_devBus_t *bus, uint8_t devAddr, uint8_t shadowFirst, uint8_t shadowCount, uint8_t autoIncrement )
+{
+    if( ( dev == NULL ) || ( bus == NULL ) || ( devAddr > 0x7F ) || ( shadowCount > I2C_DEV_SHADOW_MAX ) ||
+        ( ( ( uint16_t )shadowFirst + shadowCount ) > 0x100 ) )
+    {
+        return I2C_DEV_ERROR;
+    }
+
+    memset( dev, 0, sizeof( *dev ) );
+    dev->bus            = bus;
+    dev->devAddr        = devAddr;
+    dev->shadowFirst    = shadowFirst;
+    dev->shadowCount    = shadowCount;
+    dev->autoIncrement  = autoIncrement;
+
+    return I2C_DEV_OK;
+}
+
+/**
+ * @brief Forget the shadow content, e.g. after a device reset. Staged ( dirty ) values are dropped.
+ * 
+ * @param dev Device
+ */
+void I2C_devInvalidate( I2C_dev_t *dev )
+{
+    dev->validMask = 0;
+    dev->dirtyMask = 0;
+}
+
+/**
+ * @brief Allow I2C_devReadMulti( ) to read up to gap unrequested registers to merge two requests into one burst. 
+ * Only opt in for register maps where reading the registers in between has no side effect ( no clear-on-read 
+ * status, FIFO or interrupt source registers ). The default of 0 only merges adjacent requested registers.
+ * 
+ * @param dev Device
+ * @param gap Unrequested registers allowed between two requests ( <= I2C_DEV_COALESCE_GAP_MAX )
+ * @return I2C_devStatus_t I2C_DEV_OK, or I2C_DEV_ERROR if gap is too large
+ */
+I2C_devStatus_t I2C_devSetCoalesceGap( I2C_dev_t *dev, uint8_t gap )
+{
+    if( gap > I2C_DEV_COALESCE_GAP_MAX )
+    {
+        return I2C_DEV_ERROR;
+    }
+
+    dev->coalesceGap = gap;
+
+    return I2C_DEV_OK;
+}
+
+/**
+ * @brief Load the whole shadow from the device, in a single burst if the device auto-increments. 
+ * Staged ( dirty ) values are kept.
+ * 
+ * @param dev Device
+ * @return I2C_devStatus_t Bus Status
+ */
+I2C_devStatus_t I2C_devSync( I2C_dev_t *dev )
+{
+    uint8_t data[ I2C_DEV_SHADOW_MAX ];
+    I2C_devStatus_t ret;
+    uint8_t i;
+
+    if( dev->shadowCount == 0 )
+    {
+        return I2C_DEV_OK;
+    }
+
+    if( dev->autoIncrement )
+    {
+        ret = I2C_devBusRead( dev, dev->shadowFirst, data, dev->shadowCount );
+        if( ret != I2C_DEV_OK )
+        {
+            return ret;
+        }
+    }
+    else
+    {
+        for( i = 0; i < dev->shadowCount; i++ )
+        {
+            ret = I2C_devBusRead( dev, dev->shadowFirst + i, &data[ i ], 1 );
+            if( ret != I2C_DEV_OK )
+            {
+                return ret;
+            }
+        }
+    }
+
+    I2C_devRefreshShadow( dev, dev->shadowFirst, data, dev->shadowCount );
+
+    return I2C_DEV_OK;
+}
+
+/**
+ * @brief Read one register. Shadowed registers are served from the shadow once valid.
+ * 
+ * @param dev Device
+ * @param reg Register Address
+ * @param value Register Value
+ * @return I2C_devStatus_t Bus Status
+ */
+I2C_devStatus_t I2C_devReadReg( I2C_dev_t *dev, uint8_t reg, uint8_t *value )
+{
+    I2C_devStatus_t ret;
+
+    if( I2C_DEV_IN_SHADOW( dev, reg ) && ( dev->validMask & I2C_DEV_BIT( dev, reg ) ) )
+    {
+        *value = dev->shadow[ I2C_DEV_IDX( dev, reg ) ];
+        dev->stats.cacheHits++;
+        return I2C_DEV_OK;
+    }
+
+    ret = I2C_devBusRead( dev, reg, value, 1 );
+    if( ret == I2C_DEV_OK )
+    {
+        I2C_devRefreshShadow( dev, reg, value, 1 );
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Write one register immediately ( write-through ). The write is skipped if the shadow already holds the value.
+ * 
+ * @param dev Device
+ * @param reg Register Address
+ * @param value New Register Value
+ * @return I2C_devStatus_t Bus Status
+ */
+I2C_devStatus_t I2C_devWriteReg( I2C_dev_t *dev, uint8_t reg, uint8_t value )
+{
+    I2C_devStatus_t ret;
+    uint32_t bit;
+
+    if( I2C_DEV_IN_SHADOW( dev, reg ) )
+    {
+        bit = I2C_DEV_BIT( dev, reg );
+
+        if( ( dev->validMask & bit ) && !( dev->dirtyMask & bit ) && ( dev->shadow[ I2C_DEV_IDX( dev, reg ) ] == value ) )
+        {
+            dev->stats.writesSkipped++;
+            return I2C_DEV_OK;
+        }
+
+        ret = I2C_devBusWrite( dev, reg, &value, 1 );
+        if( ret == I2C_DEV_OK )
+        {
+            dev->shadow[ I2C_DEV_IDX( dev, reg ) ] = value;
+            dev->validMask |= bit;
+            dev->dirtyMask &= ~bit;
+        }
+
+        return ret;
+    }
+
+    return I2C_devBusWrite( dev, reg, &value, 1 );
+}
+
+/**
+ * @brief Read-Modify-Write of a register field. The read comes from the shadow when valid, the write is skipped if nothing changes.
+ * 
+ * @param dev Device
+ * @param reg Register Address
+ * @param mask Bits to be modified
+ * @param value New value of the masked bits
+ * @return I2C_devStatus_t Bus Status
+ */
+I2C_devStatus_t I2C_devUpdateBits( I2C_dev_t *dev, uint8_t reg, uint8_t mask, uint8_t value )
+{
+    I2C_devStatus_t ret;
+    uint8_t current;
+
+    ret = I2C_devReadReg( dev, reg, &current );
+    if( ret != I2C_DEV_OK )
+    {
+        return ret;
+    }
+
+    return I2C_devWriteReg( dev, reg, ( uint8_t )( ( current & ~mask ) | ( value & mask ) ) );
+}
+
+/**
+ * @brief Stage a new value for a shadowed register without touching the bus. Staged registers are written by I2C_devFlush( ).
+ * 
+ * @param dev Device
+ * @param reg Register Address ( must be shadowed )
+ * @param value New Register Value
+ * @return I2C_devStatus_t I2C_DEV_OK, or I2C_DEV_ERROR if the register is not shadowed
+ */
+I2C_devStatus_t I2C_devSetReg( I2C_dev_t *dev, uint8_t reg, uint8_t value )
+{
+    uint32_t bit;
+
+    if( !I2C_DEV_IN_SHADOW( dev, reg ) )
+    {
+        return I2C_DEV_ERROR;
+    }
+
+    bit = I2C_DEV_BIT( dev, reg );
+
+    if( ( dev->validMask & bit ) && !( dev->dirtyMask & bit ) && ( dev->shadow[ I2C_DEV_IDX( dev, reg ) ] == value ) )
+    {
+        dev->stats.writesSkipped++;
+        return I2C_DEV_OK;
+    }
+
+    dev->shadow[ I2C_DEV_IDX( dev, reg ) ] = value;
+    dev->validMask |= bit;
+    dev->dirtyMask |= bit;
+
+    return I2C_DEV_OK;
+}
+
+/**
+ * @brief Write all staged registers. Runs of adjacent staged registers are written in a single burst if the device auto-increments.
+ * 
+ * @param dev Device
+ * @return I2C_devStatus_t Bus Status of the first failing write, I2C_DEV_OK otherwise
+ */
+I2C_devStatus_t I2C_devFlush( I2C_dev_t *dev )
+{
+    I2C_devStatus_t ret;
+    uint8_t first, len;
+    uint32_t runMask;
+
+    first = 0;
+    while( ( dev->dirtyMask != 0 ) && ( first < dev->shadowCount ) )
+    {
+        if( !( dev->dirtyMask & ( 1UL << first ) ) )
+        {
+            first++;
+            continue;
+        }
+
+        /*Extend the run over adjacent dirty registers*/
+        len = 1;
+        if( dev->autoIncrement )
+        {
+            while( ( ( first + len ) < dev->shadowCount ) && ( len < I2C_DEV_BURST_MAX ) && ( dev->dirtyMask & ( 1UL << ( first + len ) ) ) )
+            {
+                len++;
+            }
+        }
+
+        ret = I2C_devBusWrite( dev, dev->shadowFirst + first, &dev->shadow[ first ], len );
+        if( ret != I2C_DEV_OK )
+        {
+            return ret;
+        }
+
+        runMask = ( len >= 32 ) ? 0xFFFFFFFFUL : ( ( ( 1UL << len ) - 1UL ) << first );
+        dev->dirtyMask &= ~runMask;
+        dev->stats.writesCoalesced += len - 1;
+
+        first += len;
+    }
+
+    return I2C_DEV_OK;
+}
+
+/**
+ * @brief Read a block of consecutive registers ( e.g. sensor data ) in one burst. Shadowed registers in the block are refreshed.
+ * 
+ * @param dev Device
+ * @param reg First Register Address
+ * @param data Destination
+ * @param len Number of registers
+ * @return I2C_devStatus_t Bus Status
+ */
+I2C_devStatus_t I2C_devReadBurst( I2C_dev_t *dev, uint8_t reg, uint8_t *data, uint16_t len )
+{
+    I2C_devStatus_t ret;
+    uint16_t i;
+
+    if( len == 0 )
+    {
+        return I2C_DEV_OK;
+    }
+
+    if( !dev->autoIncrement )
+    {
+        for( i = 0; i < len; i++ )
+        {
+            ret = I2C_devBusRead( dev, reg + i, &data[ i ], 1 );
+            if( ret != I2C_DEV_OK )
+            {
+                return ret;
+            }
+        }
+    }
+    else
+    {
+        ret = I2C_devBusRead( dev, reg, data, len );
+        if( ret != I2C_DEV_OK )
+        {
+            return ret;
+        }
+    }
+
+    I2C_devRefreshShadow( dev, reg, data, len );
+
+    return I2C_DEV_OK;
+}
+
+/**
+ * @brief Read a list of registers in any order. Shadowed registers are served from the shadow, the others are sorted and 
+ * neighbours ( at most dev->coalesceGap unrequested registers apart, see I2C_devSetCoalesceGap( ) ) are fetched together 
+ * in one burst.
+ * 
+ * @param dev Device
+ * @param regs Register Addresses
+ * @param count Number of registers ( <= I2C_DEV_MULTI_MAX )
+ * @param values Register Values, same order as regs
+ * @return I2C_devStatus_t Bus Status
+ */
+I2C_devStatus_t I2C_devReadMulti( I2C_dev_t *dev, const uint8_t *regs, uint8_t count, uint8_t *values )
+{
+    uint8_t order[ I2C_DEV_MULTI_MAX ];
+    uint8_t burst[ I2C_DEV_BURST_MAX ];
+    I2C_devStatus_t ret;
+    uint8_t pending = 0;
+    uint8_t i, j, tmp, runStart, runEnd, runFirst;
+
+    if( count > I2C_DEV_MULTI_MAX )
+    {
+        return I2C_DEV_ERROR;
+    }
+
+    /*1. Serve from the shadow, collect the rest*/
+    for( i = 0; i < count; i++ )
+    {
+        if( I2C_DEV_IN_SHADOW( dev, regs[ i ] ) && ( dev->validMask & I2C_DEV_BIT( dev, regs[ i ] ) ) )
+        {
+            values[ i ] = dev->shadow[ I2C_DEV_IDX( dev, regs[ i ] ) ];
+            dev->stats.cacheHits++;
+        }
+        else
+        {
+            order[ pending++ ] = i;
+        }
+    }
+
+    /*2. Sort the remaining requests by register address ( insertion sort, pending is small )*/
+    for( i = 1; i < pending; i++ )
+    {
+        tmp = order[ i ];
+        for( j = i; ( j > 0 ) && ( regs[ order[ j - 1 ] ] > regs[ tmp ] ); j-- )
+        {
+            order[ j ] = order[ j - 1 ];
+        }
+        order[ j ] = tmp;
+    }
+
+    /*3. Fetch runs of close registers in single bursts*/
+    i = 0;
+    while( i < pending )
+    {
+        runFirst    = i;
+        runStart    = regs[ order[ i ] ];
+        runEnd      = runStart;
+
+        if( dev->autoIncrement )
+        {
+            while( ( ( i + 1 ) < pending ) &&
+                   ( ( regs[ order[ i + 1 ] ] - runEnd ) <= ( dev->coalesceGap + 1 ) ) &&
+                   ( ( regs[ order[ i + 1 ] ] - runStart ) < I2C_DEV_BURST_MAX ) )
+            {
+                i++;
+                runEnd = regs[ order[ i ] ];
+            }
+        }
+
+        ret = I2C_devBusRead( dev, runStart, burst, ( uint16_t )( runEnd - runStart + 1 ) );
+        if( ret != I2C_DEV_OK )
+        {
+            return ret;
+        }
+        I2C_devRefreshShadow( dev, runStart, burst, ( uint16_t )( runEnd - runStart + 1 ) );
+
+        for( j = runFirst; j <= i; j++ )
+        {
+            values[ order[ j ] ] = burst[ regs[ order[ j ] ] - runStart ];
+        }
+        dev->stats.readsCoalesced += i - runFirst;
+
+        i++;
+    }
+
+    return I2C_DEV_OK;
+}
+
+/**
+ * @brief Number of bus transactions avoided by the shadow, skipped writes and burst coalescing
+ * 
+ * @param dev Device
+ * @return uint32_t Transactions saved
+ */
+uint32_t I2C_devTransactionsSaved( const I2C_dev_t *dev )
+{
+    return dev->stats.cacheHits + dev->stats.writesSkipped + dev->stats.readsCoalesced + dev->stats.writesCoalesced;
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Issue a register read on the bus and count it
+ * 
+ */
+static I2C_devStatus_t I2C_devBusRead( I2C_dev_t *dev, uint8_t reg, uint8_t *data, uint16_t len )
+{
+    I2C_devStatus_t ret = dev->bus->readRegs( dev->bus->busCtx, dev->devAddr, reg, data, len );
+
+    dev->stats.busReads++;
+    if( ret != I2C_DEV_OK )
+    {
+        dev->stats.busErrors++;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Issue a register write on the bus and count it
+ * 
+ */
+static I2C_devStatus_t I2C_devBusWrite( I2C_dev_t *dev, uint8_t reg, const uint8_t *data, uint16_t len )
+{
+    I2C_devStatus_t ret = dev->bus->writeRegs( dev->bus->busCtx, dev->devAddr, reg, data, len );
+
+    dev->stats.busWrites++;
+    if( ret != I2C_DEV_OK )
+    {
+        dev->stats.busErrors++;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Copy freshly read register values into the shadow. Staged ( dirty ) registers keep their pending value.
+ * 
+ * @param dev Device
+ * @param reg First Register Address of data
+ * @param data Values read from the device
+ * @param len Number of registers
+ */
+static void I2C_devRefreshShadow( I2C_dev_t *dev, uint8_t reg, const uint8_t *data, uint16_t len )
+{
+    uint16_t i;
+    uint16_t r;
+    uint32_t bit;
+
+    for( i = 0; i < len; i++ )
+    {
+        r = ( uint16_t )reg + i;
+        if( ( r > 0xFF ) || !I2C_DEV_IN_SHADOW( dev, r ) )
+        {
+            continue;
+        }
+
+        bit = I2C_DEV_BIT( dev, r );
+        if( !( dev->dirtyMask & bit ) )
+        {
+            dev->shadow[ I2C_DEV_IDX( dev, r ) ] = data[ i ];
+            dev->validMask |= bit;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+/*
+# ##############################################################################
+# File: i2c_dev.h                                                              #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 1:36:05 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:31:42 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_I2C_DEV_H
+#define INC_I2C_DEV_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+/*Maximum number of shadowed configuration registers per device ( one bit each in validMask / dirtyMask )*/
+#define I2C_DEV_SHADOW_MAX      32
+
+/*Largest single burst issued by the device layer*/
+#define I2C_DEV_BURST_MAX       32
+
+/*Maximum number of registers per I2C_devReadMulti( ) call*/
+#define I2C_DEV_MULTI_MAX       16
+
+/*Largest gap ( unrequested registers ) a register map may opt in to with I2C_devSetCoalesceGap( )*/
+#define I2C_DEV_COALESCE_GAP_MAX    4
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Device layer Status. Same values as HAL_StatusTypeDef, the layer itself does not depend on the HAL.
+ * 
+ */
+typedef enum
+{
+    I2C_DEV_OK = 0,
+    I2C_DEV_ERROR,
+    I2C_DEV_BUSY,
+    I2C_DEV_TIMEOUT
+} I2C_devStatus_t;
+
+/**
+ * @brief Register level Bus Operations used by a device. I2C_devQueueBus ( i2c_queue.h ) drives hi2c1 through the 
+ * transaction queue, a simulated register file can be plugged in instead to exercise the cache logic off target.
+ * 
+ */
+typedef struct
+{
+    I2C_devStatus_t ( *readRegs )( void *busCtx, uint8_t devAddr, uint8_t reg, uint8_t *data, uint16_t len );
+    I2C_devStatus_t ( *writeRegs )( void *busCtx, uint8_t devAddr, uint8_t reg, const uint8_t *data, uint16_t len );
+    void *busCtx;
+} I2C_devBus_t;
+
+/**
+ * @brief Device Statistics. Everything except busReads / busWrites is a bus transaction that did not happen.
+ * 
+ */
+typedef struct
+{
+    uint32_t busReads;          /*Read transactions issued*/
+    uint32_t busWrites;         /*Write transactions issued*/
+    uint32_t cacheHits;         /*Register reads served from the shadow*/
+    uint32_t writesSkipped;     /*Register writes dropped because the shadow already held the value*/
+    uint32_t readsCoalesced;    /*Register reads merged into another burst read*/
+    uint32_t writesCoalesced;   /*Register writes merged into another burst write*/
+    uint32_t busErrors;
+} I2C_devStats_t;
+
+/**
+ * @brief I2C Device with a shadow of its configuration registers [ shadowFirst, shadowFirst + shadowCount )
+ * 
+ */
+typedef struct
+{
+    const I2C_devBus_t  *bus;
+    uint8_t             devAddr;                        /*7 bit Slave Address*/
+    uint8_t             shadowFirst;                    /*First shadowed register*/
+    uint8_t             shadowCount;                    /*Number of shadowed registers*/
+    uint8_t             autoIncrement;                  /*TRUE if the device auto-increments the register address in bursts*/
+    uint8_t             coalesceGap;                    /*Unrequested registers I2C_devReadMulti( ) may read to merge bursts, 0 by default*/
+    uint32_t            validMask;                      /*Bit n: shadow[ n ] holds the device value*/
+    uint32_t            dirtyMask;                      /*Bit n: shadow[ n ] changed locally, not written yet*/
+    uint8_t             shadow[ I2C_DEV_SHADOW_MAX ];
+    I2C_devStats_t      stats;
+} I2C_dev_t;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+I2C_devStatus_t I2C_devInit( I2C_dev_t *dev, const I2C_devBus_t *bus, uint8_t devAddr, uint8_t shadowFirst, uint8_t shadowCount, uint8_t autoIncrement );
+void I2C_devInvalidate( I2C_dev_t *dev );
+I2C_devStatus_t I2C_devSetCoalesceGap( I2C_dev_t *dev, uint8_t gap );
+I2C_devStatus_t I2C_devSync( I2C_dev_t *dev );
+I2C_devStatus_t I2C_devReadReg( I2C_dev_t *dev, uint8_t reg, uint8_t *value );
+I2C_devStatus_t I2C_devWriteReg( I2C_dev_t *dev, uint8_t reg, uint8_t value );
+I2C_devStatus_t I2C_devUpdateBits( I2C_dev_t *dev, uint8_t reg, uint8_t mask, uint8_t value );
+I2C_devStatus_t I2C_devSetReg( I2C_dev_t *dev, uint8_t reg, uint8_t value );
+I2C_devStatus_t I2C_devFlush( I2C_dev_t *dev );
+I2C_devStatus_t I2C_devReadBurst( I2C_dev_t *dev, uint8_t reg, uint8_t *data, uint16_t len );
+I2C_devStatus_t I2C_devReadMulti( I2C_dev_t *dev, const uint8_t *regs, uint8_t count, uint8_t *values );
+uint32_t I2C_devTransactionsSaved( const I2C_dev_t *dev );
+
+#endif
\ No newline at end of file
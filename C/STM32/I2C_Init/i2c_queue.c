@@ -0,0 +1,584 @@
+/*
+# ##############################################################################
+# File: i2c_queue.c                                                            #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 10:21:37 am                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:31:42 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "i2c_queue.h"
+#include "main.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static HAL_StatusTypeDef    I2C_queueLaunch( I2C_xfer_t *xfer );
+static void                 I2C_queueStartNext( void );
+static void                 I2C_queueComplete( I2C_xfer_t *xfer, I2C_xferStatus_t status, uint32_t errorCode );
+static I2C_devStatus_t      I2C_queueDevTransfer( I2C_xfer_t *xfer, uint8_t devAddr, uint8_t *txBuf, uint16_t txLen, uint8_t *rxBuf, uint16_t rxLen );
+static I2C_devStatus_t      I2C_queueDevReadRegs( void *busCtx, uint8_t devAddr, uint8_t reg, uint8_t *data, uint16_t len );
+static I2C_devStatus_t      I2C_queueDevWriteRegs( void *busCtx, uint8_t devAddr, uint8_t reg, const uint8_t *data, uint16_t len );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Ring of pending transactions. Only pointers to the callers descriptors are stored.
+ * 
+ */
+static I2C_xfer_t           *i2cQueue[ I2C_QUEUE_LEN ];
+static volatile uint8_t     i2cQueueHead    = 0;
+static volatile uint8_t     i2cQueueCount   = 0;
+
+/**
+ * @brief Transaction currently on the bus ( NULL when the bus is idle )
+ * 
+ */
+static I2C_xfer_t * volatile    i2cActiveXfer       = NULL;
+static volatile uint8_t         i2cActiveRxPhase    = FALSE;
+static volatile uint32_t        i2cActiveTick       = 0;
+
+static I2C_queueStats_t i2cQueueStats;
+
+/**
+ * @brief Register level Bus Operations for the I2C Device layer. Register accesses are queued behind the other 
+ * transactions instead of grabbing hi2c1 with the blocking HAL_I2C_Mem_xxx( ) calls.
+ * 
+ */
+const I2C_devBus_t I2C_devQueueBus = { I2C_queueDevReadRegs, I2C_queueDevWriteRegs, NULL };
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#define I2C_QUEUE_MASK          ( I2C_QUEUE_LEN - 1 )
+
+#if ( I2C_QUEUE_LEN & I2C_QUEUE_MASK ) != 0
+#error "I2C_QUEUE_LEN must be a power of 2"
+#endif
+
+/*Critical Section, nestable ( same pattern as ble_list.c )*/
+#define I2C_QUEUE_ENTER_CRITICAL( )     uint32_t uwPRIMASK_Bit = __get_PRIMASK( ); __disable_irq( )
+#define I2C_QUEUE_EXIT_CRITICAL( )      __set_PRIMASK( uwPRIMASK_Bit )
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Initialize the Transaction Queue. Call after I2C_init( ).
+ * 
+ */
+void I2C_queueInit( void )
+{
+    i2cQueueHead        = 0;
+    i2cQueueCount       = 0;
+    i2cActiveXfer       = NULL;
+    i2cActiveRxPhase    = FALSE;
+    memset( &i2cQueueStats, 0, sizeof( i2cQueueStats ) );
+
+    I2C_cycleCounterInit( );
+}
+
+/**
+ * @brief Queue a filled Transaction Descriptor. Returns immediately, the transaction is put on the bus as soon as the 
+ * transactions queued before it have completed. Safe to call from Interrupt Context ( e.g. from a doneCB ).
+ * 
+ * @param xfer Transaction Descriptor, must stay valid until completion
+ * @return HAL_StatusTypeDef HAL_OK if queued, HAL_BUSY if the queue is full or xfer is already queued, HAL_ERROR on invalid parameters
+ */
+HAL_StatusTypeDef I2C_queueSubmit( I2C_xfer_t *xfer )
+{
+    uint8_t kick;
+
+    if( ( xfer == NULL ) || ( xfer->devAddr > 0x7F ) )
+    {
+        return HAL_ERROR;
+    }
+
+    if( ( ( xfer->type != I2C_XFER_READ ) && ( ( xfer->txBuf == NULL ) || ( xfer->txLen == 0 ) ) ) ||
+        ( ( xfer->type != I2C_XFER_WRITE ) && ( ( xfer->rxBuf == NULL ) || ( xfer->rxLen == 0 ) ) ) )
+    {
+        return HAL_ERROR;
+    }
+
+    I2C_QUEUE_ENTER_CRITICAL( );
+
+    if( ( i2cQueueCount >= I2C_QUEUE_LEN ) || ( xfer->status == I2C_XFER_QUEUED ) || ( xfer->status == I2C_XFER_ACTIVE ) )
+    {
+        i2cQueueStats.rejected++;
+        I2C_QUEUE_EXIT_CRITICAL( );
+        return HAL_BUSY;
+    }
+
+    xfer->status        = I2C_XFER_QUEUED;
+    xfer->errorCode     = HAL_I2C_ERROR_NONE;
+    xfer->queuedCycles  = DWT->CYCCNT;
+    xfer->waitUs        = 0;
+    xfer->busUs         = 0;
+
+    i2cQueue[ ( i2cQueueHead + i2cQueueCount ) & I2C_QUEUE_MASK ] = xfer;
+    i2cQueueCount++;
+
+    if( i2cQueueCount > i2cQueueStats.maxDepth )
+    {
+        i2cQueueStats.maxDepth = i2cQueueCount;
+    }
+
+    kick = ( i2cActiveXfer == NULL );
+
+    I2C_QUEUE_EXIT_CRITICAL( );
+
+    if( kick )
+    {
+        I2C_queueStartNext( );
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Fill and queue a Write Transaction
+ * 
+ * @param xfer Transaction Descriptor
+ * @param devAddr 7 bit Slave Address
+ * @param txBuf Data to be written
+ * @param txLen Number of bytes to be written
+ * @param doneCB Completion CallBack ( may be NULL )
+ * @return HAL_StatusTypeDef See I2C_queueSubmit( )
+ */
+HAL_StatusTypeDef I2C_queueWrite( I2C_xfer_t *xfer, uint8_t devAddr, uint8_t *txBuf, uint16_t txLen, I2C_xferCB_t doneCB )
+{
+    return I2C_queueWriteRead( xfer, devAddr, txBuf, txLen, NULL, 0, doneCB );
+}
+
+/**
+ * @brief Fill and queue a Read Transaction
+ * 
+ * @param xfer Transaction Descriptor
+ * @param devAddr 7 bit Slave Address
+ * @param rxBuf Destination of the read data
+ * @param rxLen Number of bytes to be read
+ * @param doneCB Completion CallBack ( may be NULL )
+ * @return HAL_StatusTypeDef See I2C_queueSubmit( )
+ */
+HAL_StatusTypeDef I2C_queueRead( I2C_xfer_t *xfer, uint8_t devAddr, uint8_t *rxBuf, uint16_t rxLen, I2C_xferCB_t doneCB )
+{
+    return I2C_queueWriteRead( xfer, devAddr, NULL, 0, rxBuf, rxLen, doneCB );
+}
+
+/**
+ * @brief Fill and queue a Transaction. The type is derived from the lengths: Write only, Read only or Write then Read 
+ * with a Repeated START in between ( e.g. Register Address followed by the Register Content ).
+ * 
+ * @param xfer Transaction Descriptor
+ * @param devAddr 7 bit Slave Address
+ * @param txBuf Data to be written ( NULL / 0 for a Read only )
+ * @param txLen Number of bytes to be written
+ * @param rxBuf Destination of the read data ( NULL / 0 for a Write only )
+ * @param rxLen Number of bytes to be read
+ * @param doneCB Completion CallBack ( may be NULL )
+ * @return HAL_StatusTypeDef See I2C_queueSubmit( )
+ */
+HAL_StatusTypeDef I2C_queueWriteRead( I2C_xfer_t *xfer, uint8_t devAddr, uint8_t *txBuf, uint16_t txLen, uint8_t *rxBuf, uint16_t rxLen, I2C_xferCB_t doneCB )
+{
+    if( xfer == NULL )
+    {
+        return HAL_ERROR;
+    }
+
+    if( txLen == 0 )
+    {
+        xfer->type = I2C_XFER_READ;
+    }
+    else if( rxLen == 0 )
+    {
+        xfer->type = I2C_XFER_WRITE;
+    }
+    else
+    {
+        xfer->type = I2C_XFER_WRITE_READ;
+    }
+
+    xfer->devAddr   = devAddr;
+    xfer->txBuf     = txBuf;
+    xfer->txLen     = txLen;
+    xfer->rxBuf     = rxBuf;
+    xfer->rxLen     = rxLen;
+    xfer->doneCB    = doneCB;
+
+    return I2C_queueSubmit( xfer );
+}
+
+/**
+ * @brief Check if the bus is idle and no transaction is pending
+ * 
+ * @return uint8_t TRUE if idle, FALSE otherwise
+ */
+uint8_t I2C_queueIsIdle( void )
+{
+    return ( ( i2cActiveXfer == NULL ) && ( i2cQueueCount == 0 ) );
+}
+
+/**
+ * @brief Fail the active transaction if it did not complete within I2C_QUEUE_XFER_TIMEOUT_MS ( e.g. a Slave holding SCL ).
+ * The peripheral is re-initialized and the next queued transaction is started. Call periodically from the main loop.
+ * 
+ */
+void I2C_queueCheckTimeout( void )
+{
+    I2C_xfer_t *xfer;
+
+    I2C_QUEUE_ENTER_CRITICAL( );
+
+    xfer = i2cActiveXfer;
+    if( ( xfer == NULL ) || ( ( HAL_GetTick( ) - i2cActiveTick ) <= I2C_QUEUE_XFER_TIMEOUT_MS ) )
+    {
+        I2C_QUEUE_EXIT_CRITICAL( );
+        return;
+    }
+
+    /*Detach the transfer so that a late completion Interrupt is ignored*/
+    i2cActiveXfer = NULL;
+
+    I2C_QUEUE_EXIT_CRITICAL( );
+
+    HAL_I2C_DeInit( &hi2c1 );
+    if( HAL_I2C_Init( &hi2c1 ) != HAL_OK )
+    {
+        Error_Handler( );
+    }
+
+    I2C_queueComplete( xfer, I2C_XFER_TIMEOUT, HAL_I2C_ERROR_TIMEOUT );
+}
+
+/**
+ * @brief Get a copy of the Queue Statistics
+ * 
+ * @param stats Destination
+ */
+void I2C_queueGetStats( I2C_queueStats_t *stats )
+{
+    I2C_QUEUE_ENTER_CRITICAL( );
+    *stats = i2cQueueStats;
+    I2C_QUEUE_EXIT_CRITICAL( );
+}
+
+/**
+ * @brief Reset the Queue Statistics
+ * 
+ */
+void I2C_queueResetStats( void )
+{
+    I2C_QUEUE_ENTER_CRITICAL( );
+    memset( &i2cQueueStats, 0, sizeof( i2cQueueStats ) );
+    I2C_QUEUE_EXIT_CRITICAL( );
+}
+
+/*HAL CallBacks---------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Master Transmit Complete. Either the end of a Write, or the end of the Write phase of a Write then Read.
+ * 
+ * @param hi2c I2C Handle
+ */
+void HAL_I2C_MasterTxCpltCallback( I2C_HandleTypeDef *hi2c )
+{
+    I2C_xfer_t *xfer = i2cActiveXfer;
+
+    if( ( hi2c->Instance != I2C1 ) || ( xfer == NULL ) )
+    {
+        return;
+    }
+
+    if( ( xfer->type == I2C_XFER_WRITE_READ ) && ( i2cActiveRxPhase == FALSE ) )
+    {
+        /*Repeated START and Read phase*/
+        i2cActiveRxPhase = TRUE;
+        if( I2C_queueLaunch( xfer ) != HAL_OK )
+        {
+            i2cActiveXfer = NULL;
+            I2C_queueComplete( xfer, I2C_XFER_ERROR, HAL_I2C_GetError( hi2c ) );
+        }
+        return;
+    }
+
+    i2cActiveXfer = NULL;
+    I2C_queueComplete( xfer, I2C_XFER_DONE, HAL_I2C_ERROR_NONE );
+}
+
+/**
+ * @brief Master Receive Complete. End of a Read or of a Write then Read.
+ * 
+ * @param hi2c I2C Handle
+ */
+void HAL_I2C_MasterRxCpltCallback( I2C_HandleTypeDef *hi2c )
+{
+    I2C_xfer_t *xfer = i2cActiveXfer;
+
+    if( ( hi2c->Instance != I2C1 ) || ( xfer == NULL ) )
+    {
+        return;
+    }
+
+    i2cActiveXfer = NULL;
+    I2C_queueComplete( xfer, I2C_XFER_DONE, HAL_I2C_ERROR_NONE );
+}
+
+/**
+ * @brief Transfer Error ( NACK, Bus Error, Arbitration Lost, DMA Error )
+ * 
+ * @param hi2c I2C Handle
+ */
+void HAL_I2C_ErrorCallback( I2C_HandleTypeDef *hi2c )
+{
+    I2C_xfer_t *xfer = i2cActiveXfer;
+
+    if( ( hi2c->Instance != I2C1 ) || ( xfer == NULL ) )
+    {
+        return;
+    }
+
+    i2cActiveXfer = NULL;
+    I2C_queueComplete( xfer, I2C_XFER_ERROR, HAL_I2C_GetError( hi2c ) );
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Put the current phase of a transaction on the bus, using DMA for long transfers
+ * 
+ * @param xfer Active Transaction
+ * @return HAL_StatusTypeDef HAL Status of the IT / DMA start
+ */
+static HAL_StatusTypeDef I2C_queueLaunch( I2C_xfer_t *xfer )
+{
+    uint16_t addr = ( uint16_t )xfer->devAddr << 1;
+
+    switch( xfer->type )
+    {
+        case I2C_XFER_WRITE:
+#if I2C_USE_DMA
+            if( xfer->txLen >= I2C_QUEUE_DMA_THRESHOLD )
+            {
+                return HAL_I2C_Master_Transmit_DMA( &hi2c1, addr, xfer->txBuf, xfer->txLen );
+            }
+#endif
+            return HAL_I2C_Master_Transmit_IT( &hi2c1, addr, xfer->txBuf, xfer->txLen );
+
+        case I2C_XFER_READ:
+#if I2C_USE_DMA
+            if( xfer->rxLen >= I2C_QUEUE_DMA_THRESHOLD )
+            {
+                return HAL_I2C_Master_Receive_DMA( &hi2c1, addr, xfer->rxBuf, xfer->rxLen );
+            }
+#endif
+            return HAL_I2C_Master_Receive_IT( &hi2c1, addr, xfer->rxBuf, xfer->rxLen );
+
+        case I2C_XFER_WRITE_READ:
+            if( i2cActiveRxPhase == FALSE )
+            {
+                /*No STOP at the end of the Write phase*/
+                return HAL_I2C_Master_Seq_Transmit_IT( &hi2c1, addr, xfer->txBuf, xfer->txLen, I2C_FIRST_FRAME );
+            }
+#if I2C_USE_DMA
+            if( xfer->rxLen >= I2C_QUEUE_DMA_THRESHOLD )
+            {
+                return HAL_I2C_Master_Seq_Receive_DMA( &hi2c1, addr, xfer->rxBuf, xfer->rxLen, I2C_LAST_FRAME );
+            }
+#endif
+            return HAL_I2C_Master_Seq_Receive_IT( &hi2c1, addr, xfer->rxBuf, xfer->rxLen, I2C_LAST_FRAME );
+
+        default:
+            return HAL_ERROR;
+    }
+}
+
+/**
+ * @brief Pop the next queued transaction and put it on the bus. Transactions which fail to start are completed with an 
+ * error and the next one is tried.
+ * 
+ */
+static void I2C_queueStartNext( void )
+{
+    I2C_xfer_t *xfer;
+    uint32_t now;
+
+    while( 1 )
+    {
+        I2C_QUEUE_ENTER_CRITICAL( );
+
+        if( ( i2cActiveXfer != NULL ) || ( i2cQueueCount == 0 ) )
+        {
+            I2C_QUEUE_EXIT_CRITICAL( );
+            return;
+        }
+
+        xfer = i2cQueue[ i2cQueueHead ];
+        i2cQueueHead = ( i2cQueueHead + 1 ) & I2C_QUEUE_MASK;
+        i2cQueueCount--;
+
+        now                 = DWT->CYCCNT;
+        xfer->status        = I2C_XFER_ACTIVE;
+        xfer->startCycles   = now;
+        xfer->waitUs        = I2C_cyclesToUs( now - xfer->queuedCycles );
+        i2cActiveRxPhase    = FALSE;
+        i2cActiveTick       = HAL_GetTick( );
+        i2cActiveXfer       = xfer;
+
+        I2C_QUEUE_EXIT_CRITICAL( );
+
+        if( I2C_queueLaunch( xfer ) == HAL_OK )
+        {
+            return;
+        }
+
+        /*Could not start ( peripheral busy / in error ), fail this one and try the next*/
+        i2cActiveXfer = NULL;
+        I2C_queueComplete( xfer, I2C_XFER_ERROR, HAL_I2C_GetError( &hi2c1 ) );
+    }
+}
+
+/**
+ * @brief Finish a transaction: record timing and statistics, notify the owner and start the next one back-to-back.
+ * The transaction must already be detached from i2cActiveXfer.
+ * 
+ * @param xfer Finished Transaction
+ * @param status Final Status
+ * @param errorCode HAL_I2C_ERROR_xxx
+ */
+static void I2C_queueComplete( I2C_xfer_t *xfer, I2C_xferStatus_t status, uint32_t errorCode )
+{
+    xfer->busUs     = I2C_cyclesToUs( DWT->CYCCNT - xfer->startCycles );
+    xfer->errorCode = errorCode;
+
+    I2C_QUEUE_ENTER_CRITICAL( );
+    if( status == I2C_XFER_DONE )
+    {
+        i2cQueueStats.completed++;
+        i2cQueueStats.bytes += ( ( xfer->type != I2C_XFER_READ ) ? xfer->txLen : 0 ) + ( ( xfer->type != I2C_XFER_WRITE ) ? xfer->rxLen : 0 );
+    }
+    else if( status == I2C_XFER_TIMEOUT )
+    {
+        i2cQueueStats.timeouts++;
+    }
+    else
+    {
+        i2cQueueStats.errors++;
+    }
+    if( xfer->busUs > i2cQueueStats.maxBusUs )
+    {
+        i2cQueueStats.maxBusUs = xfer->busUs;
+    }
+    if( xfer->waitUs > i2cQueueStats.maxWaitUs )
+    {
+        i2cQueueStats.maxWaitUs = xfer->waitUs;
+    }
+    I2C_QUEUE_EXIT_CRITICAL( );
+
+    xfer->status = status;
+
+    if( xfer->doneCB != NULL )
+    {
+        xfer->doneCB( xfer );
+    }
+
+    I2C_queueStartNext( );
+}
+
+/*I2C Device layer Bus Glue---------------------------------------------------------------------------------*/
+
+/**
+ * @brief Queue a register access and wait for its completion. Called from the main loop only: the wait relies on the 
+ * I2C Interrupts, and on I2C_queueCheckTimeout( ) to fail a stuck transaction.
+ * 
+ * @param xfer Transaction Descriptor on the callers stack, valid until the transaction has completed
+ * @return I2C_devStatus_t I2C_DEV_OK, I2C_DEV_TIMEOUT or I2C_DEV_ERROR
+ */
+static I2C_devStatus_t I2C_queueDevTransfer( I2C_xfer_t *xfer, uint8_t devAddr, uint8_t *txBuf, uint16_t txLen, uint8_t *rxBuf, uint16_t rxLen )
+{
+    HAL_StatusTypeDef ret;
+
+    /*Queue full: wait for a slot, every active transaction ends or times out*/
+    while( ( ret = I2C_queueWriteRead( xfer, devAddr, txBuf, txLen, rxBuf, rxLen, NULL ) ) == HAL_BUSY )
+    {
+        I2C_queueCheckTimeout( );
+    }
+
+    if( ret != HAL_OK )
+    {
+        return I2C_DEV_ERROR;
+    }
+
+    while( ( xfer->status == I2C_XFER_QUEUED ) || ( xfer->status == I2C_XFER_ACTIVE ) )
+    {
+        I2C_queueCheckTimeout( );
+    }
+
+    if( xfer->status == I2C_XFER_DONE )
+    {
+        return I2C_DEV_OK;
+    }
+
+    return ( xfer->status == I2C_XFER_TIMEOUT ) ? I2C_DEV_TIMEOUT : I2C_DEV_ERROR;
+}
+
+/**
+ * @brief I2C Device layer Bus Operation: Register Address write, Repeated START, burst read
+ * 
+ */
+static I2C_devStatus_t I2C_queueDevReadRegs( void *busCtx, uint8_t devAddr, uint8_t reg, uint8_t *data, uint16_t len )
+{
+    I2C_xfer_t xfer = { 0 };
+
+    ( void )busCtx;
+
+    return I2C_queueDevTransfer( &xfer, devAddr, &reg, 1, data, len );
+}
+
+/**
+ * @brief I2C Device layer Bus Operation: Register Address followed by the burst data in a single write
+ * 
+ */
+static I2C_devStatus_t I2C_queueDevWriteRegs( void *busCtx, uint8_t devAddr, uint8_t reg, const uint8_t *data, uint16_t len )
+{
+    I2C_xfer_t xfer = { 0 };
+    uint8_t txBuf[ 1 + I2C_DEV_BURST_MAX ];
+
+    ( void )busCtx;
+
+    if( ( len == 0 ) || ( len > I2C_DEV_BURST_MAX ) )
+    {
+        return I2C_DEV_ERROR;
+    }
+
+    txBuf[ 0 ] = reg;
+    memcpy( &txBuf[ 1 ], data, len );
+
+    return I2C_queueDevTransfer( &xfer, devAddr, txBuf, ( uint16_t )( len + 1 ), NULL, 0 );
+}
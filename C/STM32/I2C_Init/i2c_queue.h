@@ -0,0 +1,162 @@
+/*
+# ##############################################################################
+# File: i2c_queue.h                                                            #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 10:21:37 am                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:31:42 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_I2C_QUEUE_H
+#define INC_I2C_QUEUE_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "main.h"
+#include "i2c.h"
+#include "i2c_dev.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Transaction Type
+ * 
+ */
+typedef enum
+{
+    I2C_XFER_WRITE = 0,     /*START | ADDR+W | txBuf | STOP*/
+    I2C_XFER_READ,          /*START | ADDR+R | rxBuf | STOP*/
+    I2C_XFER_WRITE_READ     /*START | ADDR+W | txBuf | RESTART | ADDR+R | rxBuf | STOP ( e.g. Register Read )*/
+} I2C_xferType_t;
+
+/**
+ * @brief Transaction Status
+ * 
+ */
+typedef enum
+{
+    I2C_XFER_IDLE = 0,      /*Not queued*/
+    I2C_XFER_QUEUED,        /*Waiting for the bus*/
+    I2C_XFER_ACTIVE,        /*On the bus*/
+    I2C_XFER_DONE,          /*Completed successfully*/
+    I2C_XFER_ERROR,         /*NACK / Bus Error / Arbitration Lost, see errorCode*/
+    I2C_XFER_TIMEOUT        /*No completion within I2C_QUEUE_XFER_TIMEOUT_MS, peripheral was re-initialized*/
+} I2C_xferStatus_t;
+
+typedef struct I2C_xfer_s I2C_xfer_t;
+
+/**
+ * @brief Completion CallBack. Called from Interrupt Context, keep it short ( set a flag, queue the next transaction )
+ * 
+ */
+typedef void ( *I2C_xferCB_t )( I2C_xfer_t *xfer );
+
+/**
+ * @brief Transaction Descriptor. Owned by the caller and must stay valid ( not on a returning stack frame ) until doneCB 
+ * has been called or status is no longer QUEUED / ACTIVE.
+ * 
+ */
+struct I2C_xfer_s
+{
+    /*Filled by the caller*/
+    I2C_xferType_t              type;
+    uint8_t                     devAddr;        /*7 bit Slave Address*/
+    uint8_t                     *txBuf;
+    uint16_t                    txLen;
+    uint8_t                     *rxBuf;
+    uint16_t                    rxLen;
+    I2C_xferCB_t                doneCB;         /*Optional*/
+    void                        *userCtx;       /*Free for the caller ( e.g. Sensor Driver Instance )*/
+
+    /*Filled by the queue*/
+    volatile I2C_xferStatus_t   status;
+    uint32_t                    errorCode;      /*HAL_I2C_ERROR_xxx*/
+    uint32_t                    queuedCycles;   /*DWT timestamp when queued*/
+    uint32_t                    startCycles;    /*DWT timestamp when put on the bus*/
+    uint32_t                    waitUs;         /*Time spent waiting for the bus*/
+    uint32_t                    busUs;          /*Time spent on the bus*/
+};
+
+/**
+ * @brief Queue Statistics
+ * 
+ */
+typedef struct
+{
+    uint32_t completed;
+    uint32_t errors;
+    uint32_t timeouts;
+    uint32_t rejected;      /*Queue full*/
+    uint32_t bytes;
+    uint32_t maxBusUs;
+    uint32_t maxWaitUs;
+    uint8_t  maxDepth;
+} I2C_queueStats_t;
+
+void I2C_queueInit( void );
+HAL_StatusTypeDef I2C_queueSubmit( I2C_xfer_t *xfer );
+HAL_StatusTypeDef I2C_queueWrite( I2C_xfer_t *xfer, uint8_t devAddr, uint8_t *txBuf, uint16_t txLen, I2C_xferCB_t doneCB );
+HAL_StatusTypeDef I2C_queueRead( I2C_xfer_t *xfer, uint8_t devAddr, uint8_t *rxBuf, uint16_t rxLen, I2C_xferCB_t doneCB );
+HAL_StatusTypeDef I2C_queueWriteRead( I2C_xfer_t *xfer, uint8_t devAddr, uint8_t *txBuf, uint16_t txLen, uint8_t *rxBuf, uint16_t rxLen, I2C_xferCB_t doneCB );
+uint8_t I2C_queueIsIdle( void );
+void I2C_queueCheckTimeout( void );
+void I2C_queueGetStats( I2C_queueStats_t *stats );
+void I2C_queueResetStats( void );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Maximum number of pending transactions ( power of 2 ). Only pointers are queued, the descriptors belong to the callers.
+ * 
+ */
+#ifndef I2C_QUEUE_LEN
+#define I2C_QUEUE_LEN               8
+#endif
+
+/*A transaction not completed within this time is failed with I2C_XFER_TIMEOUT by I2C_queueCheckTimeout( )*/
+#ifndef I2C_QUEUE_XFER_TIMEOUT_MS
+#define I2C_QUEUE_XFER_TIMEOUT_MS   25
+#endif
+
+/*Transfers of at least this many bytes use DMA instead of byte interrupts ( only if I2C_USE_DMA is enabled )*/
+#ifndef I2C_QUEUE_DMA_THRESHOLD
+#define I2C_QUEUE_DMA_THRESHOLD     4
+#endif
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*I2C Device layer Bus Operations on hi2c1 through the queue ( 8 bit register addresses, main loop only )*/
+extern const I2C_devBus_t I2C_devQueueBus;
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#endif
\ No newline at end of file
@@ -5,7 +5,7 @@
 # Created Date: Sunday, October 22nd 2023, 3:11:07 pm                          #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Saturday, October 28th 2023, 7:16:23 pm                       #
+# Last Modified: Sunday, October 18th 2026, 10:21:37 am                        #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -35,6 +35,7 @@
 #include "usart.h"
 #include "gpio.h"
 #include "i2c.h"
+#include "i2c_queue.h"
 #include "app_bluenrg.h"
 
 /* Private includes ----------------------------------------------------------*/
@@ -90,6 +91,7 @@ int main(void)
   MX_GPIO_Init();
   MX_USART2_UART_Init();
   I2C_init( );
+  I2C_queueInit( );
 
   HAL_Delay( 1000 );
   
@@ -108,6 +110,9 @@ int main(void)
     /*2. Process BLE Events*/
     
     blueNRG_process( );
+
+    /*3. Recover the I2C bus if a transaction got stuck*/
+    I2C_queueCheckTimeout( );
     
     // bluenrg_process( );
   }
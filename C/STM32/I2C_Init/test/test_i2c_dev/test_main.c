@@ -0,0 +1,414 @@
+/*
+# ##############################################################################
+# File: test_main.c                                                            #
+# Project: test                                                                #
+# Created Date: Sunday, October 18th 2026, 11:31:42 pm                         #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 11:31:42 pm                        #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Host Test of the I2C Device layer against a simulated register file, no HAL needed. Build and run from I2C_Init/ with Unity:
+  gcc -std=c99 -Wall -I<unity>/src -I. test/test_i2c_dev/test_main.c <unity>/src/unity.c && ./a.out*/
+
+#include <unity.h>
+#include <string.h>
+
+#include "i2c_dev.c"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static I2C_devStatus_t SIM_readRegs( void *busCtx, uint8_t devAddr, uint8_t reg, uint8_t *data, uint16_t len );
+static I2C_devStatus_t SIM_writeRegs( void *busCtx, uint8_t devAddr, uint8_t reg, const uint8_t *data, uint16_t len );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Simulated register file of one auto-incrementing device
+ * 
+ */
+static struct
+{
+    uint8_t         regs[ 256 ];
+    uint8_t         readCount[ 256 ];   /*Per register, every burst counts*/
+    uint32_t        reads;              /*Read transactions*/
+    uint32_t        writes;             /*Write transactions*/
+    uint8_t         lastDevAddr;
+    I2C_devStatus_t fail;               /*Returned by every transaction when not I2C_DEV_OK*/
+} sim;
+
+static const I2C_devBus_t simBus = { SIM_readRegs, SIM_writeRegs, &sim };
+
+static I2C_dev_t dev;
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#define SIM_ADDR            0x1E
+
+/*Shadowed configuration registers*/
+#define SIM_CFG_FIRST       0x20
+#define SIM_CFG_COUNT       8
+
+/*Data registers, not shadowed. SIM_STATUS is cleared when read*/
+#define SIM_DATA            0x10
+#define SIM_STATUS          0x12
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Simulated Bus---------------------------------------------------------------------------------------------*/
+
+static I2C_devStatus_t SIM_readRegs( void *busCtx, uint8_t devAddr, uint8_t reg, uint8_t *data, uint16_t len )
+{
+    uint16_t i;
+    uint8_t r;
+
+    ( void )busCtx;
+    sim.reads++;
+    sim.lastDevAddr = devAddr;
+    if( sim.fail != I2C_DEV_OK )
+    {
+        return sim.fail;
+    }
+
+    for( i = 0; i < len; i++ )
+    {
+        r = ( uint8_t )( reg + i );
+        data[ i ] = sim.regs[ r ];
+        sim.readCount[ r ]++;
+        if( r == SIM_STATUS )
+        {
+            sim.regs[ r ] = 0;
+        }
+    }
+
+    return I2C_DEV_OK;
+}
+
+static I2C_devStatus_t SIM_writeRegs( void *busCtx, uint8_t devAddr, uint8_t reg, const uint8_t *data, uint16_t len )
+{
+    uint16_t i;
+
+    ( void )busCtx;
+    sim.writes++;
+    sim.lastDevAddr = devAddr;
+    if( sim.fail != I2C_DEV_OK )
+    {
+        return sim.fail;
+    }
+
+    for( i = 0; i < len; i++ )
+    {
+        sim.regs[ ( uint8_t )( reg + i ) ] = data[ i ];
+    }
+
+    return I2C_DEV_OK;
+}
+
+void setUp( void )
+{
+    uint16_t i;
+
+    memset( &sim, 0, sizeof( sim ) );
+    for( i = 0; i < 256; i++ )
+    {
+        sim.regs[ i ] = ( uint8_t )( i ^ 0xA5 );
+    }
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devInit( &dev, &simBus, SIM_ADDR, SIM_CFG_FIRST, SIM_CFG_COUNT, TRUE ) );
+}
+
+void tearDown( void )
+{
+}
+
+/*Tests-----------------------------------------------------------------------------------------------------*/
+
+static void test_initRejectsInvalidParameters( void )
+{
+    TEST_ASSERT_EQUAL( I2C_DEV_ERROR, I2C_devInit( &dev, &simBus, 0x80, 0, 1, TRUE ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_ERROR, I2C_devInit( &dev, &simBus, SIM_ADDR, 0, I2C_DEV_SHADOW_MAX + 1, TRUE ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_ERROR, I2C_devInit( &dev, &simBus, SIM_ADDR, 0xF8, 9, TRUE ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_ERROR, I2C_devInit( &dev, NULL, SIM_ADDR, 0, 1, TRUE ) );
+}
+
+static void test_syncLoadsShadowInOneBurst( void )
+{
+    uint8_t value, i;
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSync( &dev ) );
+    TEST_ASSERT_EQUAL( 1, sim.reads );
+    TEST_ASSERT_EQUAL( SIM_ADDR, sim.lastDevAddr );
+
+    for( i = 0; i < SIM_CFG_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadReg( &dev, SIM_CFG_FIRST + i, &value ) );
+        TEST_ASSERT_EQUAL_HEX8( sim.regs[ SIM_CFG_FIRST + i ], value );
+    }
+
+    TEST_ASSERT_EQUAL( 1, sim.reads );
+    TEST_ASSERT_EQUAL( SIM_CFG_COUNT, dev.stats.cacheHits );
+}
+
+static void test_syncWithoutAutoIncrementReadsEachRegister( void )
+{
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devInit( &dev, &simBus, SIM_ADDR, SIM_CFG_FIRST, SIM_CFG_COUNT, FALSE ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSync( &dev ) );
+    TEST_ASSERT_EQUAL( SIM_CFG_COUNT, sim.reads );
+}
+
+static void test_firstReadGoesToBusThenShadow( void )
+{
+    uint8_t value;
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadReg( &dev, SIM_CFG_FIRST + 3, &value ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadReg( &dev, SIM_CFG_FIRST + 3, &value ) );
+    TEST_ASSERT_EQUAL( 1, sim.reads );
+    TEST_ASSERT_EQUAL( 1, dev.stats.cacheHits );
+
+    /*Data registers are never cached*/
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadReg( &dev, SIM_DATA, &value ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadReg( &dev, SIM_DATA, &value ) );
+    TEST_ASSERT_EQUAL( 3, sim.reads );
+}
+
+static void test_writeOfUnchangedValueIsSkipped( void )
+{
+    uint8_t reg = SIM_CFG_FIRST + 1;
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSync( &dev ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devWriteReg( &dev, reg, sim.regs[ reg ] ) );
+    TEST_ASSERT_EQUAL( 0, sim.writes );
+    TEST_ASSERT_EQUAL( 1, dev.stats.writesSkipped );
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devWriteReg( &dev, reg, 0x42 ) );
+    TEST_ASSERT_EQUAL( 1, sim.writes );
+    TEST_ASSERT_EQUAL_HEX8( 0x42, sim.regs[ reg ] );
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devWriteReg( &dev, reg, 0x42 ) );
+    TEST_ASSERT_EQUAL( 1, sim.writes );
+}
+
+static void test_updateBitsReadsFromShadow( void )
+{
+    uint8_t reg = SIM_CFG_FIRST + 2;
+    uint8_t before;
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSync( &dev ) );
+    before = sim.regs[ reg ];
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devUpdateBits( &dev, reg, 0x0F, 0x05 ) );
+    TEST_ASSERT_EQUAL( 1, sim.reads );
+    TEST_ASSERT_EQUAL( 1, sim.writes );
+    TEST_ASSERT_EQUAL_HEX8( ( before & 0xF0 ) | 0x05, sim.regs[ reg ] );
+
+    /*Same field value again: nothing on the bus*/
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devUpdateBits( &dev, reg, 0x0F, 0x05 ) );
+    TEST_ASSERT_EQUAL( 1, sim.writes );
+}
+
+static void test_flushCoalescesAdjacentStagedRegisters( void )
+{
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSetReg( &dev, SIM_CFG_FIRST + 0, 0x11 ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSetReg( &dev, SIM_CFG_FIRST + 1, 0x22 ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSetReg( &dev, SIM_CFG_FIRST + 2, 0x33 ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSetReg( &dev, SIM_CFG_FIRST + 5, 0x66 ) );
+    TEST_ASSERT_EQUAL( 0, sim.writes );
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devFlush( &dev ) );
+    TEST_ASSERT_EQUAL( 2, sim.writes );
+    TEST_ASSERT_EQUAL( 2, dev.stats.writesCoalesced );
+    TEST_ASSERT_EQUAL( 0, dev.dirtyMask );
+    TEST_ASSERT_EQUAL_HEX8( 0x11, sim.regs[ SIM_CFG_FIRST + 0 ] );
+    TEST_ASSERT_EQUAL_HEX8( 0x22, sim.regs[ SIM_CFG_FIRST + 1 ] );
+    TEST_ASSERT_EQUAL_HEX8( 0x33, sim.regs[ SIM_CFG_FIRST + 2 ] );
+    TEST_ASSERT_EQUAL_HEX8( 0x66, sim.regs[ SIM_CFG_FIRST + 5 ] );
+
+    /*Nothing left to write*/
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devFlush( &dev ) );
+    TEST_ASSERT_EQUAL( 2, sim.writes );
+}
+
+static void test_flushWithoutAutoIncrementWritesEachRegister( void )
+{
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devInit( &dev, &simBus, SIM_ADDR, SIM_CFG_FIRST, SIM_CFG_COUNT, FALSE ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSetReg( &dev, SIM_CFG_FIRST + 0, 0x11 ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSetReg( &dev, SIM_CFG_FIRST + 1, 0x22 ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devFlush( &dev ) );
+    TEST_ASSERT_EQUAL( 2, sim.writes );
+    TEST_ASSERT_EQUAL( 0, dev.stats.writesCoalesced );
+}
+
+static void test_setRegOutsideShadowIsRejected( void )
+{
+    TEST_ASSERT_EQUAL( I2C_DEV_ERROR, I2C_devSetReg( &dev, SIM_DATA, 0x00 ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_ERROR, I2C_devSetReg( &dev, SIM_CFG_FIRST + SIM_CFG_COUNT, 0x00 ) );
+}
+
+static void test_burstReadKeepsStagedValues( void )
+{
+    uint8_t data[ SIM_CFG_COUNT ];
+    uint8_t value;
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSetReg( &dev, SIM_CFG_FIRST + 4, 0x99 ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadBurst( &dev, SIM_CFG_FIRST, data, SIM_CFG_COUNT ) );
+    TEST_ASSERT_EQUAL( 1, sim.reads );
+
+    /*The burst returns the device content, the shadow keeps the pending value*/
+    TEST_ASSERT_EQUAL_HEX8( sim.regs[ SIM_CFG_FIRST + 4 ], data[ 4 ] );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadReg( &dev, SIM_CFG_FIRST + 4, &value ) );
+    TEST_ASSERT_EQUAL_HEX8( 0x99, value );
+    TEST_ASSERT_EQUAL( 0xFF, dev.validMask );
+}
+
+static void test_readMultiDoesNotReadUnrequestedRegistersByDefault( void )
+{
+    const uint8_t regs[] = { SIM_DATA + 3, SIM_DATA + 0, SIM_DATA + 1 };
+    uint8_t values[ 3 ];
+
+    sim.regs[ SIM_STATUS ] = 0x80;
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadMulti( &dev, regs, 3, values ) );
+    TEST_ASSERT_EQUAL( 2, sim.reads );
+    TEST_ASSERT_EQUAL( 1, dev.stats.readsCoalesced );
+    TEST_ASSERT_EQUAL( 0, sim.readCount[ SIM_STATUS ] );
+    TEST_ASSERT_EQUAL_HEX8( 0x80, sim.regs[ SIM_STATUS ] );
+
+    TEST_ASSERT_EQUAL_HEX8( ( SIM_DATA + 3 ) ^ 0xA5, values[ 0 ] );
+    TEST_ASSERT_EQUAL_HEX8( ( SIM_DATA + 0 ) ^ 0xA5, values[ 1 ] );
+    TEST_ASSERT_EQUAL_HEX8( ( SIM_DATA + 1 ) ^ 0xA5, values[ 2 ] );
+}
+
+static void test_readMultiBridgesGapsWhenOptedIn( void )
+{
+    const uint8_t regs[] = { SIM_DATA + 3, SIM_DATA + 0, SIM_DATA + 1, SIM_DATA + 7 };
+    uint8_t values[ 4 ];
+
+    TEST_ASSERT_EQUAL( I2C_DEV_ERROR, I2C_devSetCoalesceGap( &dev, I2C_DEV_COALESCE_GAP_MAX + 1 ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSetCoalesceGap( &dev, 2 ) );
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadMulti( &dev, regs, 4, values ) );
+
+    /*0x10..0x13 in one burst ( gap of 1 ), 0x17 is 3 registers away*/
+    TEST_ASSERT_EQUAL( 2, sim.reads );
+    TEST_ASSERT_EQUAL( 2, dev.stats.readsCoalesced );
+    TEST_ASSERT_EQUAL( 1, sim.readCount[ SIM_STATUS ] );
+    TEST_ASSERT_EQUAL( 0, sim.readCount[ SIM_DATA + 5 ] );
+    TEST_ASSERT_EQUAL_HEX8( ( SIM_DATA + 7 ) ^ 0xA5, values[ 3 ] );
+}
+
+static void test_readMultiServesShadowedRegisters( void )
+{
+    const uint8_t regs[] = { SIM_CFG_FIRST + 1, SIM_DATA, SIM_CFG_FIRST + 6 };
+    uint8_t values[ 3 ];
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSync( &dev ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadMulti( &dev, regs, 3, values ) );
+    TEST_ASSERT_EQUAL( 2, sim.reads );
+    TEST_ASSERT_EQUAL( 2, dev.stats.cacheHits );
+    TEST_ASSERT_EQUAL_HEX8( ( SIM_CFG_FIRST + 6 ) ^ 0xA5, values[ 2 ] );
+
+    TEST_ASSERT_EQUAL( I2C_DEV_ERROR, I2C_devReadMulti( &dev, regs, I2C_DEV_MULTI_MAX + 1, values ) );
+}
+
+static void test_busErrorIsNotCached( void )
+{
+    uint8_t value;
+
+    sim.fail = I2C_DEV_TIMEOUT;
+    TEST_ASSERT_EQUAL( I2C_DEV_TIMEOUT, I2C_devReadReg( &dev, SIM_CFG_FIRST, &value ) );
+    TEST_ASSERT_EQUAL( 0, dev.validMask );
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSetReg( &dev, SIM_CFG_FIRST, 0x5A ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_TIMEOUT, I2C_devFlush( &dev ) );
+    TEST_ASSERT_EQUAL( 1, dev.dirtyMask );
+    TEST_ASSERT_EQUAL( 2, dev.stats.busErrors );
+
+    /*The staged value is written once the bus recovers*/
+    sim.fail = I2C_DEV_OK;
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devFlush( &dev ) );
+    TEST_ASSERT_EQUAL_HEX8( 0x5A, sim.regs[ SIM_CFG_FIRST ] );
+    TEST_ASSERT_EQUAL( 0, dev.dirtyMask );
+}
+
+static void test_invalidateForcesBusRead( void )
+{
+    uint8_t value;
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSync( &dev ) );
+    sim.regs[ SIM_CFG_FIRST ] = 0x00;   /*Device reset behind our back*/
+    I2C_devInvalidate( &dev );
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadReg( &dev, SIM_CFG_FIRST, &value ) );
+    TEST_ASSERT_EQUAL_HEX8( 0x00, value );
+    TEST_ASSERT_EQUAL( 2, sim.reads );
+}
+
+static void test_transactionsSavedSumsAllSavings( void )
+{
+    const uint8_t regs[] = { SIM_DATA, SIM_DATA + 1 };
+    uint8_t values[ 2 ];
+    uint8_t value;
+
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSync( &dev ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadReg( &dev, SIM_CFG_FIRST, &value ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devWriteReg( &dev, SIM_CFG_FIRST, value ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devReadMulti( &dev, regs, 2, values ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSetReg( &dev, SIM_CFG_FIRST + 1, 0x01 ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devSetReg( &dev, SIM_CFG_FIRST + 2, 0x02 ) );
+    TEST_ASSERT_EQUAL( I2C_DEV_OK, I2C_devFlush( &dev ) );
+
+    TEST_ASSERT_EQUAL( 4, I2C_devTransactionsSaved( &dev ) );
+}
+
+int main( void )
+{
+    UNITY_BEGIN( );
+
+    RUN_TEST( test_initRejectsInvalidParameters );
+    RUN_TEST( test_syncLoadsShadowInOneBurst );
+    RUN_TEST( test_syncWithoutAutoIncrementReadsEachRegister );
+    RUN_TEST( test_firstReadGoesToBusThenShadow );
+    RUN_TEST( test_writeOfUnchangedValueIsSkipped );
+    RUN_TEST( test_updateBitsReadsFromShadow );
+    RUN_TEST( test_flushCoalescesAdjacentStagedRegisters );
+    RUN_TEST( test_flushWithoutAutoIncrementWritesEachRegister );
+    RUN_TEST( test_setRegOutsideShadowIsRejected );
+    RUN_TEST( test_burstReadKeepsStagedValues );
+    RUN_TEST( test_readMultiDoesNotReadUnrequestedRegistersByDefault );
+    RUN_TEST( test_readMultiBridgesGapsWhenOptedIn );
+    RUN_TEST( test_readMultiServesShadowedRegisters );
+    RUN_TEST( test_busErrorIsNotCached );
+    RUN_TEST( test_invalidateForcesBusRead );
+    RUN_TEST( test_transactionsSavedSumsAllSavings );
+
+    return UNITY_END( );
+}
\ No newline at end of file
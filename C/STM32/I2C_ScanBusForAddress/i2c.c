@@ -5,7 +5,7 @@
 # Created Date: Saturday, October 28th 2023, 6:18:44 pm                        #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Saturday, October 28th 2023, 6:55:39 pm                       #
+# Last Modified: Sunday, October 18th 2026, 11:24:10 pm                        #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -25,7 +25,13 @@
 /*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
-
+static uint8_t  I2C_scanConfigIsValid( const I2C_scanConfig_t *config );
+static void     I2C_scanStartProbe( void );
+static void     I2C_scanNextProbe( void );
+static void     I2C_scanFinish( void );
+static void     I2C_scanRelease( void );
+static void     I2C_scanEventHandler( void );
+static void     I2C_scanErrorHandler( void );
 
 /*##############################################################################################################################################*/
 /*GLOBALS_______________________________________________________________________________________________________________________________________*/
@@ -37,7 +43,8 @@ I2C_HandleTypeDef hi2c1;
 /*DEFINES_______________________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
-
+/*Upper bound of busy-wait iterations for the hardware to clear the STOP bit between two probes*/
+#define I2C_SCAN_STOP_GUARD     1000U
 
 /*##############################################################################################################################################*/
 /*EXTERNS_______________________________________________________________________________________________________________________________________*/
@@ -49,7 +56,34 @@ I2C_HandleTypeDef hi2c1;
 /*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
+/**
+ * @brief States of the Interrupt driven Bus Scan
+ * 
+ */
+typedef enum
+{
+    I2C_SCAN_STATE_IDLE = 0,    /*No Interrupt driven scan running*/
+    I2C_SCAN_STATE_START,       /*START requested, waiting for SB*/
+    I2C_SCAN_STATE_ADDR         /*Address sent, waiting for ADDR ( ACK ) or AF ( NACK )*/
+} I2C_scanState_t;
+
+/**
+ * @brief Context of the Interrupt driven Bus Scan
+ * 
+ */
+typedef struct
+{
+    volatile I2C_scanState_t    state;
+    I2C_scanResult_t            *result;
+    I2C_scanDoneCB_t            doneCB;
+    uint8_t                     currAddr;
+    uint8_t                     lastAddr;
+    uint32_t                    timeoutMs;
+    volatile uint32_t           probeTick;          /*Restarted by the ISR at every probe*/
+    uint32_t                    startCycles;
+} I2C_scanCtx_t;
 
+static I2C_scanCtx_t i2cScanCtx = { .state = I2C_SCAN_STATE_IDLE };
 
 /*##############################################################################################################################################*/
 /*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
@@ -101,6 +135,12 @@ void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c)
 
         /* Peripheral clock enable */
         __HAL_RCC_I2C1_CLK_ENABLE();
+
+        /* I2C1 interrupts, used by the Interrupt driven Bus Scan. Lower priority than the BlueNRG EXTI line */
+        HAL_NVIC_SetPriority( I2C1_EV_IRQn, 1, 0 );
+        HAL_NVIC_EnableIRQ( I2C1_EV_IRQn );
+        HAL_NVIC_SetPriority( I2C1_ER_IRQn, 1, 0 );
+        HAL_NVIC_EnableIRQ( I2C1_ER_IRQn );
     }
 }
 
@@ -116,6 +156,9 @@ void HAL_I2C_MspDeInit(I2C_HandleTypeDef* hi2c)
   {
     /* Peripheral clock disable */
     __HAL_RCC_I2C1_CLK_DISABLE();
+
+    HAL_NVIC_DisableIRQ( I2C1_EV_IRQn );
+    HAL_NVIC_DisableIRQ( I2C1_ER_IRQn );
   
     /**I2C1 GPIO Configuration    
     PB6     ------> I2C1_SCL
@@ -127,28 +170,416 @@ void HAL_I2C_MspDeInit(I2C_HandleTypeDef* hi2c)
 }
 
 /**
- * @brief This function Scans the I2C bus for connected Slave Devices and reports their Addresses.
+ * @brief I2C1 Event Interrupt Handler. Drives the interrupt based Bus Scan while one is running, otherwise forwards to the HAL.
  * 
  */
-void I2C_scanBus( void )
+void I2C1_EV_IRQHandler( void )
 {
-    printf( "Starting I2C Scanning: \r\n" );
-    uint8_t i = 0, ret;
+    if( i2cScanCtx.state != I2C_SCAN_STATE_IDLE )
+    {
+        I2C_scanEventHandler( );
+    }
+    else
+    {
+        HAL_I2C_EV_IRQHandler( &hi2c1 );
+    }
+}
+
+/**
+ * @brief I2C1 Error Interrupt Handler. Drives the interrupt based Bus Scan while one is running, otherwise forwards to the HAL.
+ * 
+ */
+void I2C1_ER_IRQHandler( void )
+{
+    if( i2cScanCtx.state != I2C_SCAN_STATE_IDLE )
+    {
+        I2C_scanErrorHandler( );
+    }
+    else
+    {
+        HAL_I2C_ER_IRQHandler( &hi2c1 );
+    }
+}
+
+/**
+ * @brief Fill a Scan Configuration with the default Fast Scan Settings ( Whole 7 bit address range, 1 Trial, 1ms Timeout )
+ * 
+ * @param config Scan Configuration to be filled
+ */
+void I2C_scanConfigDefault( I2C_scanConfig_t *config )
+{
+    config->firstAddr   = I2C_SCAN_ADDR_FIRST;
+    config->lastAddr    = I2C_SCAN_ADDR_LAST;
+    config->trials      = I2C_SCAN_FAST_TRIALS;
+    config->timeoutMs   = I2C_SCAN_FAST_TIMEOUT_MS;
+}
+
+/**
+ * @brief Blocking Scan of the I2C bus. Every responding Slave Address is recorded in the presence bitmap of the result, 
+ * nothing is printed. Use I2C_scanReport( ) to print the result afterwards.
+ * 
+ * @param config Scan Configuration ( Address Range, Trials and Timeout per Address ). NULL for the default Fast Scan.
+ * @param result Scan Result ( Presence Bitmap, Device Count and Scan Duration )
+ * @return HAL_StatusTypeDef HAL_OK on completion, HAL_BUSY if the bus is in use, HAL_ERROR on invalid parameters
+ */
+HAL_StatusTypeDef I2C_scanBusBitmap( const I2C_scanConfig_t *config, I2C_scanResult_t *result )
+{
+    I2C_scanConfig_t cfg;
+    uint32_t startCycles;
+    uint8_t addr;
+
+    if( result == NULL )
+    {
+        return HAL_ERROR;
+    }
+
+    if( config == NULL )
+    {
+        I2C_scanConfigDefault( &cfg );
+    }
+    else
+    {
+        cfg = *config;
+    }
+
+    if( I2C_scanConfigIsValid( &cfg ) == FALSE )
+    {
+        return HAL_ERROR;
+    }
+
+    if( i2cScanCtx.state != I2C_SCAN_STATE_IDLE )
+    {
+        return HAL_BUSY;
+    }
 
-    for( i = 1; i < 128; i++ )
+    memset( result, 0, sizeof( *result ) );
+    I2C_cycleCounterInit( );
+    startCycles = DWT->CYCCNT;
+
+    for( addr = cfg.firstAddr; addr <= cfg.lastAddr; addr++ )
     {
-        ret = HAL_I2C_IsDeviceReady( &hi2c1, ( uint16_t )i << 1, 3, 5 );
-        
-        if( ret != HAL_OK )
+        if( HAL_I2C_IsDeviceReady( &hi2c1, ( uint16_t )addr << 1, cfg.trials, cfg.timeoutMs ) == HAL_OK )
         {
-            /*No ACK Received at this Address*/
-            printf( "-" );
+            I2C_BITMAP_SET( result->bitmap, addr );
+            result->devCount++;
         }
-        else if( ret == HAL_OK )
+    }
+
+    result->scanTimeUs = I2C_cyclesToUs( DWT->CYCCNT - startCycles );
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Start an Interrupt driven Scan of the I2C bus. Returns immediately, the CPU is free while the I2C peripheral probes
+ * each address. doneCB is called from Interrupt Context once the last address has been probed, or from I2C_scanIsBusy( ) if a probe timed out.
+ * 
+ * @param config Scan Configuration ( Address Range and Timeout per Address ). NULL for the default Fast Scan. Only one trial is made per address.
+ * @param result Scan Result, must stay valid until the scan has completed
+ * @param doneCB Optional Completion CallBack, may be NULL ( poll I2C_scanIsBusy( ) instead )
+ * @return HAL_StatusTypeDef HAL_OK if the scan was started, HAL_BUSY if the bus is in use, HAL_ERROR on invalid parameters
+ */
+HAL_StatusTypeDef I2C_scanBusIT( const I2C_scanConfig_t *config, I2C_scanResult_t *result, I2C_scanDoneCB_t doneCB )
+{
+    I2C_scanConfig_t cfg;
+
+    if( result == NULL )
+    {
+        return HAL_ERROR;
+    }
+
+    if( config == NULL )
+    {
+        I2C_scanConfigDefault( &cfg );
+    }
+    else
+    {
+        cfg = *config;
+    }
+
+    if( I2C_scanConfigIsValid( &cfg ) == FALSE )
+    {
+        return HAL_ERROR;
+    }
+
+    /*Claim the Handle so that HAL transfers are rejected with HAL_BUSY while the scan owns the peripheral*/
+    __disable_irq( );
+    if( ( i2cScanCtx.state != I2C_SCAN_STATE_IDLE ) || ( hi2c1.State != HAL_I2C_STATE_READY ) )
+    {
+        __enable_irq( );
+        return HAL_BUSY;
+    }
+    hi2c1.State = HAL_I2C_STATE_BUSY;
+    i2cScanCtx.state = I2C_SCAN_STATE_START;
+    __enable_irq( );
+
+    if( __HAL_I2C_GET_FLAG( &hi2c1, I2C_FLAG_BUSY ) != RESET )
+    {
+        /*Bus is held by another Master or a Slave is stuck*/
+        i2cScanCtx.state = I2C_SCAN_STATE_IDLE;
+        hi2c1.State = HAL_I2C_STATE_READY;
+        return HAL_BUSY;
+    }
+
+    memset( result, 0, sizeof( *result ) );
+    i2cScanCtx.result       = result;
+    i2cScanCtx.doneCB       = doneCB;
+    i2cScanCtx.currAddr     = cfg.firstAddr;
+    i2cScanCtx.lastAddr     = cfg.lastAddr;
+    i2cScanCtx.timeoutMs    = cfg.timeoutMs;
+
+    I2C_cycleCounterInit( );
+    i2cScanCtx.startCycles  = DWT->CYCCNT;
+
+    /*Disable POS, enable Event and Error Interrupts ( no Buffer Interrupt, no data is transferred )*/
+    CLEAR_BIT( hi2c1.Instance->CR1, I2C_CR1_POS );
+    SET_BIT( hi2c1.Instance->CR2, I2C_CR2_ITEVTEN | I2C_CR2_ITERREN );
+
+    I2C_scanStartProbe( );
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Check if an Interrupt driven Scan is still running. Also aborts the scan if the current probe exceeded its timeout 
+ * ( e.g. SDA held low by a Slave ). On abort, doneCB is called from here, with Interrupts enabled.
+ * 
+ * @return uint8_t TRUE if a scan is running, FALSE otherwise
+ */
+uint8_t I2C_scanIsBusy( void )
+{
+    I2C_scanResult_t *result = NULL;
+    I2C_scanDoneCB_t doneCB = NULL;
+    uint32_t probeTick;
+
+    if( i2cScanCtx.state == I2C_SCAN_STATE_IDLE )
+    {
+        return FALSE;
+    }
+
+    /*The ISR restarts probeTick at every probe: sample it with the state, and the tick after it, so the difference never wraps*/
+    __disable_irq( );
+    probeTick = i2cScanCtx.probeTick;
+    if( ( i2cScanCtx.state != I2C_SCAN_STATE_IDLE ) && ( ( HAL_GetTick( ) - probeTick ) > i2cScanCtx.timeoutMs ) )
+    {
+        SET_BIT( hi2c1.Instance->CR1, I2C_CR1_STOP );
+        result  = i2cScanCtx.result;
+        doneCB  = i2cScanCtx.doneCB;
+        result->aborted = TRUE;
+        I2C_scanRelease( );
+    }
+    __enable_irq( );
+
+    if( result != NULL )
+    {
+        if( doneCB != NULL )
         {
-            printf( "0x%X", i << 1);
+            doneCB( result );
         }
+        return FALSE;
+    }
+
+    return ( i2cScanCtx.state != I2C_SCAN_STATE_IDLE ) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Print a Scan Result over the Serial Port. Kept separate from the scan itself so that the probing is never paced by the UART.
+ * 
+ * @param result Scan Result to be reported
+ */
+void I2C_scanReport( const I2C_scanResult_t *result )
+{
+    uint8_t addr;
+
+    printf( "I2C Scan: %u Device(s) found in %lu us%s \r\n", result->devCount, result->scanTimeUs, ( result->aborted ) ? " ( ABORTED )" : "" );
+
+    for( addr = I2C_SCAN_ADDR_FIRST; addr <= I2C_SCAN_ADDR_LAST; addr++ )
+    {
+        if( I2C_BITMAP_TEST( result->bitmap, addr ) )
+        {
+            printf( "  0x%02X ( 8 bit: 0x%02X ) \r\n", addr, addr << 1 );
+        }
+    }
+}
+
+/**
+ * @brief This function Scans the I2C bus for connected Slave Devices and reports their Addresses.
+ * 
+ */
+void I2C_scanBus( void )
+{
+    I2C_scanResult_t result;
+
+    printf( "Starting I2C Scanning: \r\n" );
+
+    if( I2C_scanBusBitmap( NULL, &result ) == HAL_OK )
+    {
+        I2C_scanReport( &result );
     }
 
     printf( "Done ! \r\n " );
+}
+
+/**
+ * @brief Enable the DWT Cycle Counter used to time the scans and the Inventory Bring Up
+ * 
+ */
+void I2C_cycleCounterInit( void )
+{
+    if( ( DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk ) == 0 )
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+/**
+ * @brief Convert a number of Core Clock Cycles to Microseconds
+ * 
+ * @param cycles Elapsed Core Clock Cycles
+ * @return uint32_t Elapsed Microseconds
+ */
+uint32_t I2C_cyclesToUs( uint32_t cycles )
+{
+    return cycles / ( SystemCoreClock / 1000000U );
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Validate a Scan Configuration
+ * 
+ * @param config Scan Configuration
+ * @return uint8_t TRUE if valid, FALSE otherwise
+ */
+static uint8_t I2C_scanConfigIsValid( const I2C_scanConfig_t *config )
+{
+    if( ( config->firstAddr < I2C_SCAN_ADDR_FIRST ) || ( config->lastAddr > I2C_SCAN_ADDR_LAST ) || 
+        ( config->firstAddr > config->lastAddr ) || ( config->trials == 0 ) || ( config->timeoutMs == 0 ) )
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Generate a START condition for the current address of the Interrupt driven Scan
+ * 
+ */
+static void I2C_scanStartProbe( void )
+{
+    i2cScanCtx.state = I2C_SCAN_STATE_START;
+    i2cScanCtx.probeTick = HAL_GetTick( );
+    SET_BIT( hi2c1.Instance->CR1, I2C_CR1_START );
+}
+
+/**
+ * @brief Finish the current probe and move on to the next address, or complete the scan
+ * 
+ * Called from Interrupt Context after the STOP condition has been requested.
+ */
+static void I2C_scanNextProbe( void )
+{
+    uint32_t guard = I2C_SCAN_STOP_GUARD;
+
+    /*START must not be requested before the hardware has cleared STOP ( a few bus clocks )*/
+    while( READ_BIT( hi2c1.Instance->CR1, I2C_CR1_STOP ) && ( guard-- > 0 ) )
+    {
+    }
+
+    if( i2cScanCtx.currAddr >= i2cScanCtx.lastAddr )
+    {
+        I2C_scanFinish( );
+        return;
+    }
+
+    i2cScanCtx.currAddr++;
+    I2C_scanStartProbe( );
+}
+
+/**
+ * @brief Complete the Interrupt driven Scan from Interrupt Context: release the peripheral and notify the user
+ * 
+ */
+static void I2C_scanFinish( void )
+{
+    I2C_scanResult_t *result = i2cScanCtx.result;
+
+    I2C_scanRelease( );
+
+    if( i2cScanCtx.doneCB != NULL )
+    {
+        i2cScanCtx.doneCB( result );
+    }
+}
+
+/**
+ * @brief Disable the Interrupts, time the scan and release the Handle
+ * 
+ */
+static void I2C_scanRelease( void )
+{
+    CLEAR_BIT( hi2c1.Instance->CR2, I2C_CR2_ITEVTEN | I2C_CR2_ITERREN );
+
+    i2cScanCtx.result->scanTimeUs = I2C_cyclesToUs( DWT->CYCCNT - i2cScanCtx.startCycles );
+
+    i2cScanCtx.state = I2C_SCAN_STATE_IDLE;
+    hi2c1.State = HAL_I2C_STATE_READY;
+}
+
+/**
+ * @brief Event Interrupt part of the Interrupt driven Scan
+ * 
+ * SB   -> START sent, send the Slave Address ( Write )
+ * ADDR -> Slave ACKed its Address, device is present
+ */
+static void I2C_scanEventHandler( void )
+{
+    uint32_t sr1 = hi2c1.Instance->SR1;
+
+    if( ( sr1 & I2C_SR1_SB ) && ( i2cScanCtx.state == I2C_SCAN_STATE_START ) )
+    {
+        i2cScanCtx.state = I2C_SCAN_STATE_ADDR;
+        hi2c1.Instance->DR = I2C_7BIT_ADD_WRITE( ( uint16_t )i2cScanCtx.currAddr << 1 );
+    }
+    else if( ( sr1 & I2C_SR1_ADDR ) && ( i2cScanCtx.state == I2C_SCAN_STATE_ADDR ) )
+    {
+        SET_BIT( hi2c1.Instance->CR1, I2C_CR1_STOP );
+        __HAL_I2C_CLEAR_ADDRFLAG( &hi2c1 );
+
+        I2C_BITMAP_SET( i2cScanCtx.result->bitmap, i2cScanCtx.currAddr );
+        i2cScanCtx.result->devCount++;
+
+        I2C_scanNextProbe( );
+    }
+}
+
+/**
+ * @brief Error Interrupt part of the Interrupt driven Scan
+ * 
+ * AF   -> Address was not ACKed, no device at this address
+ * BERR / ARLO -> Bus Error, the scan is aborted
+ */
+static void I2C_scanErrorHandler( void )
+{
+    uint32_t sr1 = hi2c1.Instance->SR1;
+
+    if( sr1 & I2C_SR1_AF )
+    {
+        __HAL_I2C_CLEAR_FLAG( &hi2c1, I2C_FLAG_AF );
+        SET_BIT( hi2c1.Instance->CR1, I2C_CR1_STOP );
+
+        I2C_scanNextProbe( );
+    }
+    else if( sr1 & ( I2C_SR1_BERR | I2C_SR1_ARLO ) )
+    {
+        __HAL_I2C_CLEAR_FLAG( &hi2c1, I2C_FLAG_BERR );
+        __HAL_I2C_CLEAR_FLAG( &hi2c1, I2C_FLAG_ARLO );
+        SET_BIT( hi2c1.Instance->CR1, I2C_CR1_STOP );
+
+        i2cScanCtx.result->aborted = TRUE;
+        I2C_scanFinish( );
+    }
 }
\ No newline at end of file
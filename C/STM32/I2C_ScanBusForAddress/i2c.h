@@ -5,7 +5,7 @@
 # Created Date: Saturday, October 28th 2023, 6:18:51 pm                        #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Saturday, October 28th 2023, 6:38:42 pm                       #
+# Last Modified: Sunday, October 18th 2026, 11:59:59 pm                        #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -22,6 +22,45 @@
 
 #include "main.h"
 
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Presence Bitmap: one bit per 7 bit Slave Address ( 128 bits )
+ * 
+ */
+typedef struct
+{
+    uint32_t word[ 4 ];
+} I2C_devBitmap_t;
+
+/**
+ * @brief Bus Scan Configuration
+ * 
+ */
+typedef struct
+{
+    uint8_t     firstAddr;  /*First 7 bit address to probe ( >= 0x01 )*/
+    uint8_t     lastAddr;   /*Last 7 bit address to probe ( <= 0x7F )*/
+    uint8_t     trials;     /*Probes per address ( Blocking Scan only )*/
+    uint32_t    timeoutMs;  /*Timeout per probe*/
+} I2C_scanConfig_t;
+
+/**
+ * @brief Bus Scan Result
+ * 
+ */
+typedef struct
+{
+    I2C_devBitmap_t bitmap;     /*Responding 7 bit addresses*/
+    uint8_t         devCount;   /*Number of responding addresses*/
+    uint8_t         aborted;    /*TRUE if the scan was stopped by a bus error or timeout*/
+    uint32_t        scanTimeUs; /*Duration of the scan*/
+} I2C_scanResult_t;
+
+typedef void ( *I2C_scanDoneCB_t )( const I2C_scanResult_t *result );
+
 /*##############################################################################################################################################*/
 /*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
@@ -29,7 +68,16 @@
 void I2C_init( void );
 void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c);
 void HAL_I2C_MspDeInit(I2C_HandleTypeDef* hi2c);
+void I2C1_EV_IRQHandler( void );
+void I2C1_ER_IRQHandler( void );
+void I2C_scanConfigDefault( I2C_scanConfig_t *config );
+HAL_StatusTypeDef I2C_scanBusBitmap( const I2C_scanConfig_t *config, I2C_scanResult_t *result );
+HAL_StatusTypeDef I2C_scanBusIT( const I2C_scanConfig_t *config, I2C_scanResult_t *result, I2C_scanDoneCB_t doneCB );
+uint8_t I2C_scanIsBusy( void );
+void I2C_scanReport( const I2C_scanResult_t *result );
 void I2C_scanBus( void );
+void I2C_cycleCounterInit( void );
+uint32_t I2C_cyclesToUs( uint32_t cycles );
 
 /*##############################################################################################################################################*/
 /*GLOBALS_______________________________________________________________________________________________________________________________________*/
@@ -41,18 +89,32 @@ void I2C_scanBus( void );
 /*DEFINES_______________________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
 
+/*Valid 7 bit Slave Address range ( 0x00 is the General Call address )*/
+#define I2C_SCAN_ADDR_FIRST         0x01
+#define I2C_SCAN_ADDR_LAST          0x7F
 
-/*##############################################################################################################################################*/
-/*EXTERNS_______________________________________________________________________________________________________________________________________*/
-/*##############################################################################################################################################*/
+/*Fast Scan: one probe per address, short timeout*/
+#define I2C_SCAN_FAST_TRIALS        1
+#define I2C_SCAN_FAST_TIMEOUT_MS    1
 
+/*Presence Bitmap Access*/
+#define I2C_BITMAP_SET( bmp, addr )     ( ( bmp ).word[ ( addr ) >> 5 ] |=  ( 1UL << ( ( addr ) & 0x1F ) ) )
+#define I2C_BITMAP_CLEAR( bmp, addr )   ( ( bmp ).word[ ( addr ) >> 5 ] &= ~( 1UL << ( ( addr ) & 0x1F ) ) )
+#define I2C_BITMAP_TEST( bmp, addr )    ( ( ( bmp ).word[ ( addr ) >> 5 ] >> ( ( addr ) & 0x1F ) ) & 1UL )
 
 
 /*##############################################################################################################################################*/
-/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
 /*##############################################################################################################################################*/
 
+extern I2C_HandleTypeDef hi2c1;
 
 
 /*##############################################################################################################################################*/
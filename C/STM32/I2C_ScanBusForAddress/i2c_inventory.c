@@ -0,0 +1,353 @@
+/*
+# ##############################################################################
+# File: i2c_inventory.c                                                        #
+# Project: src                                                                 #
+# Created Date: Sunday, October 18th 2026, 1:58:20 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 1:58:20 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "i2c_inventory.h"
+#include <stdio.h>
+#include <string.h>
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static volatile uint32_t    *I2C_invBkpRegs( void );
+static uint32_t             I2C_invChecksum( const uint32_t *words, uint8_t count );
+static void                 I2C_invPack( const I2C_inventory_t *inv, uint32_t *words );
+static void                 I2C_invReadIds( const I2C_idProbe_t *probes, uint8_t probeCount, const I2C_devBitmap_t *bitmap, uint8_t *id );
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+static const char * const i2cInvStartName[] = { "WARM", "COLD", "MISMATCH", "FORCED", "FAILED" };
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Load the Inventory stored in the RTC Backup Registers
+ * 
+ * @param inv Loaded Inventory
+ * @return HAL_StatusTypeDef HAL_OK if a valid Inventory was stored, HAL_ERROR otherwise ( first power up, layout change, corruption )
+ */
+HAL_StatusTypeDef I2C_invLoad( I2C_inventory_t *inv )
+{
+    volatile uint32_t *bkp = I2C_invBkpRegs( );
+    uint32_t words[ I2C_INV_BKP_WORDS ];
+    uint8_t i;
+
+    for( i = 0; i < I2C_INV_BKP_WORDS; i++ )
+    {
+        words[ i ] = bkp[ i ];
+    }
+
+    if( ( ( words[ 0 ] >> 16 ) != I2C_INV_MAGIC ) ||
+        ( words[ I2C_INV_BKP_WORDS - 1 ] != I2C_invChecksum( words, I2C_INV_BKP_WORDS - 1 ) ) )
+    {
+        return HAL_ERROR;
+    }
+
+    inv->devCount   = ( uint8_t )( words[ 0 ] & 0xFF );
+    inv->idCount    = ( uint8_t )( ( words[ 0 ] >> 8 ) & 0xFF );
+    memcpy( inv->bitmap.word, &words[ 1 ], sizeof( inv->bitmap.word ) );
+    memcpy( inv->id, &words[ 5 ], sizeof( inv->id ) );
+
+    if( inv->idCount > I2C_INV_ID_MAX )
+    {
+        return HAL_ERROR;
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Store the Inventory in the RTC Backup Registers ( kept over resets, lost on a full power down without VBAT )
+ * 
+ * @param inv Inventory to be stored
+ */
+void I2C_invSave( const I2C_inventory_t *inv )
+{
+    volatile uint32_t *bkp = I2C_invBkpRegs( );
+    uint32_t words[ I2C_INV_BKP_WORDS ];
+    uint8_t i;
+
+    I2C_invPack( inv, words );
+
+    __HAL_RCC_PWR_CLK_ENABLE( );
+    HAL_PWR_EnableBkUpAccess( );
+
+    for( i = 0; i < I2C_INV_BKP_WORDS; i++ )
+    {
+        bkp[ i ] = words[ i ];
+    }
+
+    HAL_PWR_DisableBkUpAccess( );
+}
+
+/**
+ * @brief Invalidate the stored Inventory, the next Bring Up runs a full scan
+ * 
+ */
+void I2C_invErase( void )
+{
+    volatile uint32_t *bkp = I2C_invBkpRegs( );
+
+    __HAL_RCC_PWR_CLK_ENABLE( );
+    HAL_PWR_EnableBkUpAccess( );
+
+    bkp[ 0 ] = 0;
+
+    HAL_PWR_DisableBkUpAccess( );
+}
+
+/**
+ * @brief Build an Inventory from a full Fast Scan of the bus and read the WHO_AM_I register of every probed device present
+ * 
+ * @param probes Identification Probes, may be NULL
+ * @param probeCount Number of Probes ( <= I2C_INV_ID_MAX )
+ * @param inv Built Inventory
+ * @return HAL_StatusTypeDef HAL_OK on completion, HAL_BUSY if the bus is in use, HAL_ERROR on invalid parameters
+ */
+HAL_StatusTypeDef I2C_invBuild( const I2C_idProbe_t *probes, uint8_t probeCount, I2C_inventory_t *inv )
+{
+    I2C_scanResult_t result;
+    HAL_StatusTypeDef ret;
+
+    if( ( probeCount > I2C_INV_ID_MAX ) || ( ( probes == NULL ) && ( probeCount != 0 ) ) )
+    {
+        return HAL_ERROR;
+    }
+
+    ret = I2C_scanBusBitmap( NULL, &result );
+    if( ret != HAL_OK )
+    {
+        return ret;
+    }
+
+    memset( inv, 0, sizeof( *inv ) );
+    inv->bitmap     = result.bitmap;
+    inv->devCount   = result.devCount;
+    inv->idCount    = probeCount;
+    I2C_invReadIds( probes, probeCount, &inv->bitmap, inv->id );
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Check a stored Inventory against the bus. Only the known addresses are probed, 
+ * and the WHO_AM_I register of every probed device present is compared.
+ * 
+ * @param inv Stored Inventory
+ * @param probes Identification Probes, must be the table the Inventory was built with
+ * @param probeCount Number of Probes
+ * @return HAL_StatusTypeDef HAL_OK if the bus matches, HAL_ERROR on mismatch, HAL_BUSY if the bus is in use
+ */
+HAL_StatusTypeDef I2C_invVerify( const I2C_inventory_t *inv, const I2C_idProbe_t *probes, uint8_t probeCount )
+{
+    uint8_t id[ I2C_INV_ID_MAX ];
+    uint8_t addr;
+
+    if( ( inv->idCount != probeCount ) || ( probeCount > I2C_INV_ID_MAX ) || ( ( probes == NULL ) && ( probeCount != 0 ) ) )
+    {
+        return HAL_ERROR;
+    }
+
+    if( I2C_scanIsBusy( ) )
+    {
+        return HAL_BUSY;
+    }
+
+    for( addr = I2C_SCAN_ADDR_FIRST; addr <= I2C_SCAN_ADDR_LAST; addr++ )
+    {
+        if( I2C_BITMAP_TEST( inv->bitmap, addr ) && 
+            ( HAL_I2C_IsDeviceReady( &hi2c1, ( uint16_t )addr << 1, I2C_INV_VERIFY_TRIALS, I2C_INV_VERIFY_TIMEOUT_MS ) != HAL_OK ) )
+        {
+            return HAL_ERROR;
+        }
+    }
+
+    I2C_invReadIds( probes, probeCount, &inv->bitmap, id );
+    if( memcmp( id, inv->id, probeCount ) != 0 )
+    {
+        return HAL_ERROR;
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Bring Up the I2C bus Inventory. On a warm start the stored Inventory is only verified, 
+ * a full scan is run ( and stored ) on first power up, on mismatch or when requested.
+ * 
+ * @param probes Identification Probes, may be NULL
+ * @param probeCount Number of Probes ( <= I2C_INV_ID_MAX )
+ * @param forceRescan TRUE to always run a full scan
+ * @param inv Current Inventory
+ * @param timeUs Optional Bring Up Duration, may be NULL
+ * @return I2C_invStart_t How the Inventory was obtained
+ */
+I2C_invStart_t I2C_invBringUp( const I2C_idProbe_t *probes, uint8_t probeCount, uint8_t forceRescan, I2C_inventory_t *inv, uint32_t *timeUs )
+{
+    I2C_invStart_t start;
+    uint32_t startCycles;
+
+    I2C_cycleCounterInit( );
+    startCycles = DWT->CYCCNT;
+
+    if( forceRescan )
+    {
+        start = I2C_INV_FORCED;
+    }
+    else if( I2C_invLoad( inv ) != HAL_OK )
+    {
+        start = I2C_INV_COLD;
+    }
+    else if( I2C_invVerify( inv, probes, probeCount ) != HAL_OK )
+    {
+        start = I2C_INV_MISMATCH;
+    }
+    else
+    {
+        start = I2C_INV_WARM;
+    }
+
+    if( start != I2C_INV_WARM )
+    {
+        if( I2C_invBuild( probes, probeCount, inv ) == HAL_OK )
+        {
+            I2C_invSave( inv );
+        }
+        else
+        {
+            memset( inv, 0, sizeof( *inv ) );
+            start = I2C_INV_FAILED;
+        }
+    }
+
+    if( timeUs != NULL )
+    {
+        *timeUs = I2C_cyclesToUs( DWT->CYCCNT - startCycles );
+    }
+
+    return start;
+}
+
+/**
+ * @brief Print an Inventory over the Serial Port
+ * 
+ * @param inv Inventory
+ * @param start How the Inventory was obtained
+ * @param timeUs Bring Up Duration
+ */
+void I2C_invReport( const I2C_inventory_t *inv, I2C_invStart_t start, uint32_t timeUs )
+{
+    uint8_t addr;
+
+    printf( "I2C Inventory ( %s ): %u Device(s) in %lu us \r\n", i2cInvStartName[ start ], inv->devCount, timeUs );
+
+    for( addr = I2C_SCAN_ADDR_FIRST; addr <= I2C_SCAN_ADDR_LAST; addr++ )
+    {
+        if( I2C_BITMAP_TEST( inv->bitmap, addr ) )
+        {
+            printf( "  0x%02X ( 8 bit: 0x%02X ) \r\n", addr, addr << 1 );
+        }
+    }
+}
+
+/*Static Helpers--------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief First RTC Backup Register of the Inventory ( BKP0R..BKP19R are consecutive words )
+ * 
+ */
+static volatile uint32_t *I2C_invBkpRegs( void )
+{
+    return &RTC->BKP0R + I2C_INV_BKP_FIRST;
+}
+
+/**
+ * @brief Checksum of the stored words ( rotate-xor, catches random Backup Register content after a power up )
+ * 
+ */
+static uint32_t I2C_invChecksum( const uint32_t *words, uint8_t count )
+{
+    uint32_t sum = 0xA5A5A5A5UL;
+    uint8_t i;
+
+    for( i = 0; i < count; i++ )
+    {
+        sum = ( ( sum << 5 ) | ( sum >> 27 ) ) ^ words[ i ];
+    }
+
+    return sum;
+}
+
+/**
+ * @brief Serialize an Inventory into the Backup Register layout: Header, Bitmap, Ids, Checksum
+ * 
+ */
+static void I2C_invPack( const I2C_inventory_t *inv, uint32_t *words )
+{
+    words[ 0 ] = ( ( uint32_t )I2C_INV_MAGIC << 16 ) | ( ( uint32_t )inv->idCount << 8 ) | inv->devCount;
+    memcpy( &words[ 1 ], inv->bitmap.word, sizeof( inv->bitmap.word ) );
+    memcpy( &words[ 5 ], inv->id, sizeof( inv->id ) );
+    words[ I2C_INV_BKP_WORDS - 1 ] = I2C_invChecksum( words, I2C_INV_BKP_WORDS - 1 );
+}
+
+/**
+ * @brief Read the WHO_AM_I register of every probed device present in the bitmap ( 0 if absent or unreadable )
+ * 
+ */
+static void I2C_invReadIds( const I2C_idProbe_t *probes, uint8_t probeCount, const I2C_devBitmap_t *bitmap, uint8_t *id )
+{
+    uint8_t i;
+
+    memset( id, 0, I2C_INV_ID_MAX );
+
+    for( i = 0; i < probeCount; i++ )
+    {
+        if( ( probes[ i ].addr > I2C_SCAN_ADDR_LAST ) || !I2C_BITMAP_TEST( *bitmap, probes[ i ].addr ) )
+        {
+            continue;
+        }
+
+        if( HAL_I2C_Mem_Read( &hi2c1, ( uint16_t )probes[ i ].addr << 1, probes[ i ].reg, I2C_MEMADD_SIZE_8BIT, &id[ i ], 1, I2C_INV_ID_TIMEOUT_MS ) != HAL_OK )
+        {
+            id[ i ] = 0;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+/*
+# ##############################################################################
+# File: i2c_inventory.h                                                        #
+# Project: include                                                             #
+# Created Date: Sunday, October 18th 2026, 1:58:20 pm                          #
+# Author: Zafeer Abbasi                                                        #
+# ----------------------------------------------                               #
+# Last Modified: Sunday, October 18th 2026, 1:58:20 pm                         #
+# Modified By: Zafeer Abbasi                                                   #
+# ----------------------------------------------                               #
+# Copyright (c) 2026 Zafeer.A                                                  #
+# ----------------------------------------------                               #
+# HISTORY:                                                                     #
+ */
+
+#ifndef INC_I2C_INVENTORY_H
+#define INC_I2C_INVENTORY_H
+
+/*##############################################################################################################################################*/
+/*INCLUDES______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+#include "main.h"
+#include "i2c.h"
+
+/*##############################################################################################################################################*/
+/*FUNCTION DECLARATIONS_________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*GLOBALS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*DEFINES_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/*Maximum number of WHO_AM_I Probes kept in the Inventory*/
+#define I2C_INV_ID_MAX              16
+
+/*Inventory Storage: RTC Backup Registers, kept over resets as long as VDD or VBAT is present*/
+#define I2C_INV_BKP_FIRST           0       /*First RTC Backup Register used by the Inventory*/
+#define I2C_INV_BKP_WORDS           ( 1 + 4 + ( I2C_INV_ID_MAX / 4 ) + 1 ) /*Header, Bitmap, Ids, Checksum*/
+#define I2C_INV_MAGIC               0x12C0U /*Upper half of the Header word, change if the layout changes*/
+
+#if ( I2C_INV_ID_MAX % 4 ) != 0
+#error "I2C_INV_ID_MAX must be a multiple of 4"
+#endif
+#if ( I2C_INV_BKP_FIRST + I2C_INV_BKP_WORDS ) > 20
+#error "I2C Inventory does not fit into the 20 RTC Backup Registers"
+#endif
+
+/*Warm Start Verification: one probe per known address, short timeouts*/
+#define I2C_INV_VERIFY_TRIALS       1
+#define I2C_INV_VERIFY_TIMEOUT_MS   1
+#define I2C_INV_ID_TIMEOUT_MS       2
+
+/*##############################################################################################################################################*/
+/*EXTERNS_______________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+
+
+/*##############################################################################################################################################*/
+/*TYPEDEFS/STRUCTS/ENUMS________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+/**
+ * @brief Identification Probe of a known device: the WHO_AM_I ( ID ) register read on every Bring Up
+ * 
+ */
+typedef struct
+{
+    uint8_t addr;   /*7 bit Slave Address*/
+    uint8_t reg;    /*WHO_AM_I Register Address*/
+} I2C_idProbe_t;
+
+/**
+ * @brief Device Inventory: presence bitmap plus the WHO_AM_I byte of each probed device
+ * 
+ */
+typedef struct
+{
+    I2C_devBitmap_t bitmap;                 /*Responding 7 bit addresses*/
+    uint8_t         devCount;               /*Number of responding addresses*/
+    uint8_t         idCount;                /*Number of Probes the ids were read with*/
+    uint8_t         id[ I2C_INV_ID_MAX ];   /*WHO_AM_I per Probe, same order as the Probe table ( 0 if absent )*/
+} I2C_inventory_t;
+
+/**
+ * @brief How the Inventory was obtained on Bring Up
+ * 
+ */
+typedef enum
+{
+    I2C_INV_WARM = 0,   /*Stored Inventory verified, no scan*/
+    I2C_INV_COLD,       /*No valid stored Inventory, full scan*/
+    I2C_INV_MISMATCH,   /*Stored Inventory did not match the bus, full scan*/
+    I2C_INV_FORCED,     /*Full scan requested by the caller*/
+    I2C_INV_FAILED      /*Full scan could not be run ( bus busy )*/
+} I2C_invStart_t;
+
+/*##############################################################################################################################################*/
+/*FUNCTIONS_____________________________________________________________________________________________________________________________________*/
+/*##############################################################################################################################################*/
+
+HAL_StatusTypeDef I2C_invLoad( I2C_inventory_t *inv );
+void I2C_invSave( const I2C_inventory_t *inv );
+void I2C_invErase( void );
+HAL_StatusTypeDef I2C_invBuild( const I2C_idProbe_t *probes, uint8_t probeCount, I2C_inventory_t *inv );
+HAL_StatusTypeDef I2C_invVerify( const I2C_inventory_t *inv, const I2C_idProbe_t *probes, uint8_t probeCount );
+I2C_invStart_t I2C_invBringUp( const I2C_idProbe_t *probes, uint8_t probeCount, uint8_t forceRescan, I2C_inventory_t *inv, uint32_t *timeUs );
+void I2C_invReport( const I2C_inventory_t *inv, I2C_invStart_t start, uint32_t timeUs );
+
+#endif
\ No newline at end of file
@@ -5,7 +5,7 @@
 # Created Date: Sunday, October 22nd 2023, 3:11:07 pm                          #
 # Author: Zafeer Abbasi                                                        #
 # ----------------------------------------------                               #
-# Last Modified: Saturday, October 28th 2023, 7:16:23 pm                       #
+# Last Modified: Sunday, October 18th 2026, 1:58:20 pm                         #
 # Modified By: Zafeer Abbasi                                                   #
 # ----------------------------------------------                               #
 # Copyright (c) 2023 Zafeer.A                                                  #
@@ -35,6 +35,7 @@
 #include "usart.h"
 #include "gpio.h"
 #include "i2c.h"
+#include "i2c_inventory.h"
 #include "app_bluenrg.h"
 
 /* Private includes ----------------------------------------------------------*/
@@ -60,6 +61,7 @@
 /* Private variables ---------------------------------------------------------*/
 
 /* USER CODE BEGIN PV */
+static I2C_inventory_t i2cInventory;
 
 /* USER CODE END PV */
 
@@ -100,7 +102,14 @@ int main(void)
   
   printf( " Initialization Successful \r\n" );
 
-  //I2C_scanBus( );
+  /*Bring Up the I2C Inventory: warm boots only re-verify the known devices, a full scan runs on first power up or mismatch.
+    Pass a WHO_AM_I Probe table ( e.g. { 0x68, 0x75 } for an MPU6050 ) to also check the device identities*/
+  {
+    uint32_t bringUpUs;
+    I2C_invStart_t start = I2C_invBringUp( NULL, 0, FALSE, &i2cInventory, &bringUpUs );
+
+    I2C_invReport( &i2cInventory, start, bringUpUs );
+  }
 
   /* Infinite loop */
   while (1)